@@ -1,6 +1,7 @@
 // Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
 
 #include "ACFAIController.h"
+#include "ACFAIUpdateSubsystem.h"
 #include "ATSAITargetComponent.h"
 #include "ATSTargetingComponent.h"
 #include "Actors/ACFActor.h"
@@ -112,6 +113,20 @@ void AACFAIController::OnPossess(APawn* possPawn)
     if (ThreatComponent) {
         ThreatComponent->OnNewMaxThreateningActor.AddDynamic(this, &AACFAIController::HandleMaxThreatUpdated);
     }
+
+    if (bUseBatchedUpdate && GetWorld()) {
+        if (UACFAIUpdateSubsystem* updateSubsystem = GetWorld()->GetSubsystem<UACFAIUpdateSubsystem>()) {
+            updateSubsystem->RegisterAgent(this);
+        }
+    }
+}
+
+UACFAIUpdateSubsystem* AACFAIController::GetUpdateSubsystem() const
+{
+    if (!bUseBatchedUpdate || !GetWorld()) {
+        return nullptr;
+    }
+    return GetWorld()->GetSubsystem<UACFAIUpdateSubsystem>();
 }
 
 void AACFAIController::OnUnPossess()
@@ -125,6 +140,10 @@ void AACFAIController::OnUnPossess()
     if (ThreatComponent) {
         ThreatComponent->OnNewMaxThreateningActor.RemoveDynamic(this, &AACFAIController::HandleMaxThreatUpdated);
     }
+
+    if (UACFAIUpdateSubsystem* updateSubsystem = GetUpdateSubsystem()) {
+        updateSubsystem->UnregisterAgent(this);
+    }
 }
 
 void AACFAIController::EnableCharacterComponents(bool bEnabled)
@@ -205,6 +224,9 @@ void AACFAIController::BeginPlay()
 
 void AACFAIController::EndPlay(const EEndPlayReason::Type reason)
 {
+    if (UACFAIUpdateSubsystem* updateSubsystem = GetUpdateSubsystem()) {
+        updateSubsystem->UnregisterAgent(this);
+    }
     Super::EndPlay(reason);
     TObjectPtr<AGameStateBase> gameState = UGameplayStatics::GetGameState(this);
     if (gameState) {
@@ -224,7 +246,7 @@ void AACFAIController::TriggerCommand(const FGameplayTag& command)
 
 bool AACFAIController::IsInBattle() const
 {
-    return GetAIState() == UGameplayTagsManager::Get().RequestGameplayTag(ACF::AICombat);
+    return GetAIState() == FACFAIStateTags::Get().Combat;
 }
 
 class UACFGroupAIComponent* AACFAIController::GetOwningGroup_Implementation()
@@ -313,21 +335,21 @@ void AACFAIController::SetCurrentAIState(FGameplayTag aiState)
         return;
     }
 
-    if (GetAIState() == UGameplayTagsManager::Get().RequestGameplayTag(ACF::AICombat) && CombatBehaviorComponent && PerceptionComponent && 
-        aiState != UGameplayTagsManager::Get().RequestGameplayTag(ACF::AICombat)) {
+    if (GetAIState() == FACFAIStateTags::Get().Combat && CombatBehaviorComponent && PerceptionComponent && 
+        aiState != FACFAIStateTags::Get().Combat) {
 
         CombatBehaviorComponent->UninitBehavior();
     }
 
-    if (aiState == UGameplayTagsManager::Get().RequestGameplayTag(ACF::AIFollowLead)) {
+    if (aiState == FACFAIStateTags::Get().FollowLead) {
         SetFocus(GetLeadActorBK(), EAIFocusPriority::Gameplay);
     }
 
-    if (aiState == UGameplayTagsManager::Get().RequestGameplayTag(ACF::AIReturnHome)) {
+    if (aiState == FACFAIStateTags::Get().ReturnHome) {
         SetTargetLocationBK(homeLocation);
     }
 
-    if (aiState == UGameplayTagsManager::Get().RequestGameplayTag(ACF::AICombat) && CombatBehaviorComponent) {
+    if (aiState == FACFAIStateTags::Get().Combat && CombatBehaviorComponent) {
         CombatBehaviorComponent->InitBehavior(this);
     }
 
@@ -569,7 +591,7 @@ void AACFAIController::SetTarget(AActor* currentTarget)
         IACFEntityInterface* entity = Cast<IACFEntityInterface>(currentTarget);
         
         if (entity && PossessedEntity && IACFEntityInterface::Execute_IsEntityAlive(currentTarget) && UACFFunctionLibrary::AreEnemyTeams(GetWorld(), IACFEntityInterface::Execute_GetEntityCombatTeam(CharacterOwned), IACFEntityInterface::Execute_GetEntityCombatTeam(currentTarget))) {
-            SetCurrentAIState(UGameplayTagsManager::Get().RequestGameplayTag(ACF::AICombat));
+            SetCurrentAIState(FACFAIStateTags::Get().Combat);
 
             // Add OnOwnerDeath event for current target.
             UACFDamageHandlerComponent* damageComp = currentTarget->FindComponentByClass<UACFDamageHandlerComponent>();
@@ -656,7 +678,7 @@ void AACFAIController::HandleCharacterHit(const FACFDamageEvent& damageReceived)
 
 void AACFAIController::HandleCharacterDeath()
 {
-    SetCurrentAIState(UGameplayTagsManager::Get().RequestGameplayTag(ACF::AIWait));
+    SetCurrentAIState(FACFAIStateTags::Get().Wait);
     if (CharacterOwned) {
         CharacterOwned->GetMovementComponent()->StopMovementImmediately();
     }
@@ -0,0 +1,155 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2025. All Rights Reserved.
+
+#include "ACFAIRoutineSubsystem.h"
+#include "Components/ACFAIRoutineComponent.h"
+#include "DaySequenceActor.h"
+#include "DaySequenceSubsystem.h"
+#include <Engine/World.h>
+
+bool UACFAIRoutineSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UACFAIRoutineSubsystem::Deinitialize()
+{
+	WakeQueue.Empty();
+	ScheduledWakes.Empty();
+	LastDayMinute = INDEX_NONE;
+
+	Super::Deinitialize();
+}
+
+TStatId UACFAIRoutineSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UACFAIRoutineSubsystem, STATGROUP_Tickables);
+}
+
+float UACFAIRoutineSubsystem::GetTimeHours() const
+{
+	if (const UDaySequenceSubsystem* DaySequence = GetWorld()->GetSubsystem<UDaySequenceSubsystem>())
+	{
+		if (const ADaySequenceActor* DaySequencerActor = DaySequence->GetDaySequenceActor())
+		{
+			return DaySequencerActor->GetApparentTimeOfDay();
+		}
+	}
+	return 0.f;
+}
+
+void UACFAIRoutineSubsystem::RegisterRoutine(UACFAIRoutineComponent* Routine)
+{
+	if (!Routine || ScheduledWakes.Contains(Routine))
+	{
+		return;
+	}
+
+	ScheduledWakes.Add(Routine, INDEX_NONE);
+	RefreshRoutine(Routine);
+}
+
+void UACFAIRoutineSubsystem::UnregisterRoutine(const UACFAIRoutineComponent* Routine)
+{
+	// the queued entry becomes stale and is dropped when it reaches the top
+	ScheduledWakes.Remove(Routine);
+}
+
+void UACFAIRoutineSubsystem::RefreshRoutine(UACFAIRoutineComponent* Routine)
+{
+	if (!Routine || !ScheduledWakes.Contains(Routine) || LastDayMinute == INDEX_NONE)
+	{
+		// scheduled on the first update with a valid clock
+		return;
+	}
+
+	Routine->UpdateByMinutes(LastDayMinute);
+	Schedule(Routine);
+}
+
+void UACFAIRoutineSubsystem::Schedule(UACFAIRoutineComponent* Routine)
+{
+	const int32 NextMinute = Routine->GetNextTaskMinute(LastDayMinute);
+	const int64 NextWakeMinute = NextMinute == INDEX_NONE ? INDEX_NONE : ClockMinute - LastDayMinute + NextMinute;
+	ScheduledWakes.Add(Routine, NextWakeMinute);
+	if (NextWakeMinute != INDEX_NONE)
+	{
+		WakeQueue.HeapPush({ Routine, NextWakeMinute });
+	}
+}
+
+void UACFAIRoutineSubsystem::ResyncAll()
+{
+	WakeQueue.Reset();
+	for (auto It = ScheduledWakes.CreateIterator(); It; ++It)
+	{
+		UACFAIRoutineComponent* Routine = It.Key().ResolveObjectPtr();
+		if (!Routine)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+		Routine->UpdateByMinutes(LastDayMinute);
+		const int32 NextMinute = Routine->GetNextTaskMinute(LastDayMinute);
+		It.Value() = NextMinute == INDEX_NONE ? INDEX_NONE : ClockMinute - LastDayMinute + NextMinute;
+		if (It.Value() != INDEX_NONE)
+		{
+			WakeQueue.HeapPush({ Routine, It.Value() });
+		}
+	}
+	WokenRoutines = ScheduledWakes.Num();
+}
+
+void UACFAIRoutineSubsystem::Tick(float DeltaTime)
+{
+	// the clock advances even without routines, so a routine registered later starts from the current minute
+	AdvanceToMinute(UACFAIRoutineComponent::ToMinutes(GetTimeHours()));
+}
+
+void UACFAIRoutineSubsystem::AdvanceToMinute(int32 DayMinute)
+{
+	WokenRoutines = 0;
+
+	if (DayMinute == LastDayMinute)
+	{
+		return;
+	}
+
+	if (LastDayMinute == INDEX_NONE)
+	{
+		// first valid clock: every registered routine starts from the current task
+		LastDayMinute = DayMinute;
+		ResyncAll();
+		return;
+	}
+
+	int32 ElapsedMinutes = DayMinute - LastDayMinute;
+	if (ElapsedMinutes < 0)
+	{
+		ElapsedMinutes += 1440;
+	}
+	ClockMinute += ElapsedMinutes;
+	LastDayMinute = DayMinute;
+
+	if (ElapsedMinutes > MaxMinutesPerUpdate)
+	{
+		ResyncAll();
+		return;
+	}
+
+	while (WakeQueue.Num() > 0 && WakeQueue.HeapTop().WakeMinute <= ClockMinute)
+	{
+		FScheduledWake Wake;
+		WakeQueue.HeapPop(Wake, EAllowShrinking::No);
+
+		UACFAIRoutineComponent* Routine = Wake.Routine.Get();
+		const int64* ScheduledMinute = Routine ? ScheduledWakes.Find(Routine) : nullptr;
+		if (!ScheduledMinute || *ScheduledMinute != Wake.WakeMinute)
+		{
+			continue;
+		}
+
+		Routine->UpdateByMinutes(DayMinute);
+		Schedule(Routine);
+		WokenRoutines++;
+	}
+}
@@ -3,6 +3,20 @@
 #include "ACFAITypes.h"
 #include "ACFAIController.h"
 #include "Actors/ACFCharacter.h"
+#include <GameplayTagsManager.h>
+
+FACFAIStateTags FACFAIStateTags::StateTags;
+
+void FACFAIStateTags::InitializeNativeTags()
+{
+    UGameplayTagsManager& tagsManager = UGameplayTagsManager::Get();
+    StateTags.Wait = tagsManager.AddNativeGameplayTag(ACF::AIWait);
+    StateTags.Patrol = tagsManager.AddNativeGameplayTag(ACF::AIPatrol);
+    StateTags.Combat = tagsManager.AddNativeGameplayTag(ACF::AICombat);
+    StateTags.ReturnHome = tagsManager.AddNativeGameplayTag(ACF::AIReturnHome);
+    StateTags.FollowLead = tagsManager.AddNativeGameplayTag(ACF::AIFollowLead);
+    StateTags.Routine = tagsManager.AddNativeGameplayTag(ACF::AIRoutine);
+}
 
 FAIAgentsInfo::FAIAgentsInfo(AACFCharacter* inChar)
 {
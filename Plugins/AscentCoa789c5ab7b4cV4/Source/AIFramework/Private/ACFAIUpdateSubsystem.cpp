@@ -0,0 +1,248 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ACFAIUpdateSubsystem.h"
+#include "ACFAIController.h"
+#include "ACFAITypes.h"
+#include "Actors/ACFCharacter.h"
+#include <Async/ParallelFor.h>
+#include <Components/SkeletalMeshComponent.h>
+#include <GameFramework/Character.h>
+
+namespace {
+enum EAgentUpdateFlags : uint8 {
+    EValid = 1 << 0,
+    EHasTarget = 1 << 1,
+    ETargetIsCharacter = 1 << 2,
+    EHasLead = 1 << 3,
+    EWriteHome = 1 << 4,
+};
+
+float GetMeshExtent(const ACharacter* character)
+{
+    const USkeletalMeshComponent* mesh = character ? character->GetMesh() : nullptr;
+    return mesh ? mesh->Bounds.GetBox().GetExtent().X : 0.f;
+}
+}
+
+bool UACFAIUpdateSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UACFAIUpdateSubsystem::Deinitialize()
+{
+    AgentIndices.Empty();
+    AgentKeys.Empty();
+    Controllers.Empty();
+    AgentLocations.Empty();
+    AgentExtents.Empty();
+    Targets.Empty();
+    TargetLocations.Empty();
+    TargetExtents.Empty();
+    Leads.Empty();
+    LeadLocations.Empty();
+    HomeLocations.Empty();
+    UpdateFlags.Empty();
+    TargetDistances.Empty();
+    LeadDistances.Empty();
+    HomeDistances.Empty();
+    WrittenTargetDistances.Empty();
+    WrittenLeadDistances.Empty();
+    WrittenHomeDistances.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UACFAIUpdateSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UACFAIUpdateSubsystem, STATGROUP_Tickables);
+}
+
+void UACFAIUpdateSubsystem::RegisterAgent(AACFAIController* controller)
+{
+    if (!controller || AgentIndices.Contains(controller)) {
+        return;
+    }
+
+    AgentIndices.Add(controller, Controllers.Num());
+    AgentKeys.Add(controller);
+    Controllers.Add(controller);
+    AgentLocations.AddZeroed();
+    AgentExtents.AddZeroed();
+    Targets.AddDefaulted();
+    TargetLocations.AddZeroed();
+    TargetExtents.AddZeroed();
+    Leads.AddDefaulted();
+    LeadLocations.AddZeroed();
+    HomeLocations.AddZeroed();
+    UpdateFlags.AddZeroed();
+    TargetDistances.Add(-1.f);
+    LeadDistances.Add(-1.f);
+    HomeDistances.Add(-1.f);
+    WrittenTargetDistances.Add(-1.f);
+    WrittenLeadDistances.Add(-1.f);
+    WrittenHomeDistances.Add(-1.f);
+}
+
+void UACFAIUpdateSubsystem::UnregisterAgent(const AACFAIController* controller)
+{
+    const int32* index = AgentIndices.Find(controller);
+    if (index) {
+        RemoveAgentAt(*index);
+    }
+}
+
+void UACFAIUpdateSubsystem::RemoveAgentAt(int32 index)
+{
+    const int32 lastIndex = Controllers.Num() - 1;
+    AgentIndices.Remove(AgentKeys[index]);
+    if (index != lastIndex) {
+        // the last agent takes the place of the removed one
+        AgentIndices.Add(AgentKeys[lastIndex], index);
+    }
+
+    AgentKeys.RemoveAtSwap(index, EAllowShrinking::No);
+    Controllers.RemoveAtSwap(index, EAllowShrinking::No);
+    AgentLocations.RemoveAtSwap(index, EAllowShrinking::No);
+    AgentExtents.RemoveAtSwap(index, EAllowShrinking::No);
+    Targets.RemoveAtSwap(index, EAllowShrinking::No);
+    TargetLocations.RemoveAtSwap(index, EAllowShrinking::No);
+    TargetExtents.RemoveAtSwap(index, EAllowShrinking::No);
+    Leads.RemoveAtSwap(index, EAllowShrinking::No);
+    LeadLocations.RemoveAtSwap(index, EAllowShrinking::No);
+    HomeLocations.RemoveAtSwap(index, EAllowShrinking::No);
+    UpdateFlags.RemoveAtSwap(index, EAllowShrinking::No);
+    TargetDistances.RemoveAtSwap(index, EAllowShrinking::No);
+    LeadDistances.RemoveAtSwap(index, EAllowShrinking::No);
+    HomeDistances.RemoveAtSwap(index, EAllowShrinking::No);
+    WrittenTargetDistances.RemoveAtSwap(index, EAllowShrinking::No);
+    WrittenLeadDistances.RemoveAtSwap(index, EAllowShrinking::No);
+    WrittenHomeDistances.RemoveAtSwap(index, EAllowShrinking::No);
+}
+
+bool UACFAIUpdateSubsystem::GetAgentDistances(const AACFAIController* controller, FACFAIAgentDistances& outDistances) const
+{
+    const int32* index = AgentIndices.Find(controller);
+    // results are computed at the end of the frame and used by the services of the next one
+    if (!index || LastUpdateFrame == 0 || GFrameCounter > LastUpdateFrame + 1 || !(UpdateFlags[*index] & EValid)) {
+        return false;
+    }
+
+    outDistances.Target = Targets[*index].Get();
+    outDistances.TargetDistance = TargetDistances[*index];
+    outDistances.Lead = Leads[*index].Get();
+    outDistances.LeadDistance = LeadDistances[*index];
+    outDistances.HomeDistance = HomeDistances[*index];
+    return true;
+}
+
+void UACFAIUpdateSubsystem::Tick(float DeltaTime)
+{
+    const int32 numAgents = Controllers.Num();
+    SkippedWrites = 0;
+    if (numAgents == 0) {
+        return;
+    }
+
+    const FGameplayTag& returnHomeTag = FACFAIStateTags::Get().ReturnHome;
+
+    // gather, on the game thread
+    for (int32 index = numAgents - 1; index >= 0; index--) {
+        AACFAIController* controller = Controllers[index].Get();
+        if (!controller) {
+            RemoveAgentAt(index);
+            continue;
+        }
+
+        const AACFCharacter* agent = controller->GetBaseAICharacter();
+        if (!agent) {
+            UpdateFlags[index] = 0;
+            continue;
+        }
+
+        uint8 flags = EValid;
+        AgentLocations[index] = agent->GetActorLocation();
+        AgentExtents[index] = GetMeshExtent(agent);
+
+        const AActor* target = controller->GetTargetActorBK();
+        Targets[index] = target;
+        if (target) {
+            flags |= EHasTarget;
+            TargetLocations[index] = target->GetActorLocation();
+            if (const ACharacter* targetChar = Cast<ACharacter>(target)) {
+                flags |= ETargetIsCharacter;
+                TargetExtents[index] = GetMeshExtent(targetChar);
+            }
+        }
+
+        const bool bIsPartOfGroup = controller->IsPartOfGroup();
+        const AActor* lead = bIsPartOfGroup ? controller->GetLeadActorBK() : nullptr;
+        Leads[index] = lead;
+        if (lead) {
+            flags |= EHasLead;
+            LeadLocations[index] = lead->GetActorLocation();
+        }
+
+        HomeLocations[index] = controller->GetHomeLocation();
+        if (!bIsPartOfGroup && controller->ShouldReturnHome() && controller->GetAIState() != returnHomeTag) {
+            flags |= EWriteHome;
+        }
+        UpdateFlags[index] = flags;
+    }
+
+    // compute, in parallel
+    const int32 numUpdated = Controllers.Num();
+    ParallelFor(numUpdated, [this](int32 index) {
+        const uint8 flags = UpdateFlags[index];
+        if (!(flags & EValid)) {
+            return;
+        }
+
+        const FVector& agentLocation = AgentLocations[index];
+        if (flags & EHasTarget) {
+            const float distance = FVector::Dist(agentLocation, TargetLocations[index]);
+            TargetDistances[index] = (flags & ETargetIsCharacter) ? distance - AgentExtents[index] - TargetExtents[index] : distance;
+        } else {
+            TargetDistances[index] = -1.f;
+        }
+        LeadDistances[index] = (flags & EHasLead) ? FVector::Dist(agentLocation, LeadLocations[index]) : -1.f;
+        HomeDistances[index] = FVector::Dist(agentLocation, HomeLocations[index]);
+    },
+        numUpdated < MinAgentsForParallelUpdate);
+
+    // write back only what changed, on the game thread
+    for (int32 index = 0; index < numUpdated; index++) {
+        const uint8 flags = UpdateFlags[index];
+        AACFAIController* controller = Controllers[index].Get();
+        if (!(flags & EValid) || !controller) {
+            continue;
+        }
+
+        if (flags & EHasTarget) {
+            if (FMath::Abs(TargetDistances[index] - WrittenTargetDistances[index]) > DistanceWriteTolerance) {
+                controller->SetTargetActorDistanceBK(TargetDistances[index]);
+                WrittenTargetDistances[index] = TargetDistances[index];
+            } else {
+                SkippedWrites++;
+            }
+        }
+        if (flags & EHasLead) {
+            if (FMath::Abs(LeadDistances[index] - WrittenLeadDistances[index]) > DistanceWriteTolerance) {
+                controller->SetLeadActorDistanceBK(LeadDistances[index]);
+                WrittenLeadDistances[index] = LeadDistances[index];
+            } else {
+                SkippedWrites++;
+            }
+        }
+        if (flags & EWriteHome) {
+            if (FMath::Abs(HomeDistances[index] - WrittenHomeDistances[index]) > DistanceWriteTolerance) {
+                controller->SetHomeDistanceBK(HomeDistances[index]);
+                WrittenHomeDistances[index] = HomeDistances[index];
+            } else {
+                SkippedWrites++;
+            }
+        }
+    }
+
+    LastUpdateFrame = GFrameCounter;
+}
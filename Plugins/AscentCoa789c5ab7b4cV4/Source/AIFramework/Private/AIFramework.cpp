@@ -12,12 +12,7 @@
 
 void FAIFramework::StartupModule()
 {
-    UGameplayTagsManager::Get().AddNativeGameplayTag(ACF::AIWait);
-    UGameplayTagsManager::Get().AddNativeGameplayTag(ACF::AIPatrol);
-    UGameplayTagsManager::Get().AddNativeGameplayTag(ACF::AICombat);
-    UGameplayTagsManager::Get().AddNativeGameplayTag(ACF::AIReturnHome);
-    UGameplayTagsManager::Get().AddNativeGameplayTag(ACF::AIFollowLead);
-    UGameplayTagsManager::Get().AddNativeGameplayTag(ACF::AIFollowLead);
+    FACFAIStateTags::InitializeNativeTags();
 }
 
 void FAIFramework::ShutdownModule()
@@ -5,6 +5,7 @@
 #include "BehaviorTree/BehaviorTree.h"
 #include "GameFramework/Pawn.h"
 #include "AIController.h"
+#include "ACFAIRoutineSubsystem.h"
 #include "Components/ACFAIRoutineComponent.h"
 
 
@@ -17,7 +18,8 @@ UACFCheckRoutineBTService::UACFCheckRoutineBTService()
 
 /**
  * Called when the service becomes relevant on this BT branch.
- * Resolves and caches the UACFAIRoutineComponent for later ticks.
+ * Resolves and caches the UACFAIRoutineComponent for later ticks and
+ * registers it to the routine scheduler if enabled, in which case the service stops ticking.
  *
  * @param OwnerComp	Behavior tree component owning this service instance.
  * @param NodeMemory	Pointer to this node's memory block (unused here).
@@ -26,12 +28,22 @@ void UACFCheckRoutineBTService::OnBecomeRelevant(UBehaviorTreeComponent& OwnerCo
 {
 	Super::OnBecomeRelevant(OwnerComp, NodeMemory);
 	ResolveRoutineComponent(OwnerComp);
+
+	if (RegisterToScheduler(OwnerComp))
+	{
+		// the scheduler wakes the routine on its task boundaries, nothing is left to poll
+		SetNextTickTime(NodeMemory, FLT_MAX);
+	}
+	else
+	{
+		ScheduleNextTick(OwnerComp, NodeMemory);
+	}
 }
 
 /**
  * Called when the service ceases to be relevant on this BT branch.
- * Stops all currently active routine tasks to ensure a clean exit
- * when the branch is no longer running.
+ * Unregisters the routine from the scheduler so it no longer advances
+ * while the branch is not running.
  *
  * @param OwnerComp	Behavior tree component owning this service instance.
  * @param NodeMemory	Pointer to this node's memory block (unused here).
@@ -40,6 +52,14 @@ void UACFCheckRoutineBTService::OnCeaseRelevant(UBehaviorTreeComponent& OwnerCom
 {
 	Super::OnCeaseRelevant(OwnerComp, NodeMemory);
 
+	if (RoutineComp)
+	{
+		if (UACFAIRoutineSubsystem* Scheduler = OwnerComp.GetWorld()->GetSubsystem<UACFAIRoutineSubsystem>())
+		{
+			Scheduler->UnregisterRoutine(RoutineComp);
+		}
+	}
+
 	// if (RoutineComp)
 	// {
 	// 	RoutineComp->StopAll();
@@ -88,5 +108,39 @@ void UACFCheckRoutineBTService::TickNode(UBehaviorTreeComponent& OwnerComp, uint
 	{
 		ResolveRoutineComponent(OwnerComp);
 	}
+	if (!RoutineComp)
+	{
+		return;
+	}
+
+	// the component was resolved after the branch became relevant, scheduling starts from now
+	if (RegisterToScheduler(OwnerComp))
+	{
+		SetNextTickTime(NodeMemory, FLT_MAX);
+		return;
+	}
 	RoutineComp->UpdateByTime();
+}
+
+/**
+ * Register the routine to the scheduler when bUseRoutineScheduler is enabled.
+ * Registering an already scheduled routine does nothing.
+ *
+ * @param OwnerComp	Behavior tree component used to access the world.
+ * @return true if the routine is scheduled and the service must not poll it.
+ */
+bool UACFCheckRoutineBTService::RegisterToScheduler(UBehaviorTreeComponent& OwnerComp)
+{
+	if (!bUseRoutineScheduler || !RoutineComp)
+	{
+		return false;
+	}
+
+	UACFAIRoutineSubsystem* Scheduler = OwnerComp.GetWorld()->GetSubsystem<UACFAIRoutineSubsystem>();
+	if (!Scheduler)
+	{
+		return false;
+	}
+	Scheduler->RegisterRoutine(RoutineComp);
+	return Scheduler->IsRoutineRegistered(RoutineComp);
 }
\ No newline at end of file
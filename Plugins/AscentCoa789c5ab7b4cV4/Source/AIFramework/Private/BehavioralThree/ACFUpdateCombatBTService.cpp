@@ -2,6 +2,7 @@
 
 #include "BehavioralThree/ACFUpdateCombatBTService.h"
 #include "ACFAIController.h"
+#include "ACFAIUpdateSubsystem.h"
 #include "Components/ACFCombatBehaviourComponent.h"
 #include "Components/ACFThreatManagerComponent.h"
 #include "Game/ACFFunctionLibrary.h"
@@ -70,14 +71,21 @@ void UACFUpdateCombatBTService::EvaluateAndUpdateCombat(UBehaviorTreeComponent&
 void UACFUpdateCombatBTService::UpdateCombat()
 {
     float distanceToTarget;
-    ACharacter* targetChar = Cast<ACharacter>(targetActor);
-    if (targetChar) {
-        distanceToTarget = UACFFunctionLibrary::CalculateDistanceBetweenCharactersExtents(CharOwner, targetChar);
+    FACFAIAgentDistances batchedDistances;
+    const UACFAIUpdateSubsystem* updateSubsystem = aiController->GetUpdateSubsystem();
+    if (updateSubsystem && updateSubsystem->GetAgentDistances(aiController, batchedDistances) && batchedDistances.Target == targetActor) {
+        // already measured and written to the blackboard by the batched update
+        distanceToTarget = batchedDistances.TargetDistance;
     } else {
-        distanceToTarget = CharOwner->GetDistanceTo(targetActor);
-    }
+        ACharacter* targetChar = Cast<ACharacter>(targetActor);
+        if (targetChar) {
+            distanceToTarget = UACFFunctionLibrary::CalculateDistanceBetweenCharactersExtents(CharOwner, targetChar);
+        } else {
+            distanceToTarget = CharOwner->GetDistanceTo(targetActor);
+        }
 
-    aiController->SetTargetActorDistanceBK(distanceToTarget);
+        aiController->SetTargetActorDistanceBK(distanceToTarget);
+    }
 
     if (distanceToTarget > aiController->GetLoseTargetDistance()) {
         aiController->SetTarget(nullptr);
@@ -2,11 +2,11 @@
 
 #include "BehavioralThree/ACFUpdateStateBTService.h"
 #include "ACFAIController.h"
+#include "ACFAIUpdateSubsystem.h"
 #include "Components/ACFCommandsManagerComponent.h"
 #include <BehaviorTree/BehaviorTreeComponent.h>
 #include "Game/ACFFunctionLibrary.h"
 #include <Logging.h>
-#include <GameplayTagsManager.h>
 
 void UACFUpdateStateBTService::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
 {
@@ -24,32 +24,46 @@ void UACFUpdateStateBTService::TickNode(UBehaviorTreeComponent& OwnerComp, uint8
         return;
     }
 
+    FACFAIAgentDistances batchedDistances;
+    const UACFAIUpdateSubsystem* updateSubsystem = aiController->GetUpdateSubsystem();
+    const bool bHasBatchedDistances = updateSubsystem && updateSubsystem->GetAgentDistances(aiController, batchedDistances);
+
     if (aiController->IsPartOfGroup()) {
         UACFGroupAIComponent* group = aiController->GetGroup();
         const AActor* lead = aiController->GetLeadActorBK();
         if (lead) {
-            const float distanceFromLeader = (CharOwner->GetActorLocation() - lead->GetActorLocation()).Size();
-            aiController->SetLeadActorDistanceBK(distanceFromLeader);
+            float distanceFromLeader;
+            if (bHasBatchedDistances && batchedDistances.Lead == lead) {
+                distanceFromLeader = batchedDistances.LeadDistance;
+            } else {
+                distanceFromLeader = (CharOwner->GetActorLocation() - lead->GetActorLocation()).Size();
+                aiController->SetLeadActorDistanceBK(distanceFromLeader);
+            }
 
             if (aiController->ShouldTeleportNearLead() && distanceFromLeader >= aiController->GetTeleportLeadDistanceTrigger()) {
                 aiController->TeleportNearLead();
                 aiController->SetTarget(nullptr);
                 return;
             } else if (distanceFromLeader > aiController->GetMaxDistanceFromHome() && 
-                aiController->GetDefaultAIState() == UGameplayTagsManager::Get().RequestGameplayTag(ACF::AIFollowLead)) {
-                aiController->SetCurrentAIState(UGameplayTagsManager::Get().RequestGameplayTag(ACF::AIFollowLead));
+                aiController->GetDefaultAIState() == FACFAIStateTags::Get().FollowLead) {
+                aiController->SetCurrentAIState(FACFAIStateTags::Get().FollowLead);
                 return;
             }
         } else {
             aiController->TryUpdateLeadRef();
         }
     } else {
-        if (aiController->ShouldReturnHome() && aiController->GetAIState() !=  UGameplayTagsManager::Get().RequestGameplayTag(ACF::AIReturnHome)) {
-            const float distanceFromHome = (CharOwner->GetActorLocation() - aiController->GetHomeLocation()).Size();
-            aiController->SetHomeDistanceBK(distanceFromHome);
+        if (aiController->ShouldReturnHome() && aiController->GetAIState() !=  FACFAIStateTags::Get().ReturnHome) {
+            float distanceFromHome;
+            if (bHasBatchedDistances) {
+                distanceFromHome = batchedDistances.HomeDistance;
+            } else {
+                distanceFromHome = (CharOwner->GetActorLocation() - aiController->GetHomeLocation()).Size();
+                aiController->SetHomeDistanceBK(distanceFromHome);
+            }
             if (distanceFromHome > aiController->GetMaxDistanceFromHome()) {
                 aiController->SetTarget(nullptr);
-                aiController->SetCurrentAIState(UGameplayTagsManager::Get().RequestGameplayTag(ACF::AIReturnHome));
+                aiController->SetCurrentAIState(FACFAIStateTags::Get().ReturnHome);
                 return;
             }
         }
@@ -1,8 +1,10 @@
 // Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2025. All Rights Reserved.
 
 #include "Components/ACFAIRoutineComponent.h"
+#include "ACFAIRoutineSubsystem.h"
 #include "DaySequenceActor.h"
 #include "DaySequenceSubsystem.h"
+#include <Algo/BinarySearch.h>
 #include <Engine/World.h>
 
 DEFINE_LOG_CATEGORY_STATIC(LogACFRoutine, Log, All);
@@ -28,6 +30,19 @@ void UACFAIRoutineComponent::BeginPlay()
 	BuildSchedule();
 }
 
+void UACFAIRoutineComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UACFAIRoutineSubsystem* Scheduler = World->GetSubsystem<UACFAIRoutineSubsystem>())
+		{
+			Scheduler->UnregisterRoutine(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UACFAIRoutineComponent::BuildSchedule()
 {
 	if (!RoutineDataAsset)
@@ -48,11 +63,18 @@ int32 UACFAIRoutineComponent::ToMinutes(float Hours)
 void UACFAIRoutineComponent::RebuildTaskCache()
 {
 	SortedDailyTasks.Reset();
+	SortedTaskMinutes.Reset();
+	EntryIndices.Reset();
 	
 	if (!RoutineDataAsset || RoutineDataAsset->DailyTasks.Num() == 0)
 	{
 		return;
 	}
+
+	for (int32 EntryIndex = 0; EntryIndex < RoutineDataAsset->DailyTasks.Num(); EntryIndex++)
+	{
+		EntryIndices.FindOrAdd(RoutineDataAsset->DailyTasks[EntryIndex].EntryGuid, EntryIndex);
+	}
 	
 	// Copy and sort tasks by time (ascending)
 	SortedDailyTasks = RoutineDataAsset->DailyTasks;
@@ -60,32 +82,45 @@ void UACFAIRoutineComponent::RebuildTaskCache()
 	{
 		return MinutesFromFRoutineTime(A.TaskTime) < MinutesFromFRoutineTime(B.TaskTime);
 	});
-	
+	RebuildTaskMinutes();
+}
+
+void UACFAIRoutineComponent::RebuildTaskMinutes()
+{
+	SortedTaskMinutes.Reset(SortedDailyTasks.Num());
+	for (const FAIRoutineTask& Task : SortedDailyTasks)
+	{
+		SortedTaskMinutes.Add(MinutesFromFRoutineTime(Task.TaskTime));
+	}
+}
+
+void UACFAIRoutineComponent::RefreshScheduler()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UACFAIRoutineSubsystem* Scheduler = World->GetSubsystem<UACFAIRoutineSubsystem>())
+		{
+			Scheduler->RefreshRoutine(this);
+		}
+	}
 }
 
 
 bool UACFAIRoutineComponent::UpdateByTime()
 {
 	const float CurrentHours = GetTimeHours();
+	return UpdateByMinutes(ToMinutes(CurrentHours));
+}
+
+bool UACFAIRoutineComponent::UpdateByMinutes(int32 NowMinutes)
+{
 	if (SortedDailyTasks.Num() == 0)
 	{
 		return false;
 	}
-	
-	const int32 NowMinutes = ToMinutes(CurrentHours);
-	
-	// Find the latest eligible task using reverse iteration on sorted array
-	int32 BestIndex = INDEX_NONE;
-	
-	for (int32 i = SortedDailyTasks.Num() - 1; i >= 0; --i)
-	{
-		const int32 TaskMinute = MinutesFromFRoutineTime(SortedDailyTasks[i].TaskTime);
-		if (TaskMinute <= NowMinutes)
-		{
-			BestIndex = i;
-			break; // Found! It's the most recent eligible (array is sorted)
-		}
-	}
+
+	// The latest eligible task is the one before the first task starting after now (array is sorted)
+	int32 BestIndex = Algo::UpperBound(SortedTaskMinutes, NowMinutes) - 1;
 	
 	// If no eligible task found (before first task), wrap to last task (cyclic behavior)
 	if (BestIndex == INDEX_NONE)
@@ -110,6 +145,17 @@ bool UACFAIRoutineComponent::UpdateByTime()
 	return true;
 }
 
+int32 UACFAIRoutineComponent::GetNextTaskMinute(int32 NowMinutes) const
+{
+	if (SortedTaskMinutes.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 NextIndex = Algo::UpperBound(SortedTaskMinutes, NowMinutes);
+	return SortedTaskMinutes.IsValidIndex(NextIndex) ? SortedTaskMinutes[NextIndex] : SortedTaskMinutes[0] + 1440;
+}
+
 
 void UACFAIRoutineComponent::StartByGuid(const FGuid& EntryGuid)
 {
@@ -129,19 +175,14 @@ void UACFAIRoutineComponent::StartByGuid(const FGuid& EntryGuid)
 		return;
 	}
 
-	for (FAIRoutineTask& Task : RoutineDataAsset->DailyTasks)
-	{
-		if (Task.EntryGuid == EntryGuid)
-		{
-			if (!Task.RoutineTask) return;
-			Task.RoutineTask->Internal_OnTaskStarted(ControlledPawn);
-			OnRoutineTaskStart.Broadcast(Task.RoutineTask);
-			ActiveTasks.Add(Task.RoutineTask);
-			LastStartedTask = Task.RoutineTask;
+	FAIRoutineTask& Task = RoutineDataAsset->DailyTasks[EntryIndex];
+	if (!Task.RoutineTask) return;
+	Task.RoutineTask->Internal_OnTaskStarted(ControlledPawn);
+	OnRoutineTaskStart.Broadcast(Task.RoutineTask);
+	ActiveTasks.Add(Task.RoutineTask);
+	LastStartedTask = Task.RoutineTask;
 
-			CurrentEntryGuid = EntryGuid;
-		}
-	}
+	CurrentEntryGuid = EntryGuid;
 }
 
 
@@ -149,10 +190,17 @@ int32 UACFAIRoutineComponent::FindEntryIndexByGuid(const FGuid& EntryGuid) const
 {
 	if (!RoutineDataAsset) return INDEX_NONE;
 	const TArray<FAIRoutineTask>& Entries = RoutineDataAsset->DailyTasks;
-	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); EntryIndex++)
+	const int32* EntryIndex = EntryIndices.Find(EntryGuid);
+	if (EntryIndex && Entries.IsValidIndex(*EntryIndex) && Entries[*EntryIndex].EntryGuid == EntryGuid)
+	{
+		return *EntryIndex;
+	}
+
+	// The data asset was edited after the cache was built, the entry may be missing or moved
+	for (int32 Index = 0; Index < Entries.Num(); Index++)
 	{
-		if (Entries[EntryIndex].EntryGuid == EntryGuid)
-			return EntryIndex;
+		if (Entries[Index].EntryGuid == EntryGuid)
+			return Index;
 	}
 	return INDEX_NONE;
 }
@@ -176,6 +224,8 @@ FGuid UACFAIRoutineComponent::AddTask(const FAIRoutineTask& Task)
 	}
 	
 	SortedDailyTasks.Insert(Task, InsertIndex);
+	SortedTaskMinutes.Insert(TaskMinute, InsertIndex);
+	RefreshScheduler();
 	return Task.EntryGuid;
 }
 
@@ -196,7 +246,9 @@ bool UACFAIRoutineComponent::RemoveTask(const FGuid& TaskGuid)
 		{
 			CurrentActiveGuid.Invalidate();
 		}
-		
+
+		RebuildTaskMinutes();
+		RefreshScheduler();
 		return true;
 	}
 	
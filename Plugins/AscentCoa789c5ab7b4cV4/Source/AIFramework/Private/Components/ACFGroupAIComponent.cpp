@@ -8,6 +8,8 @@
 #include "Game/ACFFunctionLibrary.h"
 #include "Game/ACFPlayerController.h"
 #include "Game/ACFTypes.h"
+#include "Groups/ACFAIProximitySubsystem.h"
+#include "Groups/ACFAISpawnQueueSubsystem.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Net/UnrealNetwork.h"
 #include <Engine/AssetManager.h>
@@ -56,16 +58,26 @@ void UACFGroupAIComponent::SetReferences()
 
 void UACFGroupAIComponent::OnComponentLoaded_Implementation()
 {
+	UACFAIProximitySubsystem* proximitySubsystem = GetProximitySubsystem();
+	UACFAISpawnQueueSubsystem* spawnQueue = bUseSpawnQueue ? GetSpawnQueueSubsystem() : nullptr;
 	for (int32 index = 0; index < AICharactersInfo.Num(); index++) {
 		FAIAgentsInfo& agent = AICharactersInfo[index];
-		TArray<AActor*> foundActors;
-		UGameplayStatics::GetAllActorsOfClassWithTag(this, agent.characterClass, agent.Guid, foundActors);
-		if (foundActors.Num() == 0) {
+		if (proximitySubsystem) {
+			agent.AICharacter = proximitySubsystem->FindAgentByGuid(agent.Guid, agent.characterClass);
+		} else {
+			TArray<AActor*> foundActors;
+			UGameplayStatics::GetAllActorsOfClassWithTag(this, agent.characterClass, agent.Guid, foundActors);
+			agent.AICharacter = foundActors.Num() > 0 ? Cast<AACFCharacter>(foundActors[0]) : nullptr;
+		}
+		if (!agent.AICharacter) {
 			UE_LOG(ACFAILog, Error, TEXT("Impossible to find actor"));
 			continue;
 		}
-		agent.AICharacter = Cast<AACFCharacter>(foundActors[0]);
-		InitAgent(agent, index);
+		if (spawnQueue) {
+			spawnQueue->EnqueueInit(this, index, agent.AICharacter->GetActorLocation());
+		} else {
+			InitAgent(agent, index);
+		}
 	}
 }
 
@@ -80,7 +92,7 @@ void UACFGroupAIComponent::SpawnGroup_Implementation()
 		return;
 	}
 
-	if (AICharactersInfo.Num() > 0) {
+	if (AICharactersInfo.Num() > 0 || PendingQueuedSpawns > 0) {
 		// Already spawned!
 		return;
 	}
@@ -96,6 +108,11 @@ void UACFGroupAIComponent::Internal_SpawnGroup()
 		return;
 	}
 
+	if (bUseSpawnQueue && GetSpawnQueueSubsystem()) {
+		EnqueueGroupSpawn();
+		return;
+	}
+
 	TArray<FSoftObjectPath> AssetsToLoad;
 	for (const FAISpawnInfo& info : AIToSpawn) {
 		if (info.AIClassBP.ToSoftObjectPath().IsValid()) {
@@ -131,8 +148,57 @@ void UACFGroupAIComponent::OnAIAssetsLoaded()
 	OnAgentsSpawned.Broadcast();
 }
 
+void UACFGroupAIComponent::EnqueueGroupSpawn()
+{
+	UACFAISpawnQueueSubsystem* spawnQueue = GetSpawnQueueSubsystem();
+	if (!groupLead) {
+		SetReferences();
+	}
+
+	// every agent of the group shares the same priority so that they keep their AIToSpawn order
+	const FVector groupLocation = groupLead ? groupLead->GetActorLocation() : GetComponentLocation();
+	for (int32 index = 0; index < AIToSpawn.Num(); index++) {
+		spawnQueue->EnqueueSpawn(this, index, AIToSpawn[index], groupLocation);
+		PendingQueuedSpawns++;
+	}
+}
+
+void UACFGroupAIComponent::SpawnQueuedAgent(int32 spawnIndex, UClass* loadedClass)
+{
+	if (AIToSpawn.IsValidIndex(spawnIndex) && loadedClass) {
+		const UACFAISpawnQueueSubsystem* spawnQueue = GetSpawnQueueSubsystem();
+		AddAgentToGroup(AIToSpawn[spawnIndex], spawnQueue && spawnQueue->ShouldDeferStartingItems());
+	} else {
+		UE_LOG(ACFAILog, Warning, TEXT("Failed to load class for spawn info!"));
+	}
+	OnQueuedRequestCompleted();
+}
+
+void UACFGroupAIComponent::InitQueuedAgent(int32 agentIndex)
+{
+	if (AICharactersInfo.IsValidIndex(agentIndex) && AICharactersInfo[agentIndex].AICharacter) {
+		InitAgent(AICharactersInfo[agentIndex], agentIndex);
+	}
+}
+
+void UACFGroupAIComponent::OnQueuedRequestCompleted()
+{
+	PendingQueuedSpawns--;
+	if (PendingQueuedSpawns <= 0) {
+		PendingQueuedSpawns = 0;
+		OnAgentsSpawned.Broadcast();
+	}
+}
+
 void UACFGroupAIComponent::DespawnGroup_Implementation(const bool bUpdateAIToSpawn /*= true*/, FGameplayTag actionToTriggerOnDyingAgent, float lifespawn /*= 1.f*/)
 {
+	if (PendingQueuedSpawns > 0) {
+		if (UACFAISpawnQueueSubsystem* spawnQueue = GetSpawnQueueSubsystem()) {
+			spawnQueue->CancelGroupRequests(this);
+		}
+		PendingQueuedSpawns = 0;
+	}
+
 	if (bAlreadySpawned) {
 		if (bUpdateAIToSpawn) {
 			//  TArray<FAISpawnInfo> aicopy = AIToSpawn;
@@ -144,7 +210,11 @@ void UACFGroupAIComponent::DespawnGroup_Implementation(const bool bUpdateAIToSpa
 				}
 			}
 		}
+		UACFAIProximitySubsystem* proximitySubsystem = GetProximitySubsystem();
 		for (FAIAgentsInfo& agent : AICharactersInfo) {
+			if (proximitySubsystem) {
+				proximitySubsystem->UnregisterAgent(agent.AICharacter);
+			}
 			if (agent.AICharacter && agent.AICharacter->IsAlive()) {
 				agent.AICharacter->DestroyCharacter(lifespawn);
 				agent.AICharacter->TriggerAction(actionToTriggerOnDyingAgent, EActionPriority::EHigh);
@@ -242,6 +312,11 @@ void UACFGroupAIComponent::InitAgent(FAIAgentsInfo& agent, int32 childIndex)
 		if (!agent.AICharacter->OnDeath.IsAlreadyBound(this, &UACFGroupAIComponent::HandleAgentDeath)) {
 			agent.AICharacter->OnDeath.AddDynamic(this, &UACFGroupAIComponent::HandleAgentDeath);
 		}
+
+		if (UACFAIProximitySubsystem* proximitySubsystem = GetProximitySubsystem()) {
+			proximitySubsystem->RegisterAgent(agent.AICharacter, this);
+			proximitySubsystem->RegisterAgentGuid(newGuid, agent.AICharacter);
+		}
 	}
 }
 
@@ -336,6 +411,14 @@ void UACFGroupAIComponent::HandleAgentDeath(class AACFCharacter* agent)
 
 FVector UACFGroupAIComponent::GetGroupCentroid() const
 {
+	// the proximity subsystem keeps a running sum of the agent locations
+	FVector centroid;
+	if (const UACFAIProximitySubsystem* proximitySubsystem = GetProximitySubsystem()) {
+		if (proximitySubsystem->GetGroupCentroid(this, centroid)) {
+			return centroid;
+		}
+	}
+
 	TArray<AActor*> actors;
 	for (const auto& agent : AICharactersInfo) {
 		if (agent.AICharacter) {
@@ -358,10 +441,11 @@ class AACFCharacter* UACFGroupAIComponent::RequestNewTarget(const AACFAIControll
 
 	// Then Try to help other in  the group
 	if (AICharactersInfo.IsValidIndex(0) && IsValid(AICharactersInfo[0].AICharacter) && IsValid(AICharactersInfo[0].GetController())) {
-		for (FAIAgentsInfo achar : AICharactersInfo) {
-			if (achar.GetController() && achar.GetController() != requestSender) {
-				AACFCharacter* newTarget = Cast<AACFCharacter>(achar.GetController()->GetTargetActorBK());
-				if (newTarget && newTarget->IsAlive() && achar.GetController()->IsInBattle()) {
+		for (const FAIAgentsInfo& achar : AICharactersInfo) {
+			const AACFAIController* agentController = achar.GetController();
+			if (agentController && agentController != requestSender) {
+				AACFCharacter* newTarget = Cast<AACFCharacter>(agentController->GetTargetActorBK());
+				if (newTarget && newTarget->IsAlive() && agentController->IsInBattle()) {
 					return newTarget;
 				}
 			}
@@ -373,9 +457,33 @@ class AACFCharacter* UACFGroupAIComponent::RequestNewTarget(const AACFAIControll
 		return enemyGroup->GetAgentNearestTo(requestSender->GetPawn()->GetActorLocation());
 	}
 
+	// Finally look for any hostile agent around
+	if (NearbyTargetSearchRadius > 0.f && requestSender->GetPawn()) {
+		if (const UACFAIProximitySubsystem* proximitySubsystem = GetProximitySubsystem()) {
+			FACFProximityQuery query;
+			query.Radius = NearbyTargetSearchRadius;
+			query.Team = GetCombatTeam();
+			query.TeamFilter = EACFProximityTeamFilter::EHostileTeam;
+			query.IgnoredActor = requestSender->GetPawn();
+			return proximitySubsystem->FindNearestAgent(requestSender->GetPawn()->GetActorLocation(), query);
+		}
+	}
+
 	return nullptr;
 }
 
+UACFAISpawnQueueSubsystem* UACFGroupAIComponent::GetSpawnQueueSubsystem() const
+{
+	const UWorld* world = GetWorld();
+	return world ? world->GetSubsystem<UACFAISpawnQueueSubsystem>() : nullptr;
+}
+
+UACFAIProximitySubsystem* UACFGroupAIComponent::GetProximitySubsystem() const
+{
+	const UWorld* world = GetWorld();
+	return world ? world->GetSubsystem<UACFAIProximitySubsystem>() : nullptr;
+}
+
 FPrimitiveSceneProxy* UACFGroupAIComponent::CreateSceneProxy()
 {
 	class FSpawnPreviewSceneProxy final : public FPrimitiveSceneProxy {
@@ -477,7 +585,7 @@ void UACFGroupAIComponent::PostEditComponentMove(bool bFinished)
 }
 #endif
 
-uint8 UACFGroupAIComponent::AddAgentToGroup(const FAISpawnInfo& spawnInfo)
+uint8 UACFGroupAIComponent::AddAgentToGroup(const FAISpawnInfo& spawnInfo, bool bDeferStartingItems /*= false*/)
 {
 	UWorld* const world = GetWorld();
 
@@ -529,8 +637,19 @@ uint8 UACFGroupAIComponent::AddAgentToGroup(const FAISpawnInfo& spawnInfo)
 
 	if (newCharacterInfo.AICharacter) {
 
+		if (bDeferStartingItems) {
+			newCharacterInfo.AICharacter->SetDeferStartingItems(true);
+		}
 		UGameplayStatics::FinishSpawningActor(newCharacterInfo.AICharacter, spawnTransform);
 
+		if (newCharacterInfo.AICharacter->HasPendingStartingItems()) {
+			if (UACFAISpawnQueueSubsystem* spawnQueue = GetSpawnQueueSubsystem()) {
+				spawnQueue->DeferStartingItems(newCharacterInfo.AICharacter);
+			} else {
+				newCharacterInfo.AICharacter->InitializeDeferredStartingItems();
+			}
+		}
+
 		// End Spawn
 		if (!newCharacterInfo.AICharacter->GetController()) {
 			newCharacterInfo.AICharacter->SpawnDefaultController();
@@ -606,11 +725,12 @@ void UACFGroupAIComponent::ReInitAgent(AACFCharacter* character)
 
 AACFCharacter* UACFGroupAIComponent::GetAgentNearestTo(const FVector& location) const
 {
+	// groups are small, a linear scan on squared distances beats a grid query filtered by group
 	AACFCharacter* bestAgent = nullptr;
-	float minDistance = 999999.f;
-	for (FAIAgentsInfo achar : AICharactersInfo) {
+	float minDistance = FMath::Square(999999.f);
+	for (const FAIAgentsInfo& achar : AICharactersInfo) {
 		if (achar.AICharacter && achar.AICharacter->IsAlive()) {
-			const float distance = FVector::Distance(location, achar.AICharacter->GetActorLocation());
+			const float distance = FVector::DistSquared(location, achar.AICharacter->GetActorLocation());
 			if (distance <= minDistance) {
 				minDistance = distance;
 				bestAgent = achar.AICharacter;
@@ -645,6 +765,9 @@ bool UACFGroupAIComponent::RemoveAgentFromGroup(AACFCharacter* character)
 
 	if (AICharactersInfo.Contains(agentInfo)) {
 		AICharactersInfo.RemoveSingle(agentInfo);
+		if (UACFAIProximitySubsystem* proximitySubsystem = GetProximitySubsystem()) {
+			proximitySubsystem->UnregisterAgent(character);
+		}
 		contr->ResetToDefaultState();
 		contr->SetLeadActorBK(nullptr);
 		contr->SetGroupOwner(nullptr, 0, false, false);
@@ -720,6 +843,9 @@ void UACFGroupAIComponent::OnChildDeath(const AACFCharacter* character)
 	if (AICharactersInfo.IsValidIndex(index)) {
 		AICharactersInfo.RemoveAt(index);
 	}
+	if (UACFAIProximitySubsystem* proximitySubsystem = GetProximitySubsystem()) {
+		proximitySubsystem->UnregisterAgent(character);
+	}
 	OnAgentDeath.Broadcast(character);
 	if (AICharactersInfo.Num() == 0) {
 		OnAllAgentDeath.Broadcast();
@@ -51,10 +51,11 @@ void UACFThreatManagerComponent::AddThreat(AActor* threatening, float threat)
     }
 
     if (IACFEntityInterface::Execute_IsEntityAlive(threatening)) {
-        if (ThreatMap.Contains(threatening)) {
-            threat += ThreatMap.FindAndRemoveChecked(threatening) * GetThreatMultForActor(threatening);
+        const int32* index = HeapIndices.Find(threatening);
+        if (index) {
+            threat += ThreatHeap[*index].Threat * GetThreatMultForActor(threatening);
         }
-        const float threatMult = ThreatMap.Add(threatening, threat);
+        SetThreat(threatening, threat);
         UpdateMaxThreat();
     } else {
         RemoveThreatening(threatening);
@@ -73,12 +74,16 @@ void UACFThreatManagerComponent::RemoveThreat(class AActor* threatening, float t
     }
 
     if (IACFEntityInterface::Execute_IsEntityAlive(threatening)) {
-        if (ThreatMap.Contains(threatening)) {
-            threat -= ThreatMap.FindAndRemoveChecked(threatening);
+        const int32* index = HeapIndices.Find(threatening);
+        if (index) {
+            threat -= ThreatHeap[*index].Threat;
 
             if (threat >= 0) {
-                ThreatMap.Add(threatening, threat);
+                SetThreat(threatening, threat);
                 UpdateMaxThreat();
+            } else {
+                UnbindThreateningEvents(threatening);
+                RemoveHeapAt(*index);
             }
         }
     } else {
@@ -88,26 +93,19 @@ void UACFThreatManagerComponent::RemoveThreat(class AActor* threatening, float t
 
 class AActor* UACFThreatManagerComponent::GetActorWithHigherThreat()
 {
-    float maxThreat = -1.f;
-    AActor* target = nullptr;
-    TArray<AActor*> pendingDelete;
-
-    for (const auto& elem : ThreatMap) {
-        IACFEntityInterface* entity = Cast<IACFEntityInterface>(elem.Key);
-
-        if (!entity || !elem.Key || !IACFEntityInterface::Execute_IsEntityAlive(elem.Key)) {
-            pendingDelete.Add(elem.Key);
-        } else if (elem.Value > maxThreat) {
-            maxThreat = elem.Value;
-            target = elem.Key;
+    // dead actors are removed by their death event, only the top needs to be checked
+    while (ThreatHeap.Num() > 0) {
+        AActor* top = ThreatHeap[0].Actor;
+        if (IsValid(top) && Cast<IACFEntityInterface>(top) && IACFEntityInterface::Execute_IsEntityAlive(top)) {
+            return top;
+        }
+        RemoveThreatening(top);
+        if (ThreatHeap.Num() > 0 && ThreatHeap[0].Actor == top) {
+            // stale actor not found in the index
+            RemoveHeapAt(0);
         }
     }
-
-    for (auto* toDelete : pendingDelete) {
-        RemoveThreatening(toDelete);
-    }
-
-    return target;
+    return nullptr;
 }
 
 bool UACFThreatManagerComponent::IsActorAPotentialThreat(class AActor* threatening) const
@@ -136,7 +134,7 @@ bool UACFThreatManagerComponent::IsActorAPotentialThreat(class AActor* threateni
 
 bool UACFThreatManagerComponent::IsThreatening(class AActor* threatening) const
 {
-    return ThreatMap.Contains(threatening);
+    return HeapIndices.Contains(threatening);
 }
 
 float UACFThreatManagerComponent::GetThreatMultForActor(class AActor* threatening) const
@@ -174,10 +172,28 @@ float UACFThreatManagerComponent::GetDefaultThreatForActor(AActor* threatening)
     return 0.f;
 }
 
+float UACFThreatManagerComponent::GetThreatForActor(const AActor* threatening) const
+{
+    const int32* index = HeapIndices.Find(threatening);
+    return index ? ThreatHeap[*index].Threat : -1.f;
+}
+
+void UACFThreatManagerComponent::SetThreatMultiplierForClass(TSubclassOf<AActor> actorClass, float threatMult)
+{
+    ThreatMultipliersByActor.Add(actorClass, threatMult);
+}
+
+void UACFThreatManagerComponent::SetDefaultThreatForClass(TSubclassOf<AActor> actorClass, float defaultThreat)
+{
+    DefaultThreatMap.Add(actorClass, defaultThreat);
+}
+
 void UACFThreatManagerComponent::RemoveThreatening(AActor* threatening)
 {
-    if (ThreatMap.Contains(threatening)) {
-        ThreatMap.FindAndRemoveChecked(threatening);
+    const int32* index = HeapIndices.Find(threatening);
+    if (index) {
+        UnbindThreateningEvents(threatening);
+        RemoveHeapAt(*index);
     }
 
     if (maxThreatening == threatening) {
@@ -188,6 +204,122 @@ void UACFThreatManagerComponent::RemoveThreatening(AActor* threatening)
 
 void UACFThreatManagerComponent::RemoveAllThreatenings()
 {
-    ThreatMap.Empty();
+    for (const FACFThreatEntry& entry : ThreatHeap) {
+        UnbindThreateningEvents(entry.Actor);
+    }
+    ThreatHeap.Empty();
+    HeapIndices.Empty();
     OnNewMaxThreateningActor.Broadcast(nullptr);
 }
+
+void UACFThreatManagerComponent::SetThreat(AActor* threatening, float threat)
+{
+    const int32* index = HeapIndices.Find(threatening);
+    if (index) {
+        const int32 currentIndex = *index;
+        const float previousThreat = ThreatHeap[currentIndex].Threat;
+        ThreatHeap[currentIndex].Threat = threat;
+        if (threat > previousThreat) {
+            SiftUp(currentIndex);
+        } else {
+            SiftDown(currentIndex);
+        }
+        return;
+    }
+
+    FACFThreatEntry& entry = ThreatHeap.AddDefaulted_GetRef();
+    entry.Actor = threatening;
+    entry.Threat = threat;
+    HeapIndices.Add(threatening, ThreatHeap.Num() - 1);
+    BindThreateningEvents(threatening);
+    SiftUp(ThreatHeap.Num() - 1);
+}
+
+void UACFThreatManagerComponent::RemoveHeapAt(int32 index)
+{
+    if (!ThreatHeap.IsValidIndex(index)) {
+        return;
+    }
+
+    HeapIndices.Remove(ThreatHeap[index].Actor);
+    const int32 lastIndex = ThreatHeap.Num() - 1;
+    if (index != lastIndex) {
+        ThreatHeap[index] = ThreatHeap[lastIndex];
+        HeapIndices.Add(ThreatHeap[index].Actor, index);
+    }
+    ThreatHeap.RemoveAt(lastIndex, EAllowShrinking::No);
+
+    if (index < ThreatHeap.Num()) {
+        SiftDown(index);
+        SiftUp(index);
+    }
+}
+
+void UACFThreatManagerComponent::SiftUp(int32 index)
+{
+    while (index > 0) {
+        const int32 parent = (index - 1) / 2;
+        if (ThreatHeap[parent].Threat >= ThreatHeap[index].Threat) {
+            return;
+        }
+        SwapEntries(parent, index);
+        index = parent;
+    }
+}
+
+void UACFThreatManagerComponent::SiftDown(int32 index)
+{
+    const int32 num = ThreatHeap.Num();
+    while (true) {
+        const int32 left = index * 2 + 1;
+        const int32 right = left + 1;
+        int32 largest = index;
+        if (left < num && ThreatHeap[left].Threat > ThreatHeap[largest].Threat) {
+            largest = left;
+        }
+        if (right < num && ThreatHeap[right].Threat > ThreatHeap[largest].Threat) {
+            largest = right;
+        }
+        if (largest == index) {
+            return;
+        }
+        SwapEntries(largest, index);
+        index = largest;
+    }
+}
+
+void UACFThreatManagerComponent::SwapEntries(int32 first, int32 second)
+{
+    ThreatHeap.Swap(first, second);
+    HeapIndices.Add(ThreatHeap[first].Actor, first);
+    HeapIndices.Add(ThreatHeap[second].Actor, second);
+}
+
+void UACFThreatManagerComponent::BindThreateningEvents(AActor* threatening)
+{
+    if (AACFCharacter* character = Cast<AACFCharacter>(threatening)) {
+        character->OnDeath.AddUniqueDynamic(this, &UACFThreatManagerComponent::HandleThreateningDeath);
+    }
+    threatening->OnDestroyed.AddUniqueDynamic(this, &UACFThreatManagerComponent::HandleThreateningDestroyed);
+}
+
+void UACFThreatManagerComponent::UnbindThreateningEvents(AActor* threatening)
+{
+    if (!IsValid(threatening)) {
+        return;
+    }
+    if (AACFCharacter* character = Cast<AACFCharacter>(threatening)) {
+        character->OnDeath.RemoveDynamic(this, &UACFThreatManagerComponent::HandleThreateningDeath);
+    }
+    threatening->OnDestroyed.RemoveDynamic(this, &UACFThreatManagerComponent::HandleThreateningDestroyed);
+}
+
+void UACFThreatManagerComponent::HandleThreateningDeath(AACFCharacter* deadCharacter)
+{
+    RemoveThreatening(deadCharacter);
+}
+
+void UACFThreatManagerComponent::HandleThreateningDestroyed(AActor* destroyedActor)
+{
+    RemoveThreatening(destroyedActor);
+}
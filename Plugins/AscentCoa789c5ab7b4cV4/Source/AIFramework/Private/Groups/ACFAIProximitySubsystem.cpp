@@ -0,0 +1,353 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "Groups/ACFAIProximitySubsystem.h"
+#include "ACFTeamManagerSubsystem.h"
+#include "Actors/ACFCharacter.h"
+#include "Components/ACFGroupAIComponent.h"
+#include <Engine/World.h>
+#include <EngineUtils.h>
+
+bool UACFAIProximitySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UACFAIProximitySubsystem::Deinitialize()
+{
+    Agents.Empty();
+    FreeAgentIndices.Empty();
+    AgentIndices.Empty();
+    Cells.Empty();
+    GroupCentroids.Empty();
+    GuidRegistry.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UACFAIProximitySubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UACFAIProximitySubsystem, STATGROUP_Tickables);
+}
+
+void UACFAIProximitySubsystem::Tick(float DeltaTime)
+{
+    TimeSinceUpdate += DeltaTime;
+    if (TimeSinceUpdate < UpdateInterval) {
+        return;
+    }
+    TimeSinceUpdate = 0.f;
+
+    for (int32 index = 0; index < Agents.Num(); index++) {
+        if (Agents[index].bInUse) {
+            RefreshAgent(index);
+        }
+    }
+}
+
+void UACFAIProximitySubsystem::RegisterAgent(AACFCharacter* agent, UACFGroupAIComponent* group)
+{
+    if (!agent) {
+        return;
+    }
+
+    if (const int32* foundIndex = AgentIndices.Find(agent)) {
+        FProximityAgent& existing = Agents[*foundIndex];
+        if (existing.Group == group) {
+            RefreshAgent(*foundIndex);
+            return;
+        }
+        RemoveAgentAt(*foundIndex);
+    }
+
+    const int32 newIndex = FreeAgentIndices.Num() > 0 ? FreeAgentIndices.Pop() : Agents.AddDefaulted();
+    FProximityAgent& newAgent = Agents[newIndex];
+    newAgent.Key = agent;
+    newAgent.Character = agent;
+    newAgent.Group = group;
+    newAgent.Team = agent->GetCombatTeam();
+    newAgent.Location = agent->GetActorLocation();
+    newAgent.Cell = GetCell(newAgent.Location);
+    newAgent.bAlive = agent->IsAlive();
+    newAgent.bInUse = true;
+
+    AgentIndices.Add(agent, newIndex);
+    AddToCell(newIndex);
+
+    if (group) {
+        FGroupCentroid& centroid = GroupCentroids.FindOrAdd(group);
+        centroid.LocationSum += newAgent.Location;
+        centroid.Count++;
+    }
+}
+
+void UACFAIProximitySubsystem::UnregisterAgent(const AACFCharacter* agent)
+{
+    if (const int32* foundIndex = AgentIndices.Find(agent)) {
+        RemoveAgentAt(*foundIndex);
+    }
+}
+
+void UACFAIProximitySubsystem::UpdateAgentLocation(AACFCharacter* agent)
+{
+    if (const int32* foundIndex = AgentIndices.Find(agent)) {
+        RefreshAgent(*foundIndex);
+    }
+}
+
+AACFCharacter* UACFAIProximitySubsystem::FindNearestAgent(const FVector& location, const FACFProximityQuery& query) const
+{
+    TArray<TPair<float, int32>> results;
+    GatherNearest(location, 1, query, results);
+    return results.Num() > 0 ? Agents[results[0].Value].Character.Get() : nullptr;
+}
+
+void UACFAIProximitySubsystem::FindNearestAgents(const FVector& location, int32 count, const FACFProximityQuery& query, TArray<AACFCharacter*>& outAgents) const
+{
+    outAgents.Reset();
+    if (count <= 0) {
+        return;
+    }
+
+    TArray<TPair<float, int32>> results;
+    GatherNearest(location, count, query, results);
+    outAgents.Reserve(results.Num());
+    for (const TPair<float, int32>& result : results) {
+        outAgents.Add(Agents[result.Value].Character.Get());
+    }
+}
+
+void UACFAIProximitySubsystem::GetAgentsWithinRadius(const FVector& location, const FACFProximityQuery& query, TArray<AACFCharacter*>& outAgents) const
+{
+    FindNearestAgents(location, MAX_int32, query, outAgents);
+}
+
+bool UACFAIProximitySubsystem::GetGroupCentroid(const UACFGroupAIComponent* group, FVector& outCentroid) const
+{
+    const FGroupCentroid* centroid = GroupCentroids.Find(group);
+    if (!centroid || centroid->Count <= 0) {
+        return false;
+    }
+
+    outCentroid = centroid->LocationSum / centroid->Count;
+    return true;
+}
+
+void UACFAIProximitySubsystem::RegisterAgentGuid(const FName& guid, AACFCharacter* agent)
+{
+    if (agent && guid != NAME_None) {
+        GuidRegistry.Add(guid, agent);
+    }
+}
+
+AACFCharacter* UACFAIProximitySubsystem::FindAgentByGuid(const FName& guid, TSubclassOf<AACFCharacter> characterClass)
+{
+    const auto findRegistered = [&]() -> AACFCharacter* {
+        if (const TWeakObjectPtr<AACFCharacter>* found = GuidRegistry.Find(guid)) {
+            AACFCharacter* agent = found->Get();
+            if (agent && (!characterClass || agent->IsA(characterClass))) {
+                return agent;
+            }
+        }
+        return nullptr;
+    };
+
+    if (AACFCharacter* agent = findRegistered()) {
+        return agent;
+    }
+
+    // loaded agents have not been registered yet, index the world once for the whole batch of lookups
+    if (LastGuidRegistryRebuildFrame != GFrameCounter) {
+        RebuildGuidRegistry();
+        return findRegistered();
+    }
+
+    return nullptr;
+}
+
+FIntPoint UACFAIProximitySubsystem::GetCell(const FVector& location) const
+{
+    const float size = FMath::Max(CellSize, 1.f);
+    return FIntPoint(FMath::FloorToInt(location.X / size), FMath::FloorToInt(location.Y / size));
+}
+
+void UACFAIProximitySubsystem::AddToCell(int32 agentIndex)
+{
+    const FIntPoint& cell = Agents[agentIndex].Cell;
+    if (Cells.Num() == 0) {
+        OccupiedCells = FIntRect(cell, cell);
+    } else {
+        OccupiedCells.Include(cell);
+    }
+    Cells.FindOrAdd(cell).Add(agentIndex);
+}
+
+void UACFAIProximitySubsystem::RemoveFromCell(int32 agentIndex)
+{
+    const FIntPoint& cell = Agents[agentIndex].Cell;
+    if (TArray<int32>* cellAgents = Cells.Find(cell)) {
+        cellAgents->RemoveSingleSwap(agentIndex);
+        if (cellAgents->Num() == 0) {
+            Cells.Remove(cell);
+        }
+    }
+}
+
+void UACFAIProximitySubsystem::RemoveAgentAt(int32 agentIndex)
+{
+    FProximityAgent& agent = Agents[agentIndex];
+    if (!agent.bInUse) {
+        return;
+    }
+
+    RemoveFromCell(agentIndex);
+
+    if (FGroupCentroid* centroid = GroupCentroids.Find(agent.Group)) {
+        centroid->LocationSum -= agent.Location;
+        centroid->Count--;
+        if (centroid->Count <= 0) {
+            GroupCentroids.Remove(agent.Group);
+        }
+    }
+
+    AgentIndices.Remove(agent.Key);
+    agent = FProximityAgent();
+    FreeAgentIndices.Add(agentIndex);
+}
+
+void UACFAIProximitySubsystem::RefreshAgent(int32 agentIndex)
+{
+    FProximityAgent& agent = Agents[agentIndex];
+    const AACFCharacter* character = agent.Character.Get();
+    if (!character) {
+        RemoveAgentAt(agentIndex);
+        return;
+    }
+
+    agent.bAlive = character->IsAlive();
+    agent.Team = character->GetCombatTeam();
+
+    const FVector newLocation = character->GetActorLocation();
+    if (newLocation.Equals(agent.Location)) {
+        return;
+    }
+
+    if (FGroupCentroid* centroid = GroupCentroids.Find(agent.Group)) {
+        centroid->LocationSum += newLocation - agent.Location;
+    }
+    agent.Location = newLocation;
+
+    const FIntPoint newCell = GetCell(newLocation);
+    if (newCell != agent.Cell) {
+        RemoveFromCell(agentIndex);
+        agent.Cell = newCell;
+        AddToCell(agentIndex);
+    }
+}
+
+bool UACFAIProximitySubsystem::PassesFilter(const FProximityAgent& agent, const FACFProximityQuery& query) const
+{
+    const AACFCharacter* character = agent.Character.Get();
+    if (!character || !agent.bAlive || character == query.IgnoredActor) {
+        return false;
+    }
+
+    if (query.Group && agent.Group.Get() != query.Group) {
+        return false;
+    }
+
+    switch (query.TeamFilter) {
+    case EACFProximityTeamFilter::ESameTeam:
+        return agent.Team == query.Team;
+    case EACFProximityTeamFilter::EHostileTeam:
+        if (const UACFTeamManagerSubsystem* teamSubsystem = GetWorld()->GetSubsystem<UACFTeamManagerSubsystem>()) {
+            return teamSubsystem->AreTeamsHostile(query.Team, agent.Team);
+        }
+        return agent.Team != query.Team;
+    default:
+        return true;
+    }
+}
+
+void UACFAIProximitySubsystem::GatherNearest(const FVector& location, int32 count, const FACFProximityQuery& query, TArray<TPair<float, int32>>& outResults) const
+{
+    outResults.Reset();
+    if (Cells.Num() == 0) {
+        return;
+    }
+
+    const float size = FMath::Max(CellSize, 1.f);
+    const FIntPoint center = GetCell(location);
+    const float radiusSq = query.Radius > 0.f ? FMath::Square(query.Radius) : MAX_flt;
+
+    // never search past the furthest occupied cell, or past the radius
+    int32 maxRing = FMath::Max(
+        FMath::Max(FMath::Abs(center.X - OccupiedCells.Min.X), FMath::Abs(center.X - OccupiedCells.Max.X)),
+        FMath::Max(FMath::Abs(center.Y - OccupiedCells.Min.Y), FMath::Abs(center.Y - OccupiedCells.Max.Y)));
+    if (query.Radius > 0.f) {
+        maxRing = FMath::Min(maxRing, FMath::CeilToInt(query.Radius / size));
+    }
+
+    const auto sortResults = [&outResults]() {
+        outResults.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key < B.Key; });
+    };
+
+    const auto visitCell = [&](int32 x, int32 y) {
+        if (x < OccupiedCells.Min.X || x > OccupiedCells.Max.X || y < OccupiedCells.Min.Y || y > OccupiedCells.Max.Y) {
+            return;
+        }
+
+        if (const TArray<int32>* cellAgents = Cells.Find(FIntPoint(x, y))) {
+            for (const int32 agentIndex : *cellAgents) {
+                const FProximityAgent& agent = Agents[agentIndex];
+                const float distSq = FVector::DistSquared(location, agent.Location);
+                if (distSq <= radiusSq && PassesFilter(agent, query)) {
+                    outResults.Emplace(distSq, agentIndex);
+                }
+            }
+        }
+    };
+
+    for (int32 ring = 0; ring <= maxRing; ring++) {
+        if (ring == 0) {
+            visitCell(center.X, center.Y);
+        } else {
+            for (int32 x = center.X - ring; x <= center.X + ring; x++) {
+                visitCell(x, center.Y - ring);
+                visitCell(x, center.Y + ring);
+            }
+            for (int32 y = center.Y - ring + 1; y <= center.Y + ring - 1; y++) {
+                visitCell(center.X - ring, y);
+                visitCell(center.X + ring, y);
+            }
+        }
+
+        // agents in the next ring are at least this far from the location
+        if (outResults.Num() >= count) {
+            sortResults();
+            const float nextRingDistSq = FMath::Square(ring * size);
+            if (outResults[count - 1].Key <= nextRingDistSq) {
+                outResults.SetNum(count);
+                return;
+            }
+        }
+    }
+
+    sortResults();
+    if (outResults.Num() > count) {
+        outResults.SetNum(count);
+    }
+}
+
+void UACFAIProximitySubsystem::RebuildGuidRegistry()
+{
+    LastGuidRegistryRebuildFrame = GFrameCounter;
+
+    for (TActorIterator<AACFCharacter> it(GetWorld()); it; ++it) {
+        AACFCharacter* character = *it;
+        for (const FName& tag : character->Tags) {
+            if (!GuidRegistry.Contains(tag) || !GuidRegistry[tag].IsValid()) {
+                GuidRegistry.Add(tag, character);
+            }
+        }
+    }
+}
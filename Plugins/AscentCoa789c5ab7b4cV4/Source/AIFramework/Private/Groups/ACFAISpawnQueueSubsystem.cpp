@@ -0,0 +1,214 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "Groups/ACFAISpawnQueueSubsystem.h"
+#include "Actors/ACFCharacter.h"
+#include "Components/ACFGroupAIComponent.h"
+#include <Engine/AssetManager.h>
+#include <Engine/StreamableManager.h>
+#include <Engine/World.h>
+#include <GameFramework/Pawn.h>
+#include <GameFramework/PlayerController.h>
+
+bool UACFAISpawnQueueSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UACFAISpawnQueueSubsystem::Deinitialize()
+{
+    for (const FSpawnRequest& request : Requests) {
+        if (request.LoadHandle.IsValid()) {
+            request.LoadHandle->CancelHandle();
+        }
+    }
+    Requests.Empty();
+    DeferredInits.Empty();
+    PlayerLocations.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UACFAISpawnQueueSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UACFAISpawnQueueSubsystem, STATGROUP_Tickables);
+}
+
+void UACFAISpawnQueueSubsystem::EnqueueSpawn(UACFGroupAIComponent* group, int32 spawnIndex, const FAISpawnInfo& spawnInfo, const FVector& location)
+{
+    if (!group) {
+        return;
+    }
+
+    FSpawnRequest& request = Requests.AddDefaulted_GetRef();
+    request.Group = group;
+    request.Index = spawnIndex;
+    request.CharacterClass = spawnInfo.AIClassBP;
+    request.Location = location;
+    request.EnqueueTime = FPlatformTime::Seconds();
+
+    // the class is a prerequisite, the request waits in the queue until it is loaded
+    const FSoftObjectPath classPath = spawnInfo.AIClassBP.ToSoftObjectPath();
+    if (classPath.IsValid() && !spawnInfo.AIClassBP.Get()) {
+        request.LoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(classPath, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+    }
+}
+
+void UACFAISpawnQueueSubsystem::EnqueueInit(UACFGroupAIComponent* group, int32 agentIndex, const FVector& location)
+{
+    if (!group) {
+        return;
+    }
+
+    FSpawnRequest& request = Requests.AddDefaulted_GetRef();
+    request.Group = group;
+    request.Index = agentIndex;
+    request.bInitOnly = true;
+    request.Location = location;
+    request.EnqueueTime = FPlatformTime::Seconds();
+}
+
+void UACFAISpawnQueueSubsystem::CancelGroupRequests(const UACFGroupAIComponent* group)
+{
+    Requests.RemoveAll([group](const FSpawnRequest& request) {
+        if (request.Group.Get() != group) {
+            return false;
+        }
+        if (request.LoadHandle.IsValid()) {
+            request.LoadHandle->CancelHandle();
+        }
+        return true;
+    });
+}
+
+void UACFAISpawnQueueSubsystem::DeferStartingItems(AACFCharacter* agent)
+{
+    if (agent) {
+        DeferredInits.Add(agent);
+    }
+}
+
+FACFAISpawnQueueStats UACFAISpawnQueueSubsystem::GetSpawnQueueStats() const
+{
+    FACFAISpawnQueueStats stats;
+    stats.QueueDepth = Requests.Num();
+    stats.PendingDeferredInits = DeferredInits.Num();
+    stats.TotalProcessed = TotalProcessed;
+    stats.AverageSpawnLatency = TotalProcessed > 0 ? TotalLatency / TotalProcessed : 0.f;
+    stats.MaxSpawnLatency = MaxLatency;
+    stats.LastFrameSpawnTimeMs = LastFrameSpawnTime * 1000.0;
+    return stats;
+}
+
+void UACFAISpawnQueueSubsystem::Tick(float DeltaTime)
+{
+    if (Requests.Num() == 0 && DeferredInits.Num() == 0) {
+        LastFrameSpawnTime = 0.0;
+        return;
+    }
+
+    const double startTime = FPlatformTime::Seconds();
+    const double budget = SpawnBudgetMs / 1000.0;
+    int32 processed = 0;
+
+    if (Requests.Num() > 0) {
+        UpdatePriorities();
+
+        while (processed < MaxSpawnsPerFrame) {
+            if (processed > 0 && FPlatformTime::Seconds() - startTime >= budget) {
+                break;
+            }
+
+            int32 bestIndex = INDEX_NONE;
+            for (int32 index = 0; index < Requests.Num(); index++) {
+                if (IsRequestReady(Requests[index]) && (bestIndex == INDEX_NONE || Requests[index].Priority < Requests[bestIndex].Priority)) {
+                    bestIndex = index;
+                }
+            }
+            if (bestIndex == INDEX_NONE) {
+                break;
+            }
+
+            // requests keep their order so that agents of the same group spawn in sequence
+            const FSpawnRequest request = Requests[bestIndex];
+            Requests.RemoveAt(bestIndex, EAllowShrinking::No);
+            ProcessRequest(request);
+            processed++;
+        }
+    }
+
+    // starting items of the agents spawned on previous frames, with whatever is left of the budget
+    int32 deferredProcessed = 0;
+    while (DeferredInits.Num() > 0) {
+        if ((processed > 0 || deferredProcessed > 0) && FPlatformTime::Seconds() - startTime >= budget) {
+            break;
+        }
+        const TWeakObjectPtr<AACFCharacter> agent = DeferredInits[0];
+        DeferredInits.RemoveAt(0, EAllowShrinking::No);
+        if (agent.IsValid()) {
+            agent->InitializeDeferredStartingItems();
+            deferredProcessed++;
+        }
+    }
+
+    LastFrameSpawnTime = FPlatformTime::Seconds() - startTime;
+}
+
+bool UACFAISpawnQueueSubsystem::IsRequestReady(const FSpawnRequest& request) const
+{
+    if (!request.Group.IsValid()) {
+        // processed right away to be discarded
+        return true;
+    }
+    if (request.bInitOnly) {
+        return true;
+    }
+    if (request.LoadHandle.IsValid() && request.LoadHandle->IsLoadingInProgress()) {
+        return false;
+    }
+    return true;
+}
+
+void UACFAISpawnQueueSubsystem::UpdatePriorities()
+{
+    PlayerLocations.Reset();
+    for (FConstPlayerControllerIterator iterator = GetWorld()->GetPlayerControllerIterator(); iterator; ++iterator) {
+        if (const APlayerController* playerController = iterator->Get()) {
+            if (const APawn* pawn = playerController->GetPawn()) {
+                PlayerLocations.Add(pawn->GetActorLocation());
+            }
+        }
+    }
+
+    for (FSpawnRequest& request : Requests) {
+        request.Priority = 0.0;
+        if (PlayerLocations.Num() > 0) {
+            request.Priority = TNumericLimits<double>::Max();
+            for (const FVector& playerLocation : PlayerLocations) {
+                request.Priority = FMath::Min(request.Priority, FVector::DistSquared(playerLocation, request.Location));
+            }
+        }
+    }
+}
+
+void UACFAISpawnQueueSubsystem::ProcessRequest(const FSpawnRequest& request)
+{
+    UACFGroupAIComponent* group = request.Group.Get();
+    if (!group) {
+        return;
+    }
+
+    if (request.bInitOnly) {
+        group->InitQueuedAgent(request.Index);
+    } else {
+        group->SpawnQueuedAgent(request.Index, request.CharacterClass.Get());
+    }
+
+    RecordLatency(FPlatformTime::Seconds() - request.EnqueueTime);
+}
+
+void UACFAISpawnQueueSubsystem::RecordLatency(double latency)
+{
+    TotalProcessed++;
+    TotalLatency += latency;
+    MaxLatency = FMath::Max(MaxLatency, latency);
+}
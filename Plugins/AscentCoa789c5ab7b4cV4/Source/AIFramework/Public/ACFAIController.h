@@ -110,6 +110,10 @@ protected:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "ACF|Combat")
     bool bShouldReactOnHit = true;
 
+    /*If true target, lead and home distances of this agent are computed by the UACFAIUpdateSubsystem together with the other agents, instead of by each service tick*/
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "ACF|Performance")
+    bool bUseBatchedUpdate = true;
+
     UPROPERTY(BlueprintReadOnly, Category = ACF)
     int32 GroupIndex;
 
@@ -202,6 +206,9 @@ public:
     UFUNCTION(BlueprintPure, Category = "ACF|Getter")
     FORCEINLINE float GetLoseTargetDistance() const { return LoseTargetDistance; }
 
+    // Returns the batched update subsystem this agent is registered to, if any
+    class UACFAIUpdateSubsystem* GetUpdateSubsystem() const;
+
     // Returns the blackboard key used for tracking the command duration time
     struct FBlackboard::FKey GetCommandDurationTimeKey() const { return commandDurationTimeKey; }
 
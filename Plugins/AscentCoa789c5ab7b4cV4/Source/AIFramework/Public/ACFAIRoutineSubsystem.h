@@ -0,0 +1,106 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "ACFAIRoutineSubsystem.generated.h"
+
+class UACFAIRoutineComponent;
+
+/**
+ * World scheduler of the AI daily routines.
+ *
+ * Registered routine components are kept in a queue ordered by the minute their next task starts.
+ * Every frame the subsystem reads the time-of-day once and wakes only the routines whose next
+ * boundary has been crossed, instead of every agent polling the clock. The clock is read even when
+ * no routine is registered, so new routines always start from the minute of the last frame.
+ *
+ * Notes:
+ * - Time is tracked on a continuous minute timeline so routines wrap correctly across midnight.
+ * - A jump of the clock larger than MaxMinutesPerUpdate (sleep, save load, time set backwards)
+ *   is treated as a time skip: every routine jumps directly to the task of the new time.
+ */
+UCLASS(config = Game)
+class AIFRAMEWORK_API UACFAIRoutineSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Start scheduling a routine. The routine immediately jumps to the task of the current time.
+	 * @param Routine The routine component to update on its task boundaries.
+	 */
+	void RegisterRoutine(UACFAIRoutineComponent* Routine);
+
+	void UnregisterRoutine(const UACFAIRoutineComponent* Routine);
+
+	/** Update a registered routine to the current time and queue its next boundary again, after its tasks changed. */
+	void RefreshRoutine(UACFAIRoutineComponent* Routine);
+
+	bool IsRoutineRegistered(const UACFAIRoutineComponent* Routine) const { return ScheduledWakes.Contains(Routine); }
+
+	/**
+	 * Advance the scheduler to a minute of the day, waking the routines whose boundary was crossed.
+	 * Called by Tick with the time-of-day, games driving their own clock can call it instead.
+	 * @param DayMinute Minutes since midnight [0..1439].
+	 */
+	void AdvanceToMinute(int32 DayMinute);
+
+	/**
+	 * Read the current apparent time-of-day from the DaySequence subsystem.
+	 * @return Time in hours in the range [0..24], or 0 if unavailable.
+	 */
+	float GetTimeHours() const;
+
+	UFUNCTION(BlueprintPure, Category = "ACF|Routine")
+	int32 GetNumRoutines() const { return ScheduledWakes.Num(); }
+
+	/**
+	 * Routines updated during the last frame because the clock crossed one of their task boundaries.
+	 */
+	UFUNCTION(BlueprintPure, Category = "ACF|Routine")
+	int32 GetWokenRoutinesLastFrame() const { return WokenRoutines; }
+
+protected:
+	/**
+	 * Largest clock advance in minutes handled by waking routines in order. Bigger jumps are time skips.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "ACF|Routine", meta = (ClampMin = 1))
+	int32 MaxMinutesPerUpdate = 60;
+
+private:
+	struct FScheduledWake
+	{
+		TWeakObjectPtr<UACFAIRoutineComponent> Routine;
+		int64 WakeMinute = 0;
+
+		bool operator<(const FScheduledWake& Other) const { return WakeMinute < Other.WakeMinute; }
+	};
+
+	/** Queue the next boundary of a routine after the current minute. */
+	void Schedule(UACFAIRoutineComponent* Routine);
+
+	/** Jump every routine to the task of the current minute and rebuild the queue. */
+	void ResyncAll();
+
+	/** Min-heap of next task boundaries. Entries not matching ScheduledWakes are stale and skipped. */
+	TArray<FScheduledWake> WakeQueue;
+
+	/** Routine -> minute of its queued boundary, INDEX_NONE if it has no tasks. */
+	TMap<TObjectKey<UACFAIRoutineComponent>, int64> ScheduledWakes;
+
+	/** Minutes elapsed on a continuous timeline, used to order boundaries across midnight. */
+	int64 ClockMinute = 0;
+
+	/** Minute of the day [0..1439] read during the last update, INDEX_NONE before the clock is available. */
+	int32 LastDayMinute = INDEX_NONE;
+
+	int32 WokenRoutines = 0;
+};
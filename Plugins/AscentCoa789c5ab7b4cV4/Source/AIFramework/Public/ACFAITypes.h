@@ -444,6 +444,26 @@ namespace ACF
 	const FName AIRoutine = TEXT("AIState.Routine");
 }
 
+/**
+* AI state tags resolved once at module startup, to avoid looking them up by name in per tick code.
+*/
+struct AIFRAMEWORK_API FACFAIStateTags
+{
+	FGameplayTag Wait;
+	FGameplayTag Patrol;
+	FGameplayTag Combat;
+	FGameplayTag ReturnHome;
+	FGameplayTag FollowLead;
+	FGameplayTag Routine;
+
+	static const FACFAIStateTags& Get() { return StateTags; }
+
+	static void InitializeNativeTags();
+
+private:
+	static FACFAIStateTags StateTags;
+};
+
 /**
 * AI Routine 
 */
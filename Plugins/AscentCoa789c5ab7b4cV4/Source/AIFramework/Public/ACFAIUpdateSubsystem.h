@@ -0,0 +1,120 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "ACFAIUpdateSubsystem.generated.h"
+
+class AACFAIController;
+
+/**
+ * * Distances of an AI agent computed by the last batched update.
+ */
+USTRUCT(BlueprintType)
+struct FACFAIAgentDistances {
+    GENERATED_BODY()
+
+    /**
+     * * Target the distance was computed for, compared with the current one before using it.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = ACF)
+    TObjectPtr<const AActor> Target = nullptr;
+
+    /**
+     * * Distance between the extents of the agent and its target, or between their locations if the target is not a character.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = ACF)
+    float TargetDistance = -1.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = ACF)
+    TObjectPtr<const AActor> Lead = nullptr;
+
+    UPROPERTY(BlueprintReadOnly, Category = ACF)
+    float LeadDistance = -1.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = ACF)
+    float HomeDistance = -1.f;
+};
+
+/**
+ * * World-level batched update of the distances used by the ACF behavior tree services.
+ *
+ * Controllers register when they possess a pawn. Once per frame the subsystem gathers agent, target,
+ * lead and home locations of every agent in flat arrays, computes all the distances in a parallel pass
+ * and writes back to the blackboards only the values that moved more than DistanceWriteTolerance.
+ * Services read the results instead of casting and measuring on every tick, and fall back to computing
+ * them directly for agents that are not registered.
+ */
+UCLASS(config = Game)
+class AIFRAMEWORK_API UACFAIUpdateSubsystem : public UTickableWorldSubsystem {
+    GENERATED_BODY()
+
+public:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    void RegisterAgent(AACFAIController* controller);
+    void UnregisterAgent(const AACFAIController* controller);
+
+    /**
+     * * Returns the distances of an agent computed by the last update.
+     * @return False if the agent is not registered or it has not been updated yet.
+     */
+    bool GetAgentDistances(const AACFAIController* controller, FACFAIAgentDistances& outDistances) const;
+
+    UFUNCTION(BlueprintPure, Category = "ACF|AI Update")
+    int32 GetNumAgents() const { return Controllers.Num(); }
+
+    /**
+     * * Blackboard distance writes skipped during the last update because the value did not change enough.
+     */
+    UFUNCTION(BlueprintPure, Category = "ACF|AI Update")
+    int32 GetSkippedWritesLastFrame() const { return SkippedWrites; }
+
+protected:
+    /**
+     * * Minimum change in cm before a distance is written again to the blackboard.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "ACF|AI Update")
+    float DistanceWriteTolerance = 5.f;
+
+    /**
+     * * Below this number of agents distances are computed on the game thread.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "ACF|AI Update")
+    int32 MinAgentsForParallelUpdate = 64;
+
+private:
+    void RemoveAgentAt(int32 index);
+
+    TMap<const AACFAIController*, int32> AgentIndices;
+
+    // one entry per registered agent, all arrays share the same index
+    TArray<const AACFAIController*> AgentKeys;
+    TArray<TWeakObjectPtr<AACFAIController>> Controllers;
+    TArray<FVector> AgentLocations;
+    TArray<float> AgentExtents;
+    TArray<TWeakObjectPtr<const AActor>> Targets;
+    TArray<FVector> TargetLocations;
+    TArray<float> TargetExtents;
+    TArray<TWeakObjectPtr<const AActor>> Leads;
+    TArray<FVector> LeadLocations;
+    TArray<FVector> HomeLocations;
+    TArray<uint8> UpdateFlags;
+
+    TArray<float> TargetDistances;
+    TArray<float> LeadDistances;
+    TArray<float> HomeDistances;
+
+    // last values written to each blackboard
+    TArray<float> WrittenTargetDistances;
+    TArray<float> WrittenLeadDistances;
+    TArray<float> WrittenHomeDistances;
+
+    uint64 LastUpdateFrame = 0;
+    int32 SkippedWrites = 0;
+};
@@ -8,10 +8,13 @@
 
 class UACFAIRoutineComponent;
 /**
- * BT Service that polls the actor's UACFAIRoutineComponent
+ * BT Service that drives the actor's UACFAIRoutineComponent
  *
  * Typical usage:
  * - Place this service on a Behavior Tree branch that should react to AI routine changes. * 
+ * - While the branch is relevant the routine is registered to the UACFAIRoutineSubsystem, which
+ *   updates it only when its next task starts, and the service stops ticking.
+ *   Disable bUseRoutineScheduler to poll at the service interval instead.
  */
 UCLASS()
 class AIFRAMEWORK_API UACFCheckRoutineBTService : public UBTService
@@ -44,6 +47,11 @@ public:
 	 */
 	virtual void TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
 
+protected:
+	/** If true, the routine is updated by the world routine scheduler instead of being polled at the service interval. */
+	UPROPERTY(EditAnywhere, Category = "ACF|Routine")
+	bool bUseRoutineScheduler = true;
+
 private:
 
 	/** Cached pointer to the actor's routine component (resolved on demand). */
@@ -56,4 +64,10 @@ private:
 	 * @param OwnerComp Behavior tree component used to access the owning AI and pawn.
 	 */
 	void ResolveRoutineComponent(UBehaviorTreeComponent& OwnerComp);
+
+	/**
+	 * Register the routine component to the world routine scheduler, if enabled.
+	 * @return true if the routine is updated by the scheduler and must not be polled.
+	 */
+	bool RegisterToScheduler(UBehaviorTreeComponent& OwnerComp);
 };
@@ -22,6 +22,8 @@ class UContextualAnimSceneAsset;
  * Notes:
  * - The DataAsset entries are referenced by FGuid (EntryGuid) instead of array indices.
  * - If bSortTasksOnBuild is true, entries are sorted by time during BuildSchedule().
+ * - While registered to the UACFAIRoutineSubsystem the component is updated only when the
+ *   clock crosses one of its task boundaries, instead of being polled.
  */
 
  /** Broadcast when *a runtime task* owned by this component start. */
@@ -45,6 +47,13 @@ public:
 		return FMath::Clamp(minutes, 0, 1439);
 	}
 
+	/**
+	 * Helper: convert hours [0..24] to minutes [0..1439].
+	 * @param Hours Time in hours.
+	 * @return Minutes since midnight.
+	 */
+	static int32 ToMinutes(float Hours);
+
 	/** Called by tasks to notify this component that they have finished. */
 	UPROPERTY(BlueprintAssignable, Category = "ACF|Routine")
 	FOnRoutineTaskEnded OnRoutineTaskEnded;
@@ -76,6 +85,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ACF|Routine")
 	bool UpdateByTime();
 
+	/**
+	 * Update the routine as if the current time was NowMinutes, jumping directly to the task of that time.
+	 * @param NowMinutes Minutes since midnight [0..1439].
+	 * @return true if a new routine slot started in this call, false otherwise.
+	 */
+	bool UpdateByMinutes(int32 NowMinutes);
+
+	/**
+	 * Minute at which the next task after NowMinutes starts, beyond 1439 if it is on the next day.
+	 * @return INDEX_NONE if the routine has no tasks.
+	 */
+	int32 GetNextTaskMinute(int32 NowMinutes) const;
+
 	/**
 	 * Stop all currently active tasks (calls OnTaskEnded on each) and clears internal state.
 	 */
@@ -101,8 +123,13 @@ public:
 	UFUNCTION(BlueprintPure, Category = "ACF|Routine")
 	UACFTask* GetLastStartedTask() const { return LastStartedTask.Get(); }
 
+	/** GUID of the routine entry of the current time, invalid before the first update. */
+	UFUNCTION(BlueprintPure, Category = "ACF|Routine")
+	FGuid GetCurrentTaskGuid() const { return CurrentActiveGuid; }
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	UPROPERTY(Transient)
 	TObjectPtr<UACFTask> LastStartedTask = nullptr;
@@ -132,6 +159,12 @@ protected:
 	UPROPERTY()
 	TArray<FAIRoutineTask> SortedDailyTasks;
 
+	/** Start minute of each entry of SortedDailyTasks. */
+	TArray<int32> SortedTaskMinutes;
+
+	/** EntryGuid -> index in the DataAsset DailyTasks. */
+	TMap<FGuid, int32> EntryIndices;
+
 private:
 	/**
 	 * Build the Minutes array from the DataAsset and normalize internal state.
@@ -139,11 +172,9 @@ private:
 	 */
 	void BuildSchedule();
 
-	/**
-	 * Helper: convert hours [0..24] to minutes [0..1439].
-	 * @param Hours Time in hours.
-	 * @return Minutes since midnight.
-	 */
-	 int32 ToMinutes(float Hours);
 	void RebuildTaskCache();
+	void RebuildTaskMinutes();
+
+	/** Notify the routine subsystem the schedule changed, if this component is registered to it. */
+	void RefreshScheduler();
 };
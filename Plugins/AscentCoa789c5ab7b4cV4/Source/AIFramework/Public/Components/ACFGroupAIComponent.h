@@ -90,6 +90,13 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ACF|AI Config")
 	FGameplayTag DefaultAiState;
 
+	/**
+	 * * When an agent asks for a target and neither the group nor an enemy group provides one,
+	 * * pick the nearest hostile agent of any group within this distance. Zero disables the search.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ACF|AI Config")
+	float NearbyTargetSearchRadius = 0.f;
+
 	/**
 	 * * The maximum number of simultaneous AI agents allowed in the group.
 	 */
@@ -108,6 +115,13 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "ACF|Spawn")
 	FVector2D DefaultSpawnOffset;
 
+	/**
+	 * * Whether agents are spawned through the AI spawn queue, spread over several frames and prioritized
+	 * * by distance to the players, instead of all in the same frame.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ACF|Spawn")
+	bool bUseSpawnQueue = true;
+
 	/**
 	 * * List of AI characters to spawn in the group.
 	 */
@@ -412,6 +426,13 @@ public:
 	UFUNCTION(BlueprintPure, Category = ACF)
 	bool IsGroupSpawned() const { return bAlreadySpawned; }
 
+	/**
+	 * * Checks if some agents of the group are still waiting in the AI spawn queue.
+	 * @return True if the group is still spawning, false otherwise.
+	 */
+	UFUNCTION(BlueprintPure, Category = ACF)
+	bool IsSpawnPending() const { return PendingQueuedSpawns > 0; }
+
 	/**
 	 * * Sets the group's name.
 	 * @param val The new name for the group.
@@ -445,9 +466,13 @@ public:
 	virtual void PostEditComponentMove(bool bFinished) override;
 #endif
 private:
+	friend class UACFAISpawnQueueSubsystem;
+
 	UPROPERTY(SaveGame)
 	bool bAlreadySpawned = false;
 
+	int32 PendingQueuedSpawns = 0;
+
 	void Internal_SendCommandToAgents(FGameplayTag command);
 
 	UPROPERTY()
@@ -455,7 +480,7 @@ private:
 
 	void Internal_SpawnGroup();
 
-	uint8 AddAgentToGroup(const FAISpawnInfo& spawnInfo);
+	uint8 AddAgentToGroup(const FAISpawnInfo& spawnInfo, bool bDeferStartingItems = false);
 	void InitAgent(FAIAgentsInfo& agent, int32 childIndex);
 
 	void SetEnemyGroup(UACFGroupAIComponent* inEnemyGroup);
@@ -465,6 +490,14 @@ private:
 
 	void OnAIAssetsLoaded();
 
+	void EnqueueGroupSpawn();
+	void SpawnQueuedAgent(int32 spawnIndex, UClass* loadedClass);
+	void InitQueuedAgent(int32 agentIndex);
+	void OnQueuedRequestCompleted();
+
+	class UACFAIProximitySubsystem* GetProximitySubsystem() const;
+	class UACFAISpawnQueueSubsystem* GetSpawnQueueSubsystem() const;
+
 protected:
 	// Handle for managing async loading
 	TSharedPtr<FStreamableHandle> StreamableHandle;
@@ -10,6 +10,16 @@
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNewMaxThreateningActor, class AActor*, threatening);
 
+USTRUCT()
+struct FACFThreatEntry {
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TObjectPtr<AActor> Actor = nullptr;
+
+    float Threat = 0.f;
+};
+
 UCLASS(ClassGroup = (ACF), Blueprintable, meta = (BlueprintSpawnableComponent))
 class AIFRAMEWORK_API UACFThreatManagerComponent : public UActorComponent {
     GENERATED_BODY()
@@ -53,6 +63,20 @@ public:
     UFUNCTION(BlueprintCallable, Category = ACF)
     void RemoveAllThreatenings();
 
+    /*Returns the current threat of the provided actor, or -1 if it is not threatening*/
+    UFUNCTION(BlueprintPure, Category = ACF)
+    float GetThreatForActor(const AActor* threatening) const;
+
+    /*Sets the multiplier applied to the threat accumulated by actors of the provided class*/
+    UFUNCTION(BlueprintCallable, Category = ACF)
+    void SetThreatMultiplierForClass(TSubclassOf<AActor> actorClass, float threatMult);
+
+    /*Sets the threat added when an actor of the provided class is percepted*/
+    UFUNCTION(BlueprintCallable, Category = ACF)
+    void SetDefaultThreatForClass(TSubclassOf<AActor> actorClass, float defaultThreat);
+
+    int32 GetNumThreatenings() const { return ThreatHeap.Num(); }
+
     /*called when there is a new highest threaning actor in the list*/
     UPROPERTY(BlueprintAssignable, Category = ACF)
     FOnNewMaxThreateningActor OnNewMaxThreateningActor;
@@ -68,11 +92,29 @@ protected:
     TMap<TSubclassOf<AActor>, float> ThreatMultipliersByActor;
 
 private:
+    /* Max-heap of threats, the most threatening actor is always the first */
     UPROPERTY()
-    TMap<class AActor*, float> ThreatMap;
+    TArray<FACFThreatEntry> ThreatHeap;
+
+    TMap<const AActor*, int32> HeapIndices;
 
     UPROPERTY()
     class AActor* maxThreatening;
 
     void UpdateMaxThreat();
+
+    void SetThreat(AActor* threatening, float threat);
+    void RemoveHeapAt(int32 index);
+    void SiftUp(int32 index);
+    void SiftDown(int32 index);
+    void SwapEntries(int32 first, int32 second);
+
+    void BindThreateningEvents(AActor* threatening);
+    void UnbindThreateningEvents(AActor* threatening);
+
+    UFUNCTION()
+    void HandleThreateningDeath(class AACFCharacter* deadCharacter);
+
+    UFUNCTION()
+    void HandleThreateningDestroyed(AActor* destroyedActor);
 };
@@ -0,0 +1,196 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Templates/SubclassOf.h"
+
+#include "ACFAIProximitySubsystem.generated.h"
+
+class AACFCharacter;
+class UACFGroupAIComponent;
+
+/**
+ * * How the team of an agent is compared against the team of a proximity query.
+ */
+UENUM(BlueprintType)
+enum class EACFProximityTeamFilter : uint8 {
+    EAnyTeam UMETA(DisplayName = "Any Team"),
+    ESameTeam UMETA(DisplayName = "Same Team"),
+    EHostileTeam UMETA(DisplayName = "Hostile Team"),
+};
+
+/**
+ * * Filters applied to agents returned by the proximity subsystem.
+ */
+USTRUCT(BlueprintType)
+struct FACFProximityQuery {
+    GENERATED_BODY()
+
+    /**
+     * * Maximum distance from the query location. Zero or less means unbounded.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = ACF)
+    float Radius = 0.f;
+
+    /**
+     * * Team compared against each agent team according to TeamFilter.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (Categories = "Teams"), Category = ACF)
+    FGameplayTag Team;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = ACF)
+    EACFProximityTeamFilter TeamFilter = EACFProximityTeamFilter::EAnyTeam;
+
+    /**
+     * * If set, only agents belonging to this group are returned.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = ACF)
+    TObjectPtr<const UACFGroupAIComponent> Group = nullptr;
+
+    /**
+     * * Actor never returned by the query, usually the one asking.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = ACF)
+    TObjectPtr<const AActor> IgnoredActor = nullptr;
+};
+
+/**
+ * * World-level spatial hash of every alive AI group agent.
+ *
+ * Agents are registered by their group and binned in a uniform 2D grid. Locations are refreshed
+ * at UpdateInterval and an agent is only re-binned when it crosses a cell, so nearest and radius
+ * queries only visit the cells around the query location instead of every agent of every group.
+ * The subsystem also keeps a running centroid per group and a Guid -> agent registry used to
+ * resolve saved agents on reload.
+ */
+UCLASS(config = Game)
+class AIFRAMEWORK_API UACFAIProximitySubsystem : public UTickableWorldSubsystem {
+    GENERATED_BODY()
+
+public:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /**
+     * * Adds an agent to the grid, or moves it to another group if already registered.
+     * @param agent The agent to track.
+     * @param group The group owning the agent, used for group filters and centroids.
+     */
+    UFUNCTION(BlueprintCallable, Category = "ACF|AI Proximity")
+    void RegisterAgent(AACFCharacter* agent, UACFGroupAIComponent* group);
+
+    /**
+     * * Removes an agent from the grid and from its group centroid.
+     */
+    UFUNCTION(BlueprintCallable, Category = "ACF|AI Proximity")
+    void UnregisterAgent(const AACFCharacter* agent);
+
+    /**
+     * * Immediately refreshes the location of an agent instead of waiting for the next update.
+     */
+    UFUNCTION(BlueprintCallable, Category = "ACF|AI Proximity")
+    void UpdateAgentLocation(AACFCharacter* agent);
+
+    /**
+     * * Returns the closest alive agent matching the query, or null.
+     */
+    UFUNCTION(BlueprintCallable, Category = "ACF|AI Proximity")
+    AACFCharacter* FindNearestAgent(const FVector& location, const FACFProximityQuery& query) const;
+
+    /**
+     * * Collects up to count alive agents matching the query, sorted from closest to furthest.
+     */
+    UFUNCTION(BlueprintCallable, Category = "ACF|AI Proximity")
+    void FindNearestAgents(const FVector& location, int32 count, const FACFProximityQuery& query, TArray<AACFCharacter*>& outAgents) const;
+
+    /**
+     * * Collects every alive agent matching the query within the query radius, in no particular order.
+     */
+    UFUNCTION(BlueprintCallable, Category = "ACF|AI Proximity")
+    void GetAgentsWithinRadius(const FVector& location, const FACFProximityQuery& query, TArray<AACFCharacter*>& outAgents) const;
+
+    /**
+     * * Returns the average location of the registered agents of a group.
+     * @return False if the group has no registered agent.
+     */
+    UFUNCTION(BlueprintCallable, Category = "ACF|AI Proximity")
+    bool GetGroupCentroid(const UACFGroupAIComponent* group, FVector& outCentroid) const;
+
+    /**
+     * * Associates a saved agent guid with a spawned character.
+     */
+    void RegisterAgentGuid(const FName& guid, AACFCharacter* agent);
+
+    /**
+     * * Resolves a saved agent guid. On a miss every character in the world is indexed by tag once per frame,
+     * * so resolving a whole group after loading costs a single actor iteration.
+     */
+    AACFCharacter* FindAgentByGuid(const FName& guid, TSubclassOf<AACFCharacter> characterClass);
+
+    int32 GetNumAgents() const { return AgentIndices.Num(); }
+
+protected:
+    /**
+     * * Size in cm of a grid cell. Should be around the usual target search distance.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "ACF|AI Proximity")
+    float CellSize = 2000.f;
+
+    /**
+     * * Seconds between agent location refreshes.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "ACF|AI Proximity")
+    float UpdateInterval = 0.2f;
+
+private:
+    struct FProximityAgent {
+        const AACFCharacter* Key = nullptr;
+        TWeakObjectPtr<AACFCharacter> Character;
+        TWeakObjectPtr<UACFGroupAIComponent> Group;
+        FGameplayTag Team;
+        FVector Location = FVector::ZeroVector;
+        FIntPoint Cell = FIntPoint::ZeroValue;
+        bool bAlive = false;
+        bool bInUse = false;
+    };
+
+    struct FGroupCentroid {
+        FVector LocationSum = FVector::ZeroVector;
+        int32 Count = 0;
+    };
+
+    FIntPoint GetCell(const FVector& location) const;
+    void AddToCell(int32 agentIndex);
+    void RemoveFromCell(int32 agentIndex);
+    void RemoveAgentAt(int32 agentIndex);
+    void RefreshAgent(int32 agentIndex);
+
+    bool PassesFilter(const FProximityAgent& agent, const FACFProximityQuery& query) const;
+
+    /**
+     * * Visits agents ring by ring around the location until count matches are found and no closer
+     * * agent can exist in the remaining rings. Results are sorted by squared distance.
+     */
+    void GatherNearest(const FVector& location, int32 count, const FACFProximityQuery& query, TArray<TPair<float, int32>>& outResults) const;
+
+    void RebuildGuidRegistry();
+
+    TArray<FProximityAgent> Agents;
+    TArray<int32> FreeAgentIndices;
+    TMap<const AACFCharacter*, int32> AgentIndices;
+    TMap<FIntPoint, TArray<int32>> Cells;
+    TMap<TWeakObjectPtr<const UACFGroupAIComponent>, FGroupCentroid> GroupCentroids;
+
+    // bounds of every occupied cell, used to stop unbounded nearest searches
+    FIntRect OccupiedCells;
+
+    TMap<FName, TWeakObjectPtr<AACFCharacter>> GuidRegistry;
+    uint64 LastGuidRegistryRebuildFrame = 0;
+
+    float TimeSinceUpdate = 0.f;
+};
@@ -0,0 +1,151 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "ACFAITypes.h"
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "ACFAISpawnQueueSubsystem.generated.h"
+
+class AACFCharacter;
+class UACFGroupAIComponent;
+struct FStreamableHandle;
+
+/**
+ * * Metrics of the AI spawn queue.
+ */
+USTRUCT(BlueprintType)
+struct FACFAISpawnQueueStats {
+    GENERATED_BODY()
+
+    /**
+     * * Spawn requests waiting in the queue, including the ones still loading their class.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = ACF)
+    int32 QueueDepth = 0;
+
+    /**
+     * * Spawned agents whose starting items are still waiting to be added.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = ACF)
+    int32 PendingDeferredInits = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = ACF)
+    int32 TotalProcessed = 0;
+
+    /**
+     * * Average seconds between a request being queued and its agent being spawned.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = ACF)
+    float AverageSpawnLatency = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = ACF)
+    float MaxSpawnLatency = 0.f;
+
+    /**
+     * * Milliseconds spent spawning during the last frame.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = ACF)
+    float LastFrameSpawnTimeMs = 0.f;
+};
+
+/**
+ * * World-level queue spreading the spawn of AI group agents over several frames.
+ *
+ * Groups push one request per agent instead of spawning them all at once. The class of each request
+ * is loaded asynchronously and every frame the ready requests closest to a player are processed until
+ * SpawnBudgetMs is spent. Agents are spawned with their starting items deferred, the items are added on
+ * the following frames with the remaining budget.
+ */
+UCLASS(config = Game)
+class AIFRAMEWORK_API UACFAISpawnQueueSubsystem : public UTickableWorldSubsystem {
+    GENERATED_BODY()
+
+public:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /**
+     * * Queues the spawn of an agent of a group.
+     * @param group The group the agent will belong to.
+     * @param spawnIndex Index of the agent in the AIToSpawn list of the group.
+     * @param spawnInfo The spawn info of the agent, its class is loaded asynchronously if needed.
+     * @param location Where the agent will appear, used to prioritize the request.
+     */
+    void EnqueueSpawn(UACFGroupAIComponent* group, int32 spawnIndex, const FAISpawnInfo& spawnInfo, const FVector& location);
+
+    /**
+     * * Queues the initialization of an agent restored from a save.
+     * @param group The group owning the agent.
+     * @param agentIndex Index of the agent in the group.
+     * @param location Location of the agent, used to prioritize the request.
+     */
+    void EnqueueInit(UACFGroupAIComponent* group, int32 agentIndex, const FVector& location);
+
+    /**
+     * * Removes every pending request of a group.
+     */
+    void CancelGroupRequests(const UACFGroupAIComponent* group);
+
+    /**
+     * * Adds the starting items of a spawned agent on a later frame.
+     */
+    void DeferStartingItems(AACFCharacter* agent);
+
+    UFUNCTION(BlueprintPure, Category = "ACF|AI Spawn")
+    FACFAISpawnQueueStats GetSpawnQueueStats() const;
+
+    UFUNCTION(BlueprintPure, Category = "ACF|AI Spawn")
+    int32 GetQueueDepth() const { return Requests.Num(); }
+
+    bool ShouldDeferStartingItems() const { return bDeferStartingItems; }
+
+protected:
+    /**
+     * * Milliseconds per frame that can be spent spawning and initializing agents.
+     * * At least one request is processed every frame.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "ACF|AI Spawn")
+    float SpawnBudgetMs = 2.f;
+
+    /**
+     * * Maximum agents spawned in a single frame, regardless of the budget.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "ACF|AI Spawn")
+    int32 MaxSpawnsPerFrame = 4;
+
+    /**
+     * * Whether spawned agents receive their starting items on a later frame.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "ACF|AI Spawn")
+    bool bDeferStartingItems = true;
+
+private:
+    struct FSpawnRequest {
+        TWeakObjectPtr<UACFGroupAIComponent> Group;
+        int32 Index = INDEX_NONE;
+        bool bInitOnly = false;
+        TSoftClassPtr<AACFCharacter> CharacterClass;
+        TSharedPtr<FStreamableHandle> LoadHandle;
+        FVector Location = FVector::ZeroVector;
+        double EnqueueTime = 0.0;
+        double Priority = 0.0;
+    };
+
+    bool IsRequestReady(const FSpawnRequest& request) const;
+    void UpdatePriorities();
+    void ProcessRequest(const FSpawnRequest& request);
+    void RecordLatency(double latency);
+
+    TArray<FSpawnRequest> Requests;
+    TArray<TWeakObjectPtr<AACFCharacter>> DeferredInits;
+    TArray<FVector> PlayerLocations;
+
+    int32 TotalProcessed = 0;
+    double TotalLatency = 0.0;
+    double MaxLatency = 0.0;
+    double LastFrameSpawnTime = 0.0;
+};
@@ -193,7 +193,11 @@ void AACFCharacter::InitializeCharacter()
 		if (EquipmentComp) {
 			EquipmentComp->SetMainMesh(GetMainMesh(), false);
 			if (!UALSFunctionLibrary::ShouldSaveActor(this) || UALSFunctionLibrary::IsNewGame(this)) {
-				EquipmentComp->InitializeStartingItems();
+				if (bDeferStartingItems) {
+					bPendingStartingItems = true;
+				} else {
+					EquipmentComp->InitializeStartingItems();
+				}
 			}
 		}
 	}
@@ -220,6 +224,19 @@ void AACFCharacter::InitializeCharacter()
 	OnCharacterFullyInitialized.Broadcast();
 }
 
+void AACFCharacter::InitializeDeferredStartingItems()
+{
+	if (!bPendingStartingItems || !HasAuthority()) {
+		return;
+	}
+
+	bPendingStartingItems = false;
+	bDeferStartingItems = false;
+	if (EquipmentComp && IsAlive()) {
+		EquipmentComp->InitializeStartingItems();
+	}
+}
+
 void AACFCharacter::HandleEquipmentChanged(const FEquipment& equipment)
 {
 	FGameplayTag movesetTag, overlayTag, actionsTag;
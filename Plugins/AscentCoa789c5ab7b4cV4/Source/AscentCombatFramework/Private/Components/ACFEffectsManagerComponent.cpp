@@ -10,6 +10,8 @@
 #include "Config/ACFEffectsConfigDataAsset.h"
 #include "Engine/World.h"
 #include "Game/ACFFunctionLibrary.h"
+#include "GameFramework/GameStateBase.h"
+#include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Logging.h"
 #include <CollisionQueryParams.h>
@@ -52,14 +54,6 @@ void UACFEffectsManagerComponent::TriggerFootstepFX(FName footBone /*= NAME_None
         return;
     }
 
-    FBaseFX baseFX;
-
-    if (CharacterEffectsConfig->ShouldCheckForSurface()) {
-        CharacterEffectsConfig->TryGetFootstepFXBySurfaceType(GetCurrentTerrain(), baseFX);
-    } else {
-        CharacterEffectsConfig->GetDefaultFootstepFX(baseFX);
-    }
-
     FVector ownerLocation;
 
     if (footBone != NAME_None) {
@@ -68,14 +62,28 @@ void UACFEffectsManagerComponent::TriggerFootstepFX(FName footBone /*= NAME_None
         ownerLocation = CharacterOwner->GetActorLocation();
     }
 
-    FImpactFX fxToPlay = FImpactFX(baseFX, ownerLocation);
-
     const float noise = GetNoiseToEmitForCurrentLocomotionState();
 
     if (UKismetSystemLibrary::IsServer(this) && noise != 0.f) {
         CharacterOwner->MakeNoise(noise, CharacterOwner, CharacterOwner->GetActorLocation());
     }
 
+    // No need to look for the surface of footsteps nobody will see
+    UACMEffectsDispatcherComponent* effDisp = GetEffectsDispatcher();
+    if (effDisp && !effDisp->IsInFXRelevancyRange(ownerLocation)) {
+        return;
+    }
+
+    FBaseFX baseFX;
+
+    if (CharacterEffectsConfig->ShouldCheckForSurface()) {
+        CharacterEffectsConfig->TryGetFootstepFXBySurfaceType(GetCurrentTerrain(), baseFX);
+    } else {
+        CharacterEffectsConfig->GetDefaultFootstepFX(baseFX);
+    }
+
+    FImpactFX fxToPlay = FImpactFX(baseFX, ownerLocation);
+
     //Not needed for footstep to spawn a cue as it's always handled only clientside
     UACMCollisionsFunctionLibrary::SpawnSoundAndParticleAtLocation(CharacterOwner, fxToPlay);
 }
@@ -84,6 +92,19 @@ EPhysicalSurface UACFEffectsManagerComponent::GetCurrentTerrain()
 {
     ensure(CharacterOwner);
     if (CharacterOwner) {
+        // ACF characters share the surface cache of their movement component
+        if (UACFCharacterMovementComponent* acfMoveComp = Cast<UACFCharacterMovementComponent>(CharacterOwner->GetCharacterMovement())) {
+            return acfMoveComp->GetGroundSurfaceType();
+        }
+
+        // Reuse the floor already found by the movement component
+        const UCharacterMovementComponent* moveComp = CharacterOwner->GetCharacterMovement();
+        if (moveComp && moveComp->CurrentFloor.IsWalkableFloor()) {
+            if (const UPhysicalMaterial* floorMtl = moveComp->CurrentFloor.HitResult.PhysMaterial.Get()) {
+                return floorMtl->SurfaceType;
+            }
+        }
+
         FCollisionQueryParams outTraceParams = FCollisionQueryParams(FName(TEXT("Trace")), true, CharacterOwner);
 
         outTraceParams.bTraceComplex = true;
@@ -99,14 +120,23 @@ EPhysicalSurface UACFEffectsManagerComponent::GetCurrentTerrain()
 
         if (bHit) {
             const UPhysicalMaterial* PhysicsMtl = outTerrain.PhysMaterial.Get();
-            const EPhysicalSurface surface = PhysicsMtl->SurfaceType;
-            return surface;
+            return PhysicsMtl ? PhysicsMtl->SurfaceType.GetValue() : EPhysicalSurface::SurfaceType_Default;
         }
     }
 
     return EPhysicalSurface::SurfaceType_Max;
 }
 
+UACMEffectsDispatcherComponent* UACFEffectsManagerComponent::GetEffectsDispatcher()
+{
+    if (!EffectsDispatcher.IsValid()) {
+        if (const AGameStateBase* gameState = UGameplayStatics::GetGameState(this)) {
+            EffectsDispatcher = gameState->FindComponentByClass<UACMEffectsDispatcherComponent>();
+        }
+    }
+    return EffectsDispatcher.Get();
+}
+
 void UACFEffectsManagerComponent::HandleDamageReceived(const FACFDamageEvent& damageEvent)
 {
     if (GetOwner()->HasAuthority()) {
@@ -84,6 +84,19 @@ public:
 
 	bool GetAutoInit() const { return bAutoInit; }
 	void SetAutoInit(bool val) { bAutoInit = val; }
+
+	/**
+	 * * If set before BeginPlay, the starting items are not added during the character initialization
+	 * * but only when InitializeDeferredStartingItems is called.
+	 */
+	void SetDeferStartingItems(bool val) { bDeferStartingItems = val; }
+
+	/**
+	 * * Adds the starting items skipped by the initialization because of SetDeferStartingItems.
+	 */
+	void InitializeDeferredStartingItems();
+
+	bool HasPendingStartingItems() const { return bPendingStartingItems; }
 protected:
 	// Called after properties have been initialized
 	virtual void PostInitProperties() override;
@@ -789,6 +802,10 @@ public:
 private:
 	bool bInitialized = false;
 
+	bool bDeferStartingItems = false;
+
+	bool bPendingStartingItems = false;
+
 	float ZFalling = -1.f;
 
 	UFUNCTION()
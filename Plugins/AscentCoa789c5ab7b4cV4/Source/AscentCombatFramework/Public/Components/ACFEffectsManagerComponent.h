@@ -35,6 +35,8 @@ public:
 
     /**
      * Returns the physical surface type the character is currently standing on.
+     * The floor found by the movement component is reused while the character stays on the same
+     * surface, the terrain is traced only when the floor changes.
      *
      * @return The current terrain surface (e.g., grass, rock, water).
      */
@@ -135,4 +137,8 @@ private:
     void ClientsStopEffectAttached(const FActionEffect& attachedFX);
 
     TMap<FGuid, FAttachedComponents> ActiveFX;
+
+    class UACMEffectsDispatcherComponent* GetEffectsDispatcher();
+
+    TWeakObjectPtr<class UACMEffectsDispatcherComponent> EffectsDispatcher;
 };
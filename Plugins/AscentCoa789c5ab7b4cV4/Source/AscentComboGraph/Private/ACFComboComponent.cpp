@@ -81,23 +81,23 @@ void UACFComboComponent::SetupPlayerInputComponent(UEnhancedInputComponent* Enha
         for (const TPair<UInputAction*, FGameplayTag>& Pair : ComboInputs) {
             UInputAction* input = Pair.Key;
 
+            // the transition tag is bound with the action, no lookup on every press
             EnhancedInputComponent->BindAction(input, ETriggerEvent::Started, this,
-                &UACFComboComponent::HandleComboInputReceived, input);
+                &UACFComboComponent::HandleComboInputReceived, Pair.Value);
         }
     } else {
         UE_LOG(LogTemp, Warning, TEXT("Missing Enhanced Input Comp!  - UACFComboComponent"));
     }
 }
 
-void UACFComboComponent::HandleComboInputReceived(UInputAction* input)
+void UACFComboComponent::HandleComboInputReceived(FGameplayTag inputTag)
 {
-    const FGameplayTag* foundTag = ComboInputs.Find(input);
     // pre setting it locally to avoid network delays, server check will eventually rollback it in
     // ability end
     // checking also is another input have been sent to avoid spamming
-    if (foundTag && GetLastTagInput() != *foundTag && Internal_InputReceived(*foundTag)) {
+    if (GetLastTagInput() != inputTag && Internal_InputReceived(inputTag)) {
 
-        SendInputReceived(*foundTag);
+        SendInputReceived(inputTag);
     }
 }
 
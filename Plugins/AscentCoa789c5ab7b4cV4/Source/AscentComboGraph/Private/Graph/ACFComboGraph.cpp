@@ -2,8 +2,10 @@
 
 #include "Graph/ACFComboGraph.h"
 
+#include "ACFActionCondition.h"
 #include "ACFComboComponent.h"
 #include "Actions/ACFActionAbility.h"
+#include "Actors/ACFCharacter.h"
 #include "Engine/Engine.h"
 #include "Graph/ACFBaseComboNode.h"
 #include "Graph/ACFComboNode.h"
@@ -23,10 +25,33 @@ UACFComboGraph::UACFComboGraph()
     Enabled = EComboState::NotStarted;
 }
 
+void UACFComboGraph::PostLoad()
+{
+    Super::PostLoad();
+    CompileTransitions();
+}
+
+void UACFComboGraph::PostDuplicate(bool bDuplicateForPIE)
+{
+    Super::PostDuplicate(bDuplicateForPIE);
+    // the table of the source points to its own nodes
+    CompileTransitions();
+}
+
+void UACFComboGraph::ClearGraph()
+{
+    Super::ClearGraph();
+    // compiled again on the first transition after the graph is rebuilt
+    CompiledTable.Reset();
+    CompiledTransitions.Reset();
+    CompiledConditions.Reset();
+    bTransitionsCompiled = false;
+}
+
 void UACFComboGraph::StartCombo(const FGameplayTag& inStartAction)
 {
     DeactivateAllNodes();
-  
+
     for (UAGSGraphNode* root : RootNodes) {
         UACFStartComboNode* startNode = Cast<UACFStartComboNode>(root);
         if (startNode && startNode->GetTriggeringAction() == inStartAction) {
@@ -47,24 +72,19 @@ void UACFComboGraph::StopCombo()
 
 bool UACFComboGraph::PerformTransition(const FGameplayTag& inputTag, const ACharacter* Character)
 {
-    for (auto node : GetActiveNodes()) {
+    // the active nodes are changed only right before returning
+    for (UAGSGraphNode* node : ActivedNodes) {
         UACFBaseComboNode* comboNode = Cast<UACFBaseComboNode>(node);
         if (comboNode) {
             if (HandleRerouteNode(comboNode)) {
                 return true;
             }
 
-            // Collect and sort edges
-            TArray<TPair<UAGSGraphNode*, UACFTransition*>> SortedTransitions = GetSortedTransitions(comboNode);
-            // Check if AI and delegate logic
-            if (IsAI()) {
-                if (HandleAITransitions(SortedTransitions, inputTag, Character, comboNode)) {
-                    return true;
-                }
-            } else {
-                if (HandlePlayerTransitions(SortedTransitions, inputTag, Character, comboNode)) {
-                    return true;
-                }
+            UACFBaseComboNode* newNode = SelectNextNode(comboNode, inputTag, Character);
+            if (newNode) {
+                DeactivateNode(comboNode);
+                ActivateNode(newNode);
+                return true;
             }
         }
     }
@@ -72,78 +92,133 @@ bool UACFComboGraph::PerformTransition(const FGameplayTag& inputTag, const AChar
     return false; // No valid transition found
 }
 
-bool UACFComboGraph::HandleRerouteNode(UACFBaseComboNode* comboNode)
+UACFBaseComboNode* UACFComboGraph::SelectNextNode(const UAGSGraphNode* currentNode, const FGameplayTag& inputTag, const ACharacter* Character)
 {
-    UACFRerouteNode* rerouteNode = Cast<UACFRerouteNode>(comboNode);
-    if (rerouteNode) {
-        if (rerouteNode->TargetRerouteNode && rerouteNode->bIsProxyNode) {
-            DeactivateNode(rerouteNode);
-            ActivateNode(rerouteNode->TargetRerouteNode);
-            return true;
+    if (!bTransitionsCompiled) {
+        CompileTransitions();
+    }
+
+    const FCompiledTransitionRange* range = CompiledTable.Find(TPair<const UAGSGraphNode*, FGameplayTag>(currentNode, inputTag));
+    if (!range) {
+        return nullptr;
+    }
+
+    const AACFCharacter* acfCharacter = Cast<AACFCharacter>(Character);
+    const int32 firstWeighted = range->First + range->NumPrioritized;
+    for (int32 index = range->First; index < firstWeighted; index++) {
+        if (AreCompiledConditionsMet(CompiledTransitions[index], acfCharacter)) {
+            return CompiledTransitions[index].TargetNode;
         }
     }
 
-    return false;
+    // weighted transitions whose conditions are met are picked at random, proportionally to their weight
+    UACFBaseComboNode* selectedNode = nullptr;
+    float totalWeight = 0.f;
+    for (int32 index = firstWeighted; index < firstWeighted + range->NumWeighted; index++) {
+        const FCompiledTransition& transition = CompiledTransitions[index];
+        if (!AreCompiledConditionsMet(transition, acfCharacter)) {
+            continue;
+        }
+        totalWeight += transition.Weight;
+        if (!selectedNode || (transition.Weight > 0.f && FMath::FRand() * totalWeight < transition.Weight)) {
+            selectedNode = transition.TargetNode;
+        }
+    }
+    return selectedNode;
 }
 
-TArray<TPair<UAGSGraphNode*, UACFTransition*>> UACFComboGraph::GetSortedTransitions(UACFBaseComboNode* comboNode)
+bool UACFComboGraph::AreCompiledConditionsMet(const FCompiledTransition& transition, const AACFCharacter* acfCharacter) const
 {
-    TArray<TPair<UAGSGraphNode*, UACFTransition*>> SortedTransitions;
-
-    for (auto edge : comboNode->Edges) {
-        UAGSGraphNode* TargetNode = Cast<UAGSGraphNode>(edge.Key);
-        UACFTransition* Transition = Cast<UACFTransition>(edge.Value);
-
-        if (TargetNode && Transition) {
-            SortedTransitions.Add(TPair<UAGSGraphNode*, UACFTransition*>(TargetNode, Transition));
-        }
+    if (!transition.bHasConditions) {
+        return true;
+    }
+    if (!acfCharacter) {
+        return false;
     }
 
-    SortedTransitions.Sort([](const TPair<UAGSGraphNode*, UACFTransition*>& A, const TPair<UAGSGraphNode*, UACFTransition*>& B) {
-        if (A.Value->bUseWeightedPriorities && B.Value->bUseWeightedPriorities) {
-            float TotalWeight = A.Value->Weight + B.Value->Weight;
-            float ProbabilityA = A.Value->Weight / TotalWeight;
-            return FMath::FRand() < ProbabilityA;
-        } else if (A.Value->bUseWeightedPriorities) {
+    const int32 lastCondition = transition.FirstCondition + transition.NumConditions;
+    for (int32 index = transition.FirstCondition; index < lastCondition; index++) {
+        if (!CompiledConditions[index]->IsConditionMet(acfCharacter)) {
             return false;
-        } else if (B.Value->bUseWeightedPriorities) {
-            return true;
         }
-        return A.Value->Priority > B.Value->Priority;
-    });
-
-    // Filter sorted transitions by valid pair.key
-    SortedTransitions = SortedTransitions.FilterByPredicate([](const TPair<UAGSGraphNode*, UACFTransition*>& Pair) {
-        return Pair.Key != nullptr;
-    });
-
-    return SortedTransitions;
+    }
+    return true;
 }
 
-bool UACFComboGraph::HandleAITransitions(
-    const TArray<TPair<UAGSGraphNode*, UACFTransition*>>& Transitions,
-    const FGameplayTag& currentInput,
-    const ACharacter* Character,
-    UACFBaseComboNode* CurrentNode)
+void UACFComboGraph::CompileTransitions()
 {
+    CompiledTable.Reset();
+    CompiledTransitions.Reset();
+    CompiledConditions.Reset();
+
+    TMap<FGameplayTag, TArray<FCompiledTransition>> nodeTransitions;
+    for (UAGSGraphNode* node : AllNodes) {
+        if (!Cast<UACFBaseComboNode>(node)) {
+            continue;
+        }
 
-    // Evaluate transitions based on the simulated input
-    for (const auto& Pair : Transitions) {
-        UAGSGraphNode* TargetNode = Pair.Key;
-        UACFTransition* Transition = Pair.Value;
+        nodeTransitions.Reset();
+        for (const auto& edge : node->Edges) {
+            UACFBaseComboNode* targetNode = Cast<UACFBaseComboNode>(edge.Key);
+            UACFTransition* transition = Cast<UACFTransition>(edge.Value);
+            if (!targetNode || !transition) {
+                continue;
+            }
 
-        if (Transition->GetTransitionInputTag() == currentInput && Transition->AreConditionsMet(Character)) {
-            UACFBaseComboNode* newNode = Cast<UACFBaseComboNode>(TargetNode);
-            ensure(newNode);
+            FCompiledTransition compiled;
+            compiled.TargetNode = targetNode;
+            compiled.Transition = transition;
+            compiled.bHasConditions = transition->GetConditions().Num() > 0;
+            compiled.bWeighted = transition->bUseWeightedPriorities;
+            compiled.Weight = FMath::Max(transition->Weight, 0.f);
+            compiled.FirstCondition = CompiledConditions.Num();
+            for (UACFActionCondition* condition : transition->GetConditions()) {
+                if (condition) {
+                    CompiledConditions.Add(condition);
+                }
+            }
+            compiled.NumConditions = CompiledConditions.Num() - compiled.FirstCondition;
+            nodeTransitions.FindOrAdd(transition->GetTransitionInputTag()).Add(compiled);
+        }
 
-            DeactivateNode(CurrentNode);
-            ActivateNode(newNode);
+        for (TPair<FGameplayTag, TArray<FCompiledTransition>>& input : nodeTransitions) {
+            TArray<FCompiledTransition>& transitions = input.Value;
+            transitions.StableSort([](const FCompiledTransition& A, const FCompiledTransition& B) {
+                if (A.bWeighted != B.bWeighted) {
+                    return B.bWeighted;
+                }
+                return !A.bWeighted && A.Transition->Priority > B.Transition->Priority;
+            });
+
+            FCompiledTransitionRange range;
+            range.First = CompiledTransitions.Num();
+            for (const FCompiledTransition& transition : transitions) {
+                if (transition.bWeighted) {
+                    range.NumWeighted++;
+                } else {
+                    range.NumPrioritized++;
+                }
+            }
+            CompiledTransitions.Append(transitions);
+            CompiledTable.Add(TPair<const UAGSGraphNode*, FGameplayTag>(node, input.Key), range);
+        }
+    }
 
+    bTransitionsCompiled = true;
+}
+
+bool UACFComboGraph::HandleRerouteNode(UACFBaseComboNode* comboNode)
+{
+    UACFRerouteNode* rerouteNode = Cast<UACFRerouteNode>(comboNode);
+    if (rerouteNode) {
+        if (rerouteNode->TargetRerouteNode && rerouteNode->bIsProxyNode) {
+            DeactivateNode(rerouteNode);
+            ActivateNode(rerouteNode->TargetRerouteNode);
             return true;
         }
     }
 
-    return false; // No valid transition found
+    return false;
 }
 
 void UACFComboGraph::SetIsAI(bool bInIsAI)
@@ -175,29 +250,6 @@ TArray<FGameplayTag> UACFComboGraph::GetValidInputsForCurrentNode() const
     return ValidInputs;
 }
 
-bool UACFComboGraph::HandlePlayerTransitions(
-    const TArray<TPair<UAGSGraphNode*, UACFTransition*>>& Transitions,
-    const FGameplayTag& currentInput,
-    const ACharacter* Character,
-    UACFBaseComboNode* CurrentNode)
-{
-    for (const auto& Pair : Transitions) {
-        UAGSGraphNode* TargetNode = Pair.Key;
-        UACFTransition* Transition = Pair.Value;
-
-        if (Transition->GetTransitionInputTag() == currentInput && Transition->AreConditionsMet(Character)) {
-            UACFBaseComboNode* newNode = Cast<UACFBaseComboNode>(TargetNode);
-            ensure(newNode);
-
-            DeactivateNode(CurrentNode);
-            ActivateNode(newNode);
-
-            return true;
-        }
-    }
-    return false;
-}
-
 FGameplayTag UACFComboGraph::GetTriggeringAction() const
 {
     return triggeringAction;
@@ -3,13 +3,14 @@
 #include "Graph/ACFTransition.h"
 #include "ACFActionCondition.h"
 #include "Actors/ACFCharacter.h"
+#include "Graph/ACFComboGraph.h"
 #include "Logging.h"
 
 
 bool UACFTransition::AreConditionsMet(const ACharacter* Character) const
 {
     // If no conditions are set, the transition is automatically valid
-    UE_LOG(ACFLog, Warning, TEXT("No of Conditions: %d"), Conditions.Num());
+    UE_LOG(ACFLog, Verbose, TEXT("No of Conditions: %d"), Conditions.Num());
     if (Conditions.Num() == 0) {
         return true;
     }
@@ -26,7 +27,7 @@ bool UACFTransition::AreConditionsMet(const ACharacter* Character) const
     }
 
     // Log the successful casting
-    UE_LOG(ACFLog, Warning, TEXT("Successfully cast character to AACFCharacter: %s"), *ACFCharacter->GetName());
+    UE_LOG(ACFLog, Verbose, TEXT("Successfully cast character to AACFCharacter: %s"), *ACFCharacter->GetName());
 
     // Evaluate each condition
     for (UACFActionCondition* Condition : Conditions) {
@@ -38,16 +39,28 @@ bool UACFTransition::AreConditionsMet(const ACharacter* Character) const
         const bool bConditionMet = Condition->IsConditionMet(ACFCharacter);
 
         // Log the result of the condition
-        UE_LOG(ACFLog, Warning, TEXT("Condition %s evaluated to: %s"),
+        UE_LOG(ACFLog, Verbose, TEXT("Condition %s evaluated to: %s"),
             *Condition->GetName(), bConditionMet ? TEXT("True") : TEXT("False"));
 
         if (!bConditionMet) {
-            UE_LOG(ACFLog, Warning, TEXT("Condition %s failed!"), *Condition->GetName());
+            UE_LOG(ACFLog, Verbose, TEXT("Condition %s failed!"), *Condition->GetName());
             return false; // Fail if any condition is not met
         }
     }
 
-    UE_LOG(ACFLog, Warning, TEXT("All conditions passed for transition"));
+    UE_LOG(ACFLog, Verbose, TEXT("All conditions passed for transition"));
     return true; // All conditions passed
 }
 
+#if WITH_EDITOR
+void UACFTransition::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+
+    // input, priorities and conditions are part of the compiled table of the graph
+    UACFComboGraph* comboGraph = Cast<UACFComboGraph>(Graph);
+    if (comboGraph) {
+        comboGraph->CompileTransitions();
+    }
+}
+#endif
@@ -124,7 +124,7 @@ protected:
 
 private:
     UFUNCTION()
-    void HandleComboInputReceived(UInputAction* input);
+    void HandleComboInputReceived(FGameplayTag inputTag);
 
     void StopCurrentCombo();
 
@@ -18,6 +18,8 @@ class UACFActionAbility;
 class UACFTransition;
 class ACharacter;
 class UACFComboComponent;
+class UACFActionCondition;
+class AACFCharacter;
 
 /**
  *
@@ -82,6 +84,23 @@ public:
     UFUNCTION(BlueprintCallable, Category = ACF)
     bool PerformTransition(const FGameplayTag& currentInput, const ACharacter* Character);
 
+    /**
+     * Selects the node the combo moves to when the provided input is received on a node, without activating it.
+     * @param currentNode The node the transition starts from.
+     * @param inputTag The gameplay tag identifying the input action.
+     * @param Character The character attempting the transition.
+     * @return The next combo node, or nullptr if no transition of the node accepts the input.
+     */
+    UACFBaseComboNode* SelectNextNode(const UAGSGraphNode* currentNode, const FGameplayTag& inputTag, const ACharacter* Character);
+
+    /**
+     * Rebuilds the transition table from the edges of the graph.
+     * The graph is compiled on load, call it again if nodes, edges or their conditions are changed at runtime.
+     */
+    void CompileTransitions();
+
+    virtual void ClearGraph() override;
+
     /**
      * Gets the tag that triggered the current combo sequence.
      * @return The gameplay tag that initiated the combo.
@@ -129,13 +148,43 @@ private:
 
     FGameplayTag triggeringAction;
 
+    /** Transition of the compiled table, with its target and the non null conditions of the edge */
+    struct FCompiledTransition {
+        UACFBaseComboNode* TargetNode = nullptr;
+        UACFTransition* Transition = nullptr;
+        int32 FirstCondition = 0;
+        int32 NumConditions = 0;
+        // true if the edge has any condition entry, which requires an ACF character to be met
+        bool bHasConditions = false;
+        bool bWeighted = false;
+        float Weight = 0.f;
+    };
+
+    /** Transitions leaving a node for an input: prioritized ones by descending priority, then the weighted ones */
+    struct FCompiledTransitionRange {
+        int32 First = 0;
+        int32 NumPrioritized = 0;
+        int32 NumWeighted = 0;
+    };
+
+    /** (node, input tag) -> range of CompiledTransitions */
+    TMap<TPair<const UAGSGraphNode*, FGameplayTag>, FCompiledTransitionRange> CompiledTable;
+
+    TArray<FCompiledTransition> CompiledTransitions;
+
+    /** Conditions of all the compiled transitions, kept alive by the edges that own them */
+    TArray<UACFActionCondition*> CompiledConditions;
+
+    bool bTransitionsCompiled = false;
+
+    bool AreCompiledConditionsMet(const FCompiledTransition& transition, const AACFCharacter* acfCharacter) const;
+
 protected:
     virtual bool ActivateNode(class UAGSGraphNode* node) override;
+    virtual void PostLoad() override;
+    virtual void PostDuplicate(bool bDuplicateForPIE) override;
     // New Methods
     bool HandleRerouteNode(UACFBaseComboNode* comboNode);
-    TArray<TPair<UAGSGraphNode*, UACFTransition*>> GetSortedTransitions(UACFBaseComboNode* comboNode);
-    bool HandleAITransitions(const TArray<TPair<UAGSGraphNode*, UACFTransition*>>& Transitions, const FGameplayTag& currentInput, const ACharacter* Character, UACFBaseComboNode* CurrentNode);
-    bool HandlePlayerTransitions(const TArray<TPair<UAGSGraphNode*, UACFTransition*>>& Transitions, const FGameplayTag& currentInput, const ACharacter* Character, UACFBaseComboNode* CurrentNode);
     // AI-specific state
     UPROPERTY()
     bool bIsAI;
@@ -34,6 +34,8 @@ public:
         return ComboMontage;
     }
 
+    void SetMontage(UAnimMontage* inMontage) { ComboMontage = inMontage; }
+
     UFUNCTION(Blueprintpure, Category = ACF)
     FAttributesSetModifier GetComboNodeModifier() const
     {
@@ -36,6 +36,8 @@ public:
         return triggeringAction;
     }
 
+    void SetTriggeringAction(const FGameplayTag& inTriggeringAction) { triggeringAction = inTriggeringAction; }
+
 protected:
     UPROPERTY(EditAnywhere, Category = ACF)
     FGameplayTag triggeringAction;
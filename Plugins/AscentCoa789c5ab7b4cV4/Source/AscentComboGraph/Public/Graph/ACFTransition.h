@@ -33,6 +33,16 @@ public:
         return TransitionInputTag;
     }
 
+    const TArray<UACFActionCondition*>& GetConditions() const
+    {
+        return Conditions;
+    }
+
+    /* Input and conditions are compiled by the graph, it must be compiled again after they change */
+    void SetTransitionInputTag(const FGameplayTag& inTransitionInputTag) { TransitionInputTag = inTransitionInputTag; }
+
+    void SetConditions(const TArray<UACFActionCondition*>& inConditions) { Conditions = inConditions; }
+
     /** Use weighted priorities instead of traditional sorting */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ACF")
     bool bUseWeightedPriorities = false;
@@ -47,4 +57,8 @@ public:
     // Evaluate all conditions to check if the transition is valid
     UFUNCTION(BlueprintCallable, Category = ACF)
     bool AreConditionsMet(const class ACharacter* Character) const;
+
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 };
@@ -43,7 +43,10 @@ public class AscentComboGraphEditor : ModuleRules {
                 "Engine",
                 "Slate",
                 "SlateCore",
-                 "AscentComboGraph"
+                 "AscentComboGraph",
+                 "AIFramework",
+                 "AscentCombatFramework",
+                 "AscentEditorExtensions"
                 // ... add private dependencies that you statically link with here ...
             });
 
@@ -0,0 +1,60 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "ACFActionCondition.h"
+#include "Animation/AnimMontage.h"
+#include "CoreMinimal.h"
+#include "Graph/ACFComboGraph.h"
+#include "Graph/ACFComboNode.h"
+#include "Graph/ACFStartComboNode.h"
+#include "Graph/ACFTransition.h"
+
+/**
+ * Builds combo graphs in code for the transition benchmark and tests.
+ */
+struct FACFComboGraphBuilder {
+    UACFComboGraph* Graph = nullptr;
+
+    FACFComboGraphBuilder()
+    {
+        Graph = NewObject<UACFComboGraph>(GetTransientPackage());
+    }
+
+    UACFStartComboNode* AddStartNode(const FGameplayTag& triggeringAction)
+    {
+        UACFStartComboNode* node = AddNode<UACFStartComboNode>();
+        node->SetTriggeringAction(triggeringAction);
+        Graph->RootNodes.Add(node);
+        return node;
+    }
+
+    template <typename TNode = UACFComboNode>
+    TNode* AddNode()
+    {
+        TNode* node = NewObject<TNode>(Graph);
+        node->Graph = Graph;
+        node->SetMontage(NewObject<UAnimMontage>(node));
+        Graph->AllNodes.Add(node);
+        return node;
+    }
+
+    UACFTransition* Connect(UAGSGraphNode* from, UAGSGraphNode* to, const FGameplayTag& inputTag, int32 priority, UACFActionCondition* condition = nullptr)
+    {
+        UACFTransition* transition = NewObject<UACFTransition>(Graph);
+        transition->Graph = Graph;
+        transition->StartNode = from;
+        transition->EndNode = to;
+        transition->Priority = priority;
+        transition->SetTransitionInputTag(inputTag);
+        if (condition) {
+            condition->Rename(nullptr, transition);
+            transition->SetConditions({ condition });
+        }
+
+        from->ChildrenNodes.Add(to);
+        from->Edges.Add(to, transition);
+        to->ParentNodes.Add(from);
+        return transition;
+    }
+};
@@ -0,0 +1,146 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ACFComboTransitionBenchmarkCommandlet.h"
+#include "ACFComboGraphBuilder.h"
+#include "Actors/ACFCharacter.h"
+#include "Engine/World.h"
+#include "GameplayTagsManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogACFComboTransitionBenchmark, Log, All);
+
+UACFComboTransitionBenchmarkCommandlet::UACFComboTransitionBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UACFComboTransitionBenchmarkCommandlet::Main(const FString& Params)
+{
+    int32 numNodes = 64;
+    int32 numEdges = 6;
+    int32 numInputs = 4;
+    int32 numPresses = 200000;
+    int32 conditionPercent = 30;
+    int32 seed = 1;
+    FParse::Value(*Params, TEXT("Nodes="), numNodes);
+    FParse::Value(*Params, TEXT("Edges="), numEdges);
+    FParse::Value(*Params, TEXT("Inputs="), numInputs);
+    FParse::Value(*Params, TEXT("Presses="), numPresses);
+    FParse::Value(*Params, TEXT("Conditions="), conditionPercent);
+    FParse::Value(*Params, TEXT("Seed="), seed);
+    numNodes = FMath::Max(numNodes, 2);
+    numEdges = FMath::Clamp(numEdges, 1, numNodes - 1);
+    numInputs = FMath::Max(numInputs, 1);
+    numPresses = FMath::Max(numPresses, 1);
+
+    // the inputs and the triggering action are taken from the tags registered by the project
+    FGameplayTagContainer registeredTags;
+    UGameplayTagsManager::Get().RequestAllGameplayTags(registeredTags, true);
+    TArray<FGameplayTag> tags;
+    registeredTags.GetGameplayTagArray(tags);
+    if (tags.Num() < numInputs + 1) {
+        UE_LOG(LogACFComboTransitionBenchmark, Error, TEXT("The project registers %d gameplay tags, %d are needed"), tags.Num(), numInputs + 1);
+        return 1;
+    }
+    const FGameplayTag triggeringAction = tags[0];
+    const TArray<FGameplayTag> inputTags(tags.GetData() + 1, numInputs);
+
+    UWorld* world = UWorld::CreateWorld(EWorldType::Game, false);
+    if (!world) {
+        UE_LOG(LogACFComboTransitionBenchmark, Error, TEXT("Unable to create the benchmark world"));
+        return 1;
+    }
+    const AACFCharacter* character = world->SpawnActor<AACFCharacter>(AACFCharacter::StaticClass(), FTransform::Identity);
+
+    FRandomStream random(seed);
+    FACFComboGraphBuilder builder;
+    UACFComboGraph* graph = builder.Graph;
+    TArray<UACFComboNode*> nodes;
+    nodes.Add(builder.AddStartNode(triggeringAction));
+    for (int32 index = 1; index < numNodes; index++) {
+        nodes.Add(builder.AddNode());
+    }
+
+    TArray<int32> targets;
+    TArray<int32> priorities;
+    int32 numConditions = 0;
+    for (UACFComboNode* node : nodes) {
+        targets.Reset();
+        priorities.Reset();
+        for (int32 index = 1; index < numNodes; index++) {
+            if (nodes[index] != node) {
+                targets.Add(index);
+            }
+        }
+        for (int32 index = 0; index < numEdges; index++) {
+            priorities.Add(index);
+        }
+        for (int32 index = targets.Num() - 1; index > 0; index--) {
+            targets.Swap(index, random.RandRange(0, index));
+        }
+        for (int32 index = priorities.Num() - 1; index > 0; index--) {
+            priorities.Swap(index, random.RandRange(0, index));
+        }
+
+        const int32 nodeEdges = FMath::Min(numEdges, targets.Num());
+        for (int32 edge = 0; edge < nodeEdges; edge++) {
+            UACFActionCondition* condition = nullptr;
+            if (random.RandRange(0, 99) < conditionPercent) {
+                // empty AND conditions are met, empty OR conditions are not
+                const TSubclassOf<UACFActionCondition> conditionClass = random.RandRange(0, 1) == 0 ? UACFANDActionCondition::StaticClass() : UACFORActionCondition::StaticClass();
+                condition = NewObject<UACFActionCondition>(graph, conditionClass);
+                numConditions++;
+            }
+            builder.Connect(node, nodes[targets[edge]], inputTags[random.RandRange(0, numInputs - 1)], priorities[edge], condition);
+        }
+    }
+
+    const double compileStart = FPlatformTime::Seconds();
+    graph->CompileTransitions();
+    const double compileTime = FPlatformTime::Seconds() - compileStart;
+
+    TArray<int32> presses;
+    presses.SetNumUninitialized(numPresses);
+    for (int32 press = 0; press < numPresses; press++) {
+        presses[press] = random.RandRange(0, numInputs - 1);
+    }
+
+    UACFBaseComboNode* currentNode = nodes[0];
+    const double selectStart = FPlatformTime::Seconds();
+    for (int32 press = 0; press < numPresses; press++) {
+        UACFBaseComboNode* nextNode = graph->SelectNextNode(currentNode, inputTags[presses[press]], character);
+        currentNode = nextNode ? nextNode : nodes[0];
+    }
+    const double selectTime = FPlatformTime::Seconds() - selectStart;
+
+    // full transitions up to the montage to play, a dropped combo starts again from the triggering action
+    int32 numMontages = 0;
+    graph->StartCombo(triggeringAction);
+    const double transitionStart = FPlatformTime::Seconds();
+    for (int32 press = 0; press < numPresses; press++) {
+        if (!graph->PerformTransition(inputTags[presses[press]], character)) {
+            graph->StartCombo(triggeringAction);
+        }
+        if (graph->GetCurrentComboMontage()) {
+            numMontages++;
+        }
+    }
+    const double transitionTime = FPlatformTime::Seconds() - transitionStart;
+
+    UE_LOG(LogACFComboTransitionBenchmark, Display, TEXT("Nodes %d | Edges per node %d | Inputs %d | Conditions %d | Presses %d"),
+        numNodes, numEdges, numInputs, numConditions, numPresses);
+    UE_LOG(LogACFComboTransitionBenchmark, Display, TEXT("Compile: %.3f ms"), compileTime * 1000.0);
+    UE_LOG(LogACFComboTransitionBenchmark, Display, TEXT("Next node selection: %.2f ms | %.0f ns/input"),
+        selectTime * 1000.0, selectTime * 1.0e9 / numPresses);
+    UE_LOG(LogACFComboTransitionBenchmark, Display, TEXT("Full transitions: %.2f ms | %.0f ns/input | %d montages"),
+        transitionTime * 1000.0, transitionTime * 1.0e9 / numPresses, numMontages);
+
+    graph->StopCombo();
+    world->DestroyWorld(false);
+
+    return 0;
+}
@@ -0,0 +1,137 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ACFComboGraphBuilder.h"
+#include "Actors/ACFCharacter.h"
+#include "NativeGameplayTags.h"
+#include "Tests/ACFAutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace {
+// registered by this module, the tests never depend on the tags of the project
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_ACFTest_Combo_Trigger, "ACF.Test.Combo.Trigger");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_ACFTest_Combo_FirstInput, "ACF.Test.Combo.Input.First");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_ACFTest_Combo_SecondInput, "ACF.Test.Combo.Input.Second");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_ACFTest_Combo_UnusedInput, "ACF.Test.Combo.Input.Unused");
+
+template <typename TCondition>
+TCondition* MakeCondition(UObject* outer)
+{
+    return NewObject<TCondition>(outer);
+}
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FACFComboTransitionPriorityTest, "ACF.ComboGraph.Transitions.Priority")
+
+bool FACFComboTransitionPriorityTest::RunTest(const FString& Parameters)
+{
+    const FGameplayTag triggeringAction = TAG_ACFTest_Combo_Trigger;
+    const FGameplayTag firstInput = TAG_ACFTest_Combo_FirstInput;
+    const FGameplayTag secondInput = TAG_ACFTest_Combo_SecondInput;
+    const FGameplayTag unusedInput = TAG_ACFTest_Combo_UnusedInput;
+
+    FACFComboGraphBuilder builder;
+    UACFStartComboNode* start = builder.AddStartNode(triggeringAction);
+    UACFComboNode* low = builder.AddNode();
+    UACFComboNode* high = builder.AddNode();
+    UACFComboNode* other = builder.AddNode();
+    builder.Connect(start, low, firstInput, 1);
+    builder.Connect(start, high, firstInput, 5);
+    builder.Connect(start, other, secondInput, 3);
+    builder.Connect(high, low, secondInput, 0);
+    builder.Graph->CompileTransitions();
+
+    UACFComboGraph* graph = builder.Graph;
+    TestTrue("Highest priority transition of the input is picked", graph->SelectNextNode(start, firstInput, nullptr) == high);
+    TestTrue("Transitions of other inputs are ignored", graph->SelectNextNode(start, secondInput, nullptr) == other);
+    TestTrue("Input without transitions selects nothing", graph->SelectNextNode(start, unusedInput, nullptr) == nullptr);
+    TestTrue("Transitions are picked from the provided node", graph->SelectNextNode(high, secondInput, nullptr) == low);
+    TestTrue("Node without transitions selects nothing", graph->SelectNextNode(other, firstInput, nullptr) == nullptr);
+
+    // a full combo plays the montage of every node it reaches, and stops on an input without transitions
+    graph->StartCombo(triggeringAction);
+    TestTrue("Combo starts from the triggering action", graph->IsActive() && graph->GetCurrentComboNode() == start);
+    TestTrue("Transition is performed", graph->PerformTransition(firstInput, nullptr));
+    TestTrue("Combo moves to the picked node", graph->GetCurrentComboNode() == high);
+    TestTrue("Montage of the picked node is played", graph->GetCurrentComboMontage() == high->GetMontage());
+    TestTrue("Transition is performed from the new node", graph->PerformTransition(secondInput, nullptr) && graph->GetCurrentComboNode() == low);
+    TestFalse("Input without transitions fails", graph->PerformTransition(firstInput, nullptr));
+    TestFalse("Failed transition stops the combo", graph->IsActive());
+    return true;
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FACFComboTransitionConditionsTest, "ACF.ComboGraph.Transitions.Conditions")
+
+bool FACFComboTransitionConditionsTest::RunTest(const FString& Parameters)
+{
+    const FGameplayTag triggeringAction = TAG_ACFTest_Combo_Trigger;
+    const FGameplayTag firstInput = TAG_ACFTest_Combo_FirstInput;
+
+    FACFTestWorld testWorld;
+    AACFCharacter* character = testWorld.SpawnActor<AACFCharacter>();
+    FACFComboGraphBuilder builder;
+    UACFComboGraph* graph = builder.Graph;
+    UACFStartComboNode* start = builder.AddStartNode(triggeringAction);
+    UACFComboNode* orNode = builder.AddNode();
+    UACFComboNode* andNode = builder.AddNode();
+    UACFComboNode* fallbackNode = builder.AddNode();
+
+    // an OR of a single met condition is met, an AND containing an empty OR is not
+    UACFORActionCondition* metOr = MakeCondition<UACFORActionCondition>(graph);
+    metOr->OrConditions.Add(MakeCondition<UACFANDActionCondition>(metOr));
+    UACFANDActionCondition* unmetAnd = MakeCondition<UACFANDActionCondition>(graph);
+    unmetAnd->AndConditions.Add(MakeCondition<UACFORActionCondition>(unmetAnd));
+
+    builder.Connect(start, andNode, firstInput, 10, unmetAnd);
+    builder.Connect(start, orNode, firstInput, 5, metOr);
+    builder.Connect(start, fallbackNode, firstInput, 1);
+    graph->CompileTransitions();
+
+    TestTrue("Unmet conditions skip the transition", graph->SelectNextNode(start, firstInput, character) == orNode);
+    TestTrue("Conditions are never met without an ACF character", graph->SelectNextNode(start, firstInput, nullptr) == fallbackNode);
+
+    // conditions are evaluated on every input, only the edges are compiled
+    unmetAnd->AndConditions.Reset();
+    TestTrue("Conditions changed after compiling are evaluated", graph->SelectNextNode(start, firstInput, character) == andNode);
+    return true;
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FACFComboTransitionCompileTest, "ACF.ComboGraph.Transitions.Recompile")
+
+bool FACFComboTransitionCompileTest::RunTest(const FString& Parameters)
+{
+    const FGameplayTag triggeringAction = TAG_ACFTest_Combo_Trigger;
+    const FGameplayTag firstInput = TAG_ACFTest_Combo_FirstInput;
+    const FGameplayTag secondInput = TAG_ACFTest_Combo_SecondInput;
+
+    FACFComboGraphBuilder builder;
+    UACFComboGraph* graph = builder.Graph;
+    UACFStartComboNode* start = builder.AddStartNode(triggeringAction);
+    UACFComboNode* first = builder.AddNode();
+    UACFComboNode* second = builder.AddNode();
+    UACFComboNode* weighted = builder.AddNode();
+    UACFComboNode* prioritized = builder.AddNode();
+
+    builder.Connect(start, first, firstInput, 1);
+    TestTrue("Graph is compiled on the first selection", graph->SelectNextNode(start, firstInput, nullptr) == first);
+
+    builder.Connect(start, second, firstInput, 5);
+    UACFTransition* weightedTransition = builder.Connect(start, weighted, secondInput, 100);
+    weightedTransition->bUseWeightedPriorities = true;
+    TestTrue("Edges added after compiling are ignored", graph->SelectNextNode(start, firstInput, nullptr) == first);
+
+    graph->CompileTransitions();
+    TestTrue("Recompiled graph picks the new edges", graph->SelectNextNode(start, firstInput, nullptr) == second);
+    TestTrue("Weighted transition is picked when it is the only one", graph->SelectNextNode(start, secondInput, nullptr) == weighted);
+
+    // prioritized transitions always win over the weighted ones, whatever their priority
+    builder.Connect(start, prioritized, secondInput, 0);
+    graph->CompileTransitions();
+    TestTrue("Prioritized transitions are picked before the weighted ones", graph->SelectNextNode(start, secondInput, nullptr) == prioritized);
+
+    graph->ClearGraph();
+    TestTrue("Cleared graph selects nothing", graph->SelectNextNode(start, firstInput, nullptr) == nullptr);
+    return true;
+}
+
+#endif
@@ -0,0 +1,22 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "CoreMinimal.h"
+
+#include "ACFComboTransitionBenchmarkCommandlet.generated.h"
+
+/**
+ * Benchmarks the input-to-montage decision of UACFComboGraph on a generated graph.
+ * Usage: UnrealEditor-Cmd.exe Project.uproject -run=ACFComboTransitionBenchmark -Nodes=64 -Edges=6 -Inputs=4 -Presses=200000 -Seed=1
+ */
+UCLASS()
+class ASCENTCOMBOGRAPHEDITOR_API UACFComboTransitionBenchmarkCommandlet : public UCommandlet {
+    GENERATED_BODY()
+
+public:
+    UACFComboTransitionBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
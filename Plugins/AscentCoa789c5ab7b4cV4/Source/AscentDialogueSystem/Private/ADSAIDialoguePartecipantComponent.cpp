@@ -5,6 +5,7 @@
 #include "ADSDialogueFunctionLibrary.h"
 #include "ADSDialogueMasterComponent.h"
 #include "Animation/AnimInstance.h"
+#include "Async/Async.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "GameFramework/Character.h"
 #include "Http.h"
@@ -12,6 +13,8 @@
 #include <Kismet/GameplayStatics.h>
 #include <TimerManager.h>
 
+DEFINE_LOG_CATEGORY_STATIC(LogADSAIDialogue, Log, All);
+
 // Constructor
 UADSAIDialoguePartecipantComponent::UADSAIDialoguePartecipantComponent()
 {
@@ -46,8 +49,10 @@ void UADSAIDialoguePartecipantComponent::BeginPlay()
 void UADSAIDialoguePartecipantComponent::EndPlay(EEndPlayReason::Type reason)
 {
     Super::EndPlay(reason);
+    RequestSerial++;
     ConversationHistory.Empty();
     StructuredConversationHistory.Empty();
+    ConversationBuffer.Reset();
     SetAIDialogueState(EAIDialogueState::Idle);
     bIsFirstResponse = true;
 }
@@ -106,7 +111,7 @@ bool UADSAIDialoguePartecipantComponent::StartAIDialogue(const FString& PlayerMe
     }
 
     // Check configuration
-    if (!IsAIDialogueEnabled() || GetAPIKey().IsEmpty()) {
+    if (!IsAIDialogueEnabled() || (!bUseMockEndpoint && GetAPIKey().IsEmpty())) {
         FString ErrorMsg = "AI Dialogue not properly configured";
         UE_LOG(LogTemp, Error, TEXT("%s"), *ErrorMsg);
         LastErrorMessage = ErrorMsg;
@@ -133,6 +138,7 @@ bool UADSAIDialoguePartecipantComponent::StartAIDialogue(const FString& PlayerMe
 
     ConversationHistory.Empty();
     StructuredConversationHistory.Empty();
+    ConversationBuffer.Reset();
     bIsFirstResponse = true;
     OnDialogueStarted.Broadcast(nullptr);
 
@@ -160,7 +166,7 @@ bool UADSAIDialoguePartecipantComponent::ProgressAIDialogue(const FString& Playe
     }
 
     // Check configuration
-    if (!IsAIDialogueEnabled() || GetAPIKey().IsEmpty()) {
+    if (!IsAIDialogueEnabled() || (!bUseMockEndpoint && GetAPIKey().IsEmpty())) {
         FString ErrorMsg = "AI Dialogue not properly configured";
         UE_LOG(LogTemp, Error, TEXT("%s"), *ErrorMsg);
         LastErrorMessage = ErrorMsg;
@@ -208,60 +214,83 @@ void UADSAIDialoguePartecipantComponent::GenerateAIResponse(const FString& Playe
     // Add player message to conversation history
     AddToConversationHistory(TEXT("Player"), PlayerInput);
 
-    // Build comprehensive SystemPrompt with all AI parameters
-    FString SystemPrompt;
-
-    // Basic character information
-    SystemPrompt += FString::Printf(TEXT("You are %s.\n"), *GetParticipantName().ToString());
-
-    // Add personality if available (no hardcoded restrictions)
-    if (!GetAIPersonality().IsEmpty()) {
-        SystemPrompt += FString::Printf(TEXT("Personality: %s\n"), *GetAIPersonality());
-    }
-
-    // Add character description if available (no hardcoded restrictions)
-    if (!GetAICharacterDescription().IsEmpty()) {
-        SystemPrompt += FString::Printf(TEXT("Description: %s\n"), *GetAICharacterDescription());
+    UADSDialogueDeveloperSettings* Settings = GetDialogueSettings();
+    if (!Settings) {
+        FString ErrorMsg = "Cannot access dialogue settings";
+        UE_LOG(LogTemp, Error, TEXT("%s"), *ErrorMsg);
+        LastErrorMessage = ErrorMsg;
+        SetAIDialogueState(EAIDialogueState::Error);
+        OnAIResponseReceived.Broadcast(ErrorMsg, false, false);
+        return;
     }
 
-    // Add behavioral rules if available (no hardcoded restrictions)
-    if (!GetAICharacterRules().IsEmpty()) {
-        SystemPrompt += FString::Printf(TEXT("Rules:\n%s\n"), *GetAICharacterRules());
+    // Validate the template once instead of parsing every payload, inserted values are always escaped
+    const FString PayloadTemplate = Settings->GetAIPayloadTemplate();
+    if (!ValidatePayloadTemplate(PayloadTemplate)) {
+        FString ErrorMsg = "Generated JSON payload is invalid - check template configuration";
+        UE_LOG(LogTemp, Error, TEXT("%s"), *ErrorMsg);
+        UE_LOG(LogTemp, Error, TEXT("Invalid JSON template: %s"), *PayloadTemplate);
+        LastErrorMessage = ErrorMsg;
+        SetAIDialogueState(EAIDialogueState::Error);
+        OnAIResponseReceived.Broadcast(ErrorMsg, false, false);
+        return;
     }
 
-    // Add conversation context if we have history
-    if (StructuredConversationHistory.Num() > 1) {
-        SystemPrompt += TEXT("\nConversation context (recent exchanges):\n");
-
-        // Add the last few exchanges for context (excluding the current player message we just added)
-        int32 StartIndex = FMath::Max(0, StructuredConversationHistory.Num() - (MaxConversationHistory * 2));
-        for (int32 i = StartIndex; i < StructuredConversationHistory.Num() - 1; i++) {
-            const FADSConversationEntry& Entry = StructuredConversationHistory[i];
-            SystemPrompt += FString::Printf(TEXT("%s: %s\n"), *Entry.Speaker, *Entry.Message);
+    if (ConversationBuffer.Num() != StructuredConversationHistory.Num()) {
+        // history edited from outside, format it again
+        ConversationBuffer.Reset();
+        for (const FADSConversationEntry& Entry : StructuredConversationHistory) {
+            ConversationBuffer.Append(Entry.Speaker, Entry.Message);
         }
-        SystemPrompt += TEXT("\n");
-    }
-
-    // Add additional context if provided
-    if (!Context.IsEmpty()) {
-        SystemPrompt += FString::Printf(TEXT("Current context: %s\n"), *Context);
     }
 
-    // Final instruction
-    SystemPrompt += TEXT("Respond naturally to the player's message, staying in character and considering the conversation history.");
+    // Capture everything needed on the game thread, history lines are shared and not copied
+    FADSAIRequestSnapshot Snapshot;
+    Snapshot.PayloadTemplate = PayloadTemplate;
+    Snapshot.Model = !LocalAIModel.IsEmpty() ? LocalAIModel : Settings->GetAIModel();
+    Snapshot.MaxTokens = LocalMaxTokens > 0 ? LocalMaxTokens : Settings->GetMaxTokens();
+    Snapshot.CharacterPrompt = GetCharacterPrompt();
+    // the current player message is sent as the user message
+    ConversationBuffer.GatherLines(1, MaxHistoryTokens, Snapshot.HistoryLines);
+    Snapshot.Context = FADSAIRequestBuilder::Escape(Context);
+    Snapshot.UserMessage = FADSAIRequestBuilder::Escape(PlayerInput);
+
+    UE_LOG(LogADSAIDialogue, Verbose, TEXT("AI request to %s, model %s, max tokens %d, %d of %d history entries sent"),
+        *GetAPIEndpoint(), *Snapshot.Model, Snapshot.MaxTokens, Snapshot.HistoryLines.Num(), StructuredConversationHistory.Num());
+
+    // Build the payload off the game thread and send it back on it
+    const int32 Serial = ++RequestSerial;
+    TWeakObjectPtr<UADSAIDialoguePartecipantComponent> WeakThis(this);
+    Async(EAsyncExecution::ThreadPool, [WeakThis, Serial, Snapshot = MoveTemp(Snapshot)]() {
+        const double StartTime = FPlatformTime::Seconds();
+        FString Payload = FADSAIRequestBuilder::BuildPayload(Snapshot);
+        const float BuildTime = (float)((FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, BuildTime, Payload = MoveTemp(Payload)]() {
+            UADSAIDialoguePartecipantComponent* Component = WeakThis.Get();
+            if (Component && Component->RequestSerial == Serial) {
+                Component->LastRequestBuildTime = BuildTime;
+                Component->SendAIRequest(Payload);
+            }
+        });
+    });
+}
 
-    UE_LOG(LogTemp, Verbose, TEXT("Generated SystemPrompt with conversation history: %s"), *SystemPrompt);
+void UADSAIDialoguePartecipantComponent::SendAIRequest(const FString& Payload)
+{
+    UE_LOG(LogTemp, Verbose, TEXT("Processed payload (built in %.3f ms): %s"), LastRequestBuildTime, *Payload);
 
-    UADSDialogueDeveloperSettings* Settings = GetDialogueSettings();
-    if (!Settings) {
-        FString ErrorMsg = "Cannot access dialogue settings";
-        UE_LOG(LogTemp, Error, TEXT("%s"), *ErrorMsg);
-        LastErrorMessage = ErrorMsg;
-        SetAIDialogueState(EAIDialogueState::Error);
-        OnAIResponseReceived.Broadcast(ErrorMsg, false, false);
+    if (bUseMockEndpoint) {
+        // Answer on the next tick like a very fast endpoint would
+        const FString MockContent = FString::Printf(TEXT("{\"choices\": [{\"message\": {\"role\": \"assistant\", \"content\": \"%s\"}}]}"),
+            *FADSAIRequestBuilder::Escape(MockResponse));
+        GetWorld()->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateWeakLambda(this, [this, MockContent]() {
+            HandleAIResponse(200, MockContent);
+        }));
         return;
     }
 
+    UADSDialogueDeveloperSettings* Settings = GetDialogueSettings();
     TSharedRef<IHttpRequest> HttpRequest = FHttpModule::Get().CreateRequest();
     HttpRequest->SetURL(GetAPIEndpoint());
     HttpRequest->SetVerb("POST");
@@ -273,37 +302,7 @@ void UADSAIDialoguePartecipantComponent::GenerateAIResponse(const FString& Playe
         UE_LOG(LogTemp, Verbose, TEXT("Setting header: %s = %s"), *HeaderPair.Key, *HeaderPair.Value);
     }
 
-    // Process payload template - use local overrides if available
-    FString ModelToUse = !LocalAIModel.IsEmpty() ? LocalAIModel : Settings->GetAIModel();
-    int32 MaxTokensToUse = LocalMaxTokens > 0 ? LocalMaxTokens : Settings->GetMaxTokens();
-
-    FString ProcessedPayload = Settings->ProcessPayloadTemplate(
-        SystemPrompt,
-        PlayerInput,
-        ModelToUse,
-        MaxTokensToUse);
-
-    UE_LOG(LogTemp, Warning, TEXT("=== DEBUG: AI API Request ==="));
-    UE_LOG(LogTemp, Warning, TEXT("URL: %s"), *GetAPIEndpoint());
-    UE_LOG(LogTemp, Warning, TEXT("Model: %s"), *ModelToUse);
-    UE_LOG(LogTemp, Warning, TEXT("Max Tokens: %d"), MaxTokensToUse);
-    UE_LOG(LogTemp, Warning, TEXT("Conversation History Entries: %d"), StructuredConversationHistory.Num());
-    UE_LOG(LogTemp, Warning, TEXT("Processed payload: %s"), *ProcessedPayload);
-
-    // Validate JSON before sending
-    TSharedPtr<FJsonObject> ValidationJson;
-    TSharedRef<TJsonReader<>> ValidationReader = TJsonReaderFactory<>::Create(ProcessedPayload);
-    if (!FJsonSerializer::Deserialize(ValidationReader, ValidationJson)) {
-        FString ErrorMsg = "Generated JSON payload is invalid - check template configuration";
-        UE_LOG(LogTemp, Error, TEXT("%s"), *ErrorMsg);
-        UE_LOG(LogTemp, Error, TEXT("Invalid JSON: %s"), *ProcessedPayload);
-        LastErrorMessage = ErrorMsg;
-        SetAIDialogueState(EAIDialogueState::Error);
-        OnAIResponseReceived.Broadcast(ErrorMsg, false, false);
-        return;
-    }
-
-    HttpRequest->SetContentAsString(ProcessedPayload);
+    HttpRequest->SetContentAsString(Payload);
     HttpRequest->OnProcessRequestComplete().BindUObject(this, &UADSAIDialoguePartecipantComponent::OnHTTPResponseReceived);
 
     if (!HttpRequest->ProcessRequest()) {
@@ -317,6 +316,40 @@ void UADSAIDialoguePartecipantComponent::GenerateAIResponse(const FString& Playe
     }
 }
 
+bool UADSAIDialoguePartecipantComponent::ValidatePayloadTemplate(const FString& PayloadTemplate)
+{
+    if (!ValidatedPayloadTemplate.IsEmpty() && ValidatedPayloadTemplate.Equals(PayloadTemplate, ESearchCase::CaseSensitive)) {
+        return true;
+    }
+
+    const FString SamplePayload = FADSAIRequestBuilder::FillPayloadTemplate(PayloadTemplate, TEXT("model"), 1, TEXT("prompt"), TEXT("message"));
+    TSharedPtr<FJsonObject> ValidationJson;
+    TSharedRef<TJsonReader<>> ValidationReader = TJsonReaderFactory<>::Create(SamplePayload);
+    if (!FJsonSerializer::Deserialize(ValidationReader, ValidationJson)) {
+        return false;
+    }
+
+    ValidatedPayloadTemplate = PayloadTemplate;
+    return true;
+}
+
+const FString& UADSAIDialoguePartecipantComponent::GetCharacterPrompt()
+{
+    const FString Name = GetParticipantName().ToString();
+    if (CharacterPrompt.IsEmpty()
+        || !CharacterPromptName.Equals(Name, ESearchCase::CaseSensitive)
+        || !CharacterPromptPersonality.Equals(AIPersonality, ESearchCase::CaseSensitive)
+        || !CharacterPromptDescription.Equals(AICharacterDescription, ESearchCase::CaseSensitive)
+        || !CharacterPromptRules.Equals(AICharacterRules, ESearchCase::CaseSensitive)) {
+        CharacterPromptName = Name;
+        CharacterPromptPersonality = AIPersonality;
+        CharacterPromptDescription = AICharacterDescription;
+        CharacterPromptRules = AICharacterRules;
+        CharacterPrompt = FADSAIRequestBuilder::BuildCharacterPrompt(Name, AIPersonality, AICharacterDescription, AICharacterRules);
+    }
+    return CharacterPrompt;
+}
+
 // === HTTP RESPONSE HANDLER ===
 void UADSAIDialoguePartecipantComponent::OnHTTPResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 {
@@ -331,9 +364,11 @@ void UADSAIDialoguePartecipantComponent::OnHTTPResponseReceived(FHttpRequestPtr
         return;
     }
 
-    int32 ResponseCode = Response->GetResponseCode();
-    FString ResponseContent = Response->GetContentAsString();
+    HandleAIResponse(Response->GetResponseCode(), Response->GetContentAsString());
+}
 
+void UADSAIDialoguePartecipantComponent::HandleAIResponse(int32 ResponseCode, const FString& ResponseContent)
+{
     // Log the response content for debugging, especially for 400 errors
     UE_LOG(LogTemp, Warning, TEXT("HTTP Response Code: %d"), ResponseCode);
     UE_LOG(LogTemp, Warning, TEXT("HTTP Response Content: %s"), *ResponseContent);
@@ -539,10 +574,12 @@ void UADSAIDialoguePartecipantComponent::EndAIDialogue()
 {
     UE_LOG(LogTemp, Log, TEXT("Manually ending AI dialogue"));
 
-    // Reset state
+    // Reset state, a request still being built is dropped
+    RequestSerial++;
     SetAIDialogueState(EAIDialogueState::Idle);
     ConversationHistory.Empty();
     StructuredConversationHistory.Empty();
+    ConversationBuffer.Reset();
     bIsFirstResponse = true;
 
     // Trigger the end event with proper broadcast
@@ -605,6 +642,7 @@ bool UADSAIDialoguePartecipantComponent::IsAIDialogueEnabled() const
 void UADSAIDialoguePartecipantComponent::AddToConversationHistory(const FString& Speaker, const FString& Message)
 {
     StructuredConversationHistory.Add(FADSConversationEntry(Speaker, Message));
+    ConversationBuffer.Append(Speaker, Message);
     TrimConversationHistory();
 
     UE_LOG(LogTemp, Verbose, TEXT("Added to conversation history: %s: %s"), *Speaker, *Message);
@@ -619,6 +657,7 @@ void UADSAIDialoguePartecipantComponent::TrimConversationHistory()
     if (StructuredConversationHistory.Num() > MaxEntries) {
         int32 EntriesToRemove = StructuredConversationHistory.Num() - MaxEntries;
         StructuredConversationHistory.RemoveAt(0, EntriesToRemove);
+        ConversationBuffer.RemoveOldest(EntriesToRemove);
 
         UE_LOG(LogTemp, Log, TEXT("Trimmed conversation history - removed %d old entries"), EntriesToRemove);
     }
@@ -626,20 +665,25 @@ void UADSAIDialoguePartecipantComponent::TrimConversationHistory()
 
 FString UADSAIDialoguePartecipantComponent::GetConversationHistoryAsJSON() const
 {
-    FString JsonString = TEXT("{\n  \"conversation_history\": [\n");
+    int32 JsonLength = 64;
+    for (const FADSConversationEntry& Entry : StructuredConversationHistory) {
+        JsonLength += Entry.Speaker.Len() + Entry.Message.Len() + 96;
+    }
+
+    FString JsonString;
+    JsonString.Reserve(JsonLength);
+    JsonString += TEXT("{\n  \"conversation_history\": [\n");
 
     for (int32 i = 0; i < StructuredConversationHistory.Num(); i++) {
         const FADSConversationEntry& Entry = StructuredConversationHistory[i];
 
-        // Escape quotes in the message
-        FString EscapedMessage = Entry.Message.Replace(TEXT("\""), TEXT("\\\""));
-        EscapedMessage = EscapedMessage.Replace(TEXT("\n"), TEXT("\\n"));
-        EscapedMessage = EscapedMessage.Replace(TEXT("\r"), TEXT("\\r"));
-
-        JsonString += FString::Printf(TEXT("    {\n      \"speaker\": \"%s\",\n      \"message\": \"%s\",\n      \"timestamp\": \"%s\"\n    }"),
-            *Entry.Speaker,
-            *EscapedMessage,
-            *Entry.Timestamp.ToString());
+        JsonString += TEXT("    {\n      \"speaker\": \"");
+        FADSAIRequestBuilder::AppendEscaped(JsonString, Entry.Speaker);
+        JsonString += TEXT("\",\n      \"message\": \"");
+        FADSAIRequestBuilder::AppendEscaped(JsonString, Entry.Message);
+        JsonString += TEXT("\",\n      \"timestamp\": \"");
+        JsonString += Entry.Timestamp.ToString();
+        JsonString += TEXT("\"\n    }");
 
         if (i < StructuredConversationHistory.Num() - 1) {
             JsonString += TEXT(",");
@@ -676,6 +720,7 @@ void UADSAIDialoguePartecipantComponent::ClearConversationHistory()
 {
     StructuredConversationHistory.Empty();
     ConversationHistory.Empty(); // Also clear the legacy array
+    ConversationBuffer.Reset();
 
     UE_LOG(LogTemp, Log, TEXT("Conversation history cleared"));
 }
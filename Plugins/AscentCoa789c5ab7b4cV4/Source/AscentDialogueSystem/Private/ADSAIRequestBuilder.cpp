@@ -0,0 +1,205 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ADSAIRequestBuilder.h"
+
+namespace {
+const TCHAR* HistoryHeader = TEXT("\nConversation context (recent exchanges):\n");
+const TCHAR* ContextHeader = TEXT("Current context: ");
+const TCHAR* FinalInstruction = TEXT("Respond naturally to the player's message, staying in character and considering the conversation history.");
+}
+
+// === CONVERSATION BUFFER ===
+
+void FADSConversationBuffer::Append(const FString& speaker, const FString& message)
+{
+    FString line;
+    line.Reserve(speaker.Len() + message.Len() + 8);
+    FADSAIRequestBuilder::AppendEscaped(line, speaker);
+    line += TEXT(": ");
+    FADSAIRequestBuilder::AppendEscaped(line, message);
+    line += TEXT("\\n");
+
+    const int32 tokens = FADSAIRequestBuilder::EstimateTokens(speaker.Len() + message.Len() + 3);
+    Lines.Add({ MakeShared<const FString, ESPMode::ThreadSafe>(MoveTemp(line)), tokens });
+    TotalTokens += tokens;
+}
+
+void FADSConversationBuffer::RemoveOldest(int32 count)
+{
+    count = FMath::Min(count, Lines.Num());
+    if (count <= 0) {
+        return;
+    }
+
+    for (int32 index = 0; index < count; index++) {
+        TotalTokens -= Lines[index].Tokens;
+    }
+    Lines.RemoveAt(0, count, EAllowShrinking::No);
+}
+
+void FADSConversationBuffer::Reset()
+{
+    Lines.Reset();
+    TotalTokens = 0;
+}
+
+void FADSConversationBuffer::GatherLines(int32 skipNewest, int32 maxTokens, TArray<FADSPromptLine>& outLines) const
+{
+    outLines.Reset();
+    const int32 lastIndex = Lines.Num() - 1 - skipNewest;
+    int32 firstIndex = 0;
+
+    if (maxTokens > 0) {
+        // walk back from the newest line until the budget is spent
+        int32 tokens = 0;
+        firstIndex = lastIndex + 1;
+        while (firstIndex > 0 && tokens + Lines[firstIndex - 1].Tokens <= maxTokens) {
+            firstIndex--;
+            tokens += Lines[firstIndex].Tokens;
+        }
+    }
+
+    outLines.Reserve(FMath::Max(lastIndex - firstIndex + 1, 0));
+    for (int32 index = firstIndex; index <= lastIndex; index++) {
+        outLines.Add(Lines[index].Text);
+    }
+}
+
+// === REQUEST BUILDER ===
+
+void FADSAIRequestBuilder::AppendEscaped(FString& out, FStringView text)
+{
+    for (const TCHAR character : text) {
+        switch (character) {
+        case TEXT('\\'):
+            out += TEXT("\\\\");
+            break;
+        case TEXT('"'):
+            out += TEXT("\\\"");
+            break;
+        case TEXT('\n'):
+            out += TEXT("\\n");
+            break;
+        case TEXT('\r'):
+            out += TEXT("\\r");
+            break;
+        case TEXT('\t'):
+            out += TEXT("\\t");
+            break;
+        default:
+            if (character < 0x20) {
+                // any other control character would make the payload invalid
+                out.Appendf(TEXT("\\u%04x"), (uint32)character);
+            } else {
+                out.AppendChar(character);
+            }
+            break;
+        }
+    }
+}
+
+FString FADSAIRequestBuilder::Escape(FStringView text)
+{
+    FString escaped;
+    escaped.Reserve(text.Len() + 16);
+    AppendEscaped(escaped, text);
+    return escaped;
+}
+
+FString FADSAIRequestBuilder::BuildCharacterPrompt(const FString& name, const FString& personality, const FString& description, const FString& rules)
+{
+    FString prompt;
+    prompt.Reserve(name.Len() + personality.Len() + description.Len() + rules.Len() + 64);
+
+    AppendEscaped(prompt, TEXT("You are "));
+    AppendEscaped(prompt, name);
+    AppendEscaped(prompt, TEXT(".\n"));
+
+    if (!personality.IsEmpty()) {
+        AppendEscaped(prompt, TEXT("Personality: "));
+        AppendEscaped(prompt, personality);
+        AppendEscaped(prompt, TEXT("\n"));
+    }
+
+    if (!description.IsEmpty()) {
+        AppendEscaped(prompt, TEXT("Description: "));
+        AppendEscaped(prompt, description);
+        AppendEscaped(prompt, TEXT("\n"));
+    }
+
+    if (!rules.IsEmpty()) {
+        AppendEscaped(prompt, TEXT("Rules:\n"));
+        AppendEscaped(prompt, rules);
+        AppendEscaped(prompt, TEXT("\n"));
+    }
+
+    return prompt;
+}
+
+FString FADSAIRequestBuilder::FillPayloadTemplate(const FString& payloadTemplate, const FString& model, int32 maxTokens, FStringView escapedSystemPrompt, FStringView escapedUserMessage)
+{
+    const FString maxTokensValue = FString::FromInt(maxTokens);
+    const TPair<FStringView, FStringView> tags[] = {
+        { TEXTVIEW("MODEL"), model },
+        { TEXTVIEW("MAX_TOKENS"), maxTokensValue },
+        { TEXTVIEW("SYSTEM_PROMPT"), escapedSystemPrompt },
+        { TEXTVIEW("USER_MESSAGE"), escapedUserMessage },
+        { TEXTVIEW("TEMPERATURE"), TEXTVIEW("0.7") }
+    };
+
+    FString payload;
+    payload.Reserve(payloadTemplate.Len() + model.Len() + escapedSystemPrompt.Len() + escapedUserMessage.Len());
+
+    // values are never scanned again, so tags written by the player are sent as they are
+    const FStringView source = payloadTemplate;
+    int32 copyStart = 0;
+    for (int32 index = 0; index < source.Len(); index++) {
+        if (source[index] != TEXT('{')) {
+            continue;
+        }
+
+        const FStringView remaining = source.RightChop(index + 1);
+        for (const TPair<FStringView, FStringView>& tag : tags) {
+            if (remaining.StartsWith(tag.Key, ESearchCase::CaseSensitive) && remaining.RightChop(tag.Key.Len()).StartsWith(TEXT('}'))) {
+                payload += source.Mid(copyStart, index - copyStart);
+                payload += tag.Value;
+                index += tag.Key.Len() + 1;
+                copyStart = index + 1;
+                break;
+            }
+        }
+    }
+    payload += source.RightChop(copyStart);
+
+    return payload;
+}
+
+FString FADSAIRequestBuilder::BuildPayload(const FADSAIRequestSnapshot& snapshot)
+{
+    int32 promptLength = snapshot.CharacterPrompt.Len() + snapshot.Context.Len() + 256;
+    for (const FADSPromptLine& line : snapshot.HistoryLines) {
+        promptLength += line->Len();
+    }
+
+    FString systemPrompt;
+    systemPrompt.Reserve(promptLength);
+    systemPrompt += snapshot.CharacterPrompt;
+
+    if (snapshot.HistoryLines.Num() > 0) {
+        AppendEscaped(systemPrompt, HistoryHeader);
+        for (const FADSPromptLine& line : snapshot.HistoryLines) {
+            systemPrompt += *line;
+        }
+        AppendEscaped(systemPrompt, TEXT("\n"));
+    }
+
+    if (!snapshot.Context.IsEmpty()) {
+        AppendEscaped(systemPrompt, ContextHeader);
+        systemPrompt += snapshot.Context;
+        AppendEscaped(systemPrompt, TEXT("\n"));
+    }
+
+    AppendEscaped(systemPrompt, FinalInstruction);
+
+    return FillPayloadTemplate(snapshot.PayloadTemplate, snapshot.Model, snapshot.MaxTokens, systemPrompt, snapshot.UserMessage);
+}
@@ -1,5 +1,9 @@
 #include "ADSAITextToSpeech.h"
 #include "ADSDialogueDeveloperSettings.h"
+#include "ADSDialoguePartecipantComponent.h"
+#include "ADSTTSCacheSubsystem.h"
+#include "Graph/ADSDialogue.h"
+#include "Graph/ADSGraphNode.h"
 #include "Sound/SoundWave.h"
 #include "Sound/SoundWaveProcedural.h"
 #include "Engine/Engine.h"
@@ -9,6 +13,7 @@
 #include "HttpModule.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
+#include "Async/Async.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include <Engine/TimerHandle.h>
@@ -36,6 +41,12 @@ void UADSAITextToSpeech::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     // Stop all active audio before ending play
     StopTTSAudio(false, 0.0f);
+
+    if (CurrentAudioComponent.Get())
+    {
+        CurrentAudioComponent->OnAudioFinished.RemoveDynamic(this, &UADSAITextToSpeech::OnAudioFinished);
+        CurrentAudioComponent = nullptr;
+    }
     
     // Clear cached audio data
     ClearCachedAudioData();
@@ -165,32 +176,159 @@ void UADSAITextToSpeech::GenerateAITTSInternal(const FString& Text, const FStrin
     // Set state to waiting for response
     SetTTSState(EAITTSState::WaitingForResponse);
 
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-    Request->SetURL(GetAITTSAPIEndpoint());
-    Request->SetVerb(TEXT("POST"));
-    
-    // Process AI TTS headers using the settings template
-    TMap<FString, FString> Headers = Settings->ProcessTTSHeadersTemplate(ApiKey);
-    for (const auto& HeaderPair : Headers)
+    const int32 LineId = ++ActiveLineId;
+    bPlayActiveLine = bPlayAudio;
+
+    const FString CacheKey = UADSTTSCacheSubsystem::MakeCacheKey(Text, Voice, Model);
+    UADSTTSCacheSubsystem* Cache = GEngine ? GEngine->GetEngineSubsystem<UADSTTSCacheSubsystem>() : nullptr;
+    if (Cache && Cache->IsCacheEnabled())
     {
-        Request->SetHeader(HeaderPair.Key, HeaderPair.Value);
+        TArray<uint8> CachedData;
+        if (Cache->TryGetFromMemory(CacheKey, CachedData))
+        {
+            UE_LOG(ADSAITextToSpeechLog, Log, TEXT("AI TTS served from memory cache"));
+            OnAITTSAudioReceived(Text, CachedData, bPlayActiveLine, false);
+            return;
+        }
+
+        // Lines cached on disk or being prefetched are not requested again
+        TWeakObjectPtr<UADSAITextToSpeech> WeakThis(this);
+        FOnADSTTSCacheLoaded OnLoaded = FOnADSTTSCacheLoaded::CreateLambda([WeakThis, LineId, Text, CacheKey, Voice, Model, ApiKey](bool bFound, const TArray<uint8>& AudioData)
+        {
+            UADSAITextToSpeech* This = WeakThis.Get();
+            if (!This || This->ActiveLineId != LineId)
+            {
+                return;
+            }
+
+            if (bFound)
+            {
+                UE_LOG(ADSAITextToSpeechLog, Log, TEXT("AI TTS served from cache"));
+                This->OnAITTSAudioReceived(Text, AudioData, This->bPlayActiveLine, false);
+            }
+            else
+            {
+                This->RequestAITTS(Text, CacheKey, Voice, Model, ApiKey);
+            }
+        });
+
+        if (Cache->IsCached(CacheKey))
+        {
+            Cache->LoadAsync(CacheKey, OnLoaded);
+            return;
+        }
+
+        if (Cache->WaitForPrefetch(CacheKey, OnLoaded))
+        {
+            return;
+        }
     }
 
-    // Process AI TTS payload using the settings template
-    FString ProcessedPayload = Settings->ProcessTTSPayloadTemplate(Text, Voice, Model);
-    Request->SetContentAsString(ProcessedPayload);
+    RequestAITTS(Text, CacheKey, Voice, Model, ApiKey);
+}
+
+void UADSAITextToSpeech::RequestAITTS(const FString& Text, const FString& CacheKey, const FString& Voice, const FString& Model, const FString& ApiKey)
+{
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = UADSTTSCacheSubsystem::CreateTTSRequest(Text, Voice, Model, GetAITTSAPIEndpoint(), ApiKey);
+
+    ResetStream();
 
-    Request->OnProcessRequestComplete().BindLambda([this, Text, bPlayAudio](FHttpRequestPtr RequestPtr, FHttpResponsePtr Response, bool bSuccess)
+    // Stream the body so that playback can start before the whole line has been generated
+    TSharedPtr<FStreamBuffer, ESPMode::ThreadSafe> Buffer;
+    if (bStreamPlayback && bPlayActiveLine)
     {
+        Buffer = MakeShared<FStreamBuffer, ESPMode::ThreadSafe>();
+        Request->SetResponseBodyReceiveStreamDelegateV2(FHttpRequestStreamDelegateV2::CreateLambda([Buffer](void* Ptr, int64& InOutLength)
+        {
+            FScopeLock ScopeLock(&Buffer->Lock);
+            Buffer->Data.Append(static_cast<const uint8*>(Ptr), InOutLength);
+        }));
+
+        // Nothing is played before the status is known, so that error bodies are never played as audio
+        Request->OnStatusCodeReceived().BindLambda([Buffer](FHttpRequestPtr RequestPtr, int32 StatusCode)
+        {
+            FScopeLock ScopeLock(&Buffer->Lock);
+            Buffer->ResponseCode = StatusCode;
+        });
+
+        StreamBuffer = Buffer;
+        if (UWorld* World = GetWorld())
+        {
+            World->GetTimerManager().SetTimer(StreamPumpTimer, this, &UADSAITextToSpeech::PumpStreamedAudio, 0.05f, true);
+        }
+    }
+
+    const int32 LineId = ActiveLineId;
+    TWeakObjectPtr<UADSAITextToSpeech> WeakThis(this);
+    Request->OnProcessRequestComplete().BindLambda([WeakThis, LineId, Text, CacheKey, Buffer](FHttpRequestPtr RequestPtr, FHttpResponsePtr Response, bool bSuccess)
+    {
+        UADSAITextToSpeech* This = WeakThis.Get();
+
+        TArray<uint8> AudioData;
+        if (Buffer.IsValid())
+        {
+            FScopeLock ScopeLock(&Buffer->Lock);
+            AudioData = Buffer->Data;
+            if (Response.IsValid())
+            {
+                Buffer->ResponseCode = Response->GetResponseCode();
+            }
+        }
+        else if (Response.IsValid())
+        {
+            AudioData = Response->GetContent();
+        }
+
+        // Streamed lines must be WAV files, their format is read from the header before playback
+        const bool bWavStream = !Buffer.IsValid() || (AudioData.Num() >= 12 && FMemory::Memcmp(AudioData.GetData(), "RIFF", 4) == 0);
+        const bool bValidAudio = bSuccess && Response.IsValid() && Response->GetResponseCode() == 200 && AudioData.Num() > 0 && bWavStream;
+        if (bValidAudio)
+        {
+            // Cache the line even if it is no longer the one being spoken
+            if (UADSTTSCacheSubsystem* Cache = GEngine ? GEngine->GetEngineSubsystem<UADSTTSCacheSubsystem>() : nullptr)
+            {
+                if (Cache->IsCacheEnabled())
+                {
+                    Cache->Store(CacheKey, AudioData);
+                }
+            }
+        }
+
+        if (!This || This->ActiveLineId != LineId)
+        {
+            return;
+        }
+
+        // Queue the tail of the stream before it is released
+        bool bAlreadyPlaying = false;
+        if (Buffer.IsValid() && This->StreamBuffer == Buffer)
+        {
+            if (bValidAudio)
+            {
+                This->PumpStreamedAudio();
+            }
+
+            bAlreadyPlaying = This->bStreamPlaying && bValidAudio;
+            if (This->bStreamPlaying && !bValidAudio && This->CurrentAudioComponent.Get())
+            {
+                This->CurrentAudioComponent->Stop();
+            }
+            else if (bAlreadyPlaying)
+            {
+                This->StopWhenDrained();
+            }
+            This->ResetStream();
+        }
+
         if (!bSuccess)
         {
-            HandleTTSError(EAITTSErrorType::NetworkError, TEXT("HTTP request failed - network error"), Text);
+            This->HandleTTSError(EAITTSErrorType::NetworkError, TEXT("HTTP request failed - network error"), Text);
             return;
         }
 
         if (!Response.IsValid())
         {
-            HandleTTSError(EAITTSErrorType::NetworkError, TEXT("Invalid HTTP response"), Text);
+            This->HandleTTSError(EAITTSErrorType::NetworkError, TEXT("Invalid HTTP response"), Text);
             return;
         }
 
@@ -198,55 +336,75 @@ void UADSAITextToSpeech::GenerateAITTSInternal(const FString& Text, const FStrin
         
         if (ResponseCode != 200)
         {
-            EAITTSErrorType ErrorType = ClassifyHTTPError(ResponseCode);
-            FString ErrorMessage = FString::Printf(TEXT("HTTP %d: %s"), ResponseCode, *Response->GetContentAsString());
-            HandleTTSError(ErrorType, ErrorMessage, Text);
+            EAITTSErrorType ErrorType = This->ClassifyHTTPError(ResponseCode);
+            FString ErrorBody = Response->GetContentAsString();
+            if (Buffer.IsValid())
+            {
+                // Streamed bodies are not kept by the response
+                FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(AudioData.GetData()), AudioData.Num());
+                ErrorBody = FString(Converter.Length(), Converter.Get());
+            }
+            FString ErrorMessage = FString::Printf(TEXT("HTTP %d: %s"), ResponseCode, *ErrorBody);
+            This->HandleTTSError(ErrorType, ErrorMessage, Text);
             return;
         }
 
-        TArray<uint8> AudioData = Response->GetContent();
-        
-        if (AudioData.Num() == 0)
+        if (!bWavStream)
         {
-            HandleTTSError(EAITTSErrorType::AudioError, TEXT("Received empty audio data"), Text);
+            This->HandleTTSError(EAITTSErrorType::AudioError, TEXT("Streamed audio has no WAV header"), Text);
             return;
         }
 
-        // Success! Cache the audio data and fire the events
-        CachedAudioData = AudioData;
-        CachedAudioText = Text;
-        
-        OnAITTSAudioReady.Broadcast(AudioData);
-        OnAITTSSuccess.Broadcast(Text);
-        OnAITTSCompleted.Broadcast(AudioData, true, EAITTSErrorType::None);
-        
-        UE_LOG(ADSAITextToSpeechLog, Log, TEXT("AI TTS completed successfully - received %d bytes, cached for future use"), AudioData.Num());
-
-        // Play audio if requested
-        if (bPlayAudio)
-        {
-            SetTTSState(EAITTSState::PlayingAudio);
-            PlayAudioFromBuffer(AudioData, 16000, 1, true);
-        }
-        else
-        {
-            SetTTSState(EAITTSState::Completed);
-        }
-        
-        // Reset to Idle after a brief moment to allow processing
-        if (GetWorld())
+        if (AudioData.Num() == 0)
         {
-            FTimerHandle TimerHandle;
-            GetWorld()->GetTimerManager().SetTimer(TimerHandle, [this]() { SetTTSState(EAITTSState::Idle); }, 0.1f, false);
+            This->HandleTTSError(EAITTSErrorType::AudioError, TEXT("Received empty audio data"), Text);
+            return;
         }
+
+        This->OnAITTSAudioReceived(Text, AudioData, This->bPlayActiveLine, bAlreadyPlaying);
     });
     
     if (!Request->ProcessRequest())
     {
+        ResetStream();
         HandleTTSError(EAITTSErrorType::NetworkError, TEXT("Failed to send HTTP request"), Text);
     }
 }
 
+void UADSAITextToSpeech::OnAITTSAudioReceived(const FString& Text, const TArray<uint8>& AudioData, bool bPlayAudio, bool bAlreadyPlaying)
+{
+    // Success! Cache the audio data and fire the events
+    CachedAudioData = AudioData;
+    CachedAudioText = Text;
+    
+    OnAITTSAudioReady.Broadcast(AudioData);
+    OnAITTSSuccess.Broadcast(Text);
+    OnAITTSCompleted.Broadcast(AudioData, true, EAITTSErrorType::None);
+    
+    UE_LOG(ADSAITextToSpeechLog, Log, TEXT("AI TTS completed successfully - received %d bytes, cached for future use"), AudioData.Num());
+
+    // Play audio if requested
+    if (bPlayAudio)
+    {
+        SetTTSState(EAITTSState::PlayingAudio);
+        if (!bAlreadyPlaying)
+        {
+            PlayAudioFromBuffer(AudioData, 16000, 1, true);
+        }
+    }
+    else
+    {
+        SetTTSState(EAITTSState::Completed);
+    }
+    
+    // Reset to Idle after a brief moment to allow processing
+    if (GetWorld())
+    {
+        FTimerHandle TimerHandle;
+        GetWorld()->GetTimerManager().SetTimer(TimerHandle, [this]() { SetTTSState(EAITTSState::Idle); }, 0.1f, false);
+    }
+}
+
 void UADSAITextToSpeech::PlayAudioFromBuffer(const TArray<uint8>& AudioData, int32 SampleRate, int32 NumChannels, bool bIsWav)
 {
     const uint8* PCMData = AudioData.GetData();
@@ -278,63 +436,234 @@ void UADSAITextToSpeech::PlayAudioFromBuffer(const TArray<uint8>& AudioData, int
         return;
     }
 
-    USoundWaveProcedural* SoundWave = NewObject<USoundWaveProcedural>();
-    if (!SoundWave)
+    const float Duration = (float)PCMSize / (2 * NumChannels * SampleRate);
+
+    UE_LOG(ADSAITextToSpeechLog, Log, TEXT("Playing SoundWave: SampleRate=%d, Channels=%d, Duration=%.2fs, PCMSize=%d"), 
+        SampleRate, NumChannels, Duration, PCMSize);
+
+    if (BeginPlayback(SampleRate, NumChannels, Duration, PCMData, PCMSize))
     {
-        UE_LOG(ADSAITextToSpeechLog, Error, TEXT("Failed to create SoundWave object"));
-        return;
+        UE_LOG(ADSAITextToSpeechLog, Log, TEXT("Started playing TTS audio"));
     }
+}
 
-    SoundWave->SetSampleRate(SampleRate);
-    SoundWave->NumChannels = NumChannels;
-    SoundWave->Duration = (float)PCMSize / (2 * NumChannels * SampleRate);
-    SoundWave->bLooping = false;
-    SoundWave->SoundGroup = SOUNDGROUP_Voice;
-    SoundWave->bProcedural = true;
-    SoundWave->VirtualizationMode = EVirtualizationMode::PlayWhenSilent;
-    
-    UE_LOG(ADSAITextToSpeechLog, Log, TEXT("Creating SoundWave: SampleRate=%d, Channels=%d, Duration=%.2fs, PCMSize=%d"), 
-        SampleRate, NumChannels, SoundWave->Duration, PCMSize);
-    
-    SoundWave->QueueAudio(PCMData, PCMSize);
-    
-    // Stop and cleanup any existing audio component
-    if (CurrentAudioComponent.Get())
+bool UADSAITextToSpeech::BeginPlayback(int32 SampleRate, int32 NumChannels, float Duration, const uint8* PCMData, int32 PCMSize)
+{
+    {
+        FScopeLock ScopeLock(&DrainState->Lock);
+        DrainState->LineId = INDEX_NONE;
+    }
+
+    // The audio component and its sound wave are created once and reused by every line
+    if (!CurrentAudioComponent.Get())
+    {
+        CurrentAudioComponent = NewObject<UAudioComponent>(GetOwner());
+        if (!CurrentAudioComponent)
+        {
+            UE_LOG(ADSAITextToSpeechLog, Error, TEXT("Failed to create AudioComponent"));
+            return false;
+        }
+
+        CurrentAudioComponent->bAutoDestroy = false;
+        CurrentAudioComponent->RegisterComponent();
+        CurrentAudioComponent->OnAudioFinished.AddDynamic(this, &UADSAITextToSpeech::OnAudioFinished);
+    }
+    else if (CurrentAudioComponent->IsPlaying())
     {
         CurrentAudioComponent->Stop();
-        CurrentAudioComponent->OnAudioFinished.RemoveDynamic(this, &UADSAITextToSpeech::OnAudioFinished);
     }
-    
-    // Create new audio component
-    CurrentAudioComponent = NewObject<UAudioComponent>(GetOwner());
-    if (!CurrentAudioComponent)
+
+    if (!PlaybackSoundWave)
     {
-        UE_LOG(ADSAITextToSpeechLog, Error, TEXT("Failed to create AudioComponent"));
-        return;
+        PlaybackSoundWave = NewObject<USoundWaveProcedural>(this);
+        if (!PlaybackSoundWave)
+        {
+            UE_LOG(ADSAITextToSpeechLog, Error, TEXT("Failed to create SoundWave object"));
+            return false;
+        }
+
+        PlaybackSoundWave->bLooping = false;
+        PlaybackSoundWave->SoundGroup = SOUNDGROUP_Voice;
+        PlaybackSoundWave->bProcedural = true;
+        PlaybackSoundWave->VirtualizationMode = EVirtualizationMode::PlayWhenSilent;
+
+        // Streamed lines have no known duration, they end when the wave runs out of audio after the response completed
+        TWeakObjectPtr<UADSAITextToSpeech> WeakThis(this);
+        PlaybackSoundWave->OnSoundWaveProceduralUnderflow.BindLambda([WeakThis, Drain = DrainState](USoundWaveProcedural* Wave, int32 SamplesRequired)
+        {
+            if (Wave->GetAvailableAudioByteCount() > 0)
+            {
+                return;
+            }
+
+            int32 LineId = INDEX_NONE;
+            {
+                FScopeLock ScopeLock(&Drain->Lock);
+                Swap(LineId, Drain->LineId);
+            }
+
+            if (LineId != INDEX_NONE)
+            {
+                AsyncTask(ENamedThreads::GameThread, [WeakThis, LineId]()
+                {
+                    UADSAITextToSpeech* This = WeakThis.Get();
+                    if (This && This->ActiveLineId == LineId && This->CurrentAudioComponent.Get())
+                    {
+                        This->CurrentAudioComponent->Stop();
+                    }
+                });
+            }
+        });
+    }
+    else
+    {
+        PlaybackSoundWave->ResetAudio();
     }
 
-    CurrentAudioComponent->RegisterComponent();
-    CurrentAudioComponent->SetSound(SoundWave);
-    
-    // Set up completion callback
-    CurrentAudioComponent->OnAudioFinished.AddDynamic(this, &UADSAITextToSpeech::OnAudioFinished);
-    
+    PlaybackSoundWave->SetSampleRate(SampleRate);
+    PlaybackSoundWave->NumChannels = NumChannels;
+    PlaybackSoundWave->Duration = Duration;
+
+    if (PCMData && PCMSize > 0)
+    {
+        PlaybackSoundWave->QueueAudio(PCMData, PCMSize);
+    }
+
+    CurrentAudioComponent->SetSound(PlaybackSoundWave);
     CurrentAudioComponent->Play();
-    
-    UE_LOG(ADSAITextToSpeechLog, Log, TEXT("Started playing TTS audio"));
+    return true;
+}
+
+void UADSAITextToSpeech::PumpStreamedAudio()
+{
+    if (!StreamBuffer.IsValid())
+    {
+        return;
+    }
+
+    // Copy the bytes not consumed yet, so that the HTTP thread is never blocked by playback
+    TArray<uint8> Data;
+    int32 ResponseCode = 0;
+    {
+        FScopeLock ScopeLock(&StreamBuffer->Lock);
+        ResponseCode = StreamBuffer->ResponseCode;
+        const int32 NumPending = StreamBuffer->Data.Num() - StreamReadOffset;
+        if (NumPending <= 0)
+        {
+            return;
+        }
+        Data.Append(StreamBuffer->Data.GetData() + StreamReadOffset, NumPending);
+    }
+
+    int32 DataOffset = 0;
+    if (!bStreamHeaderParsed)
+    {
+        if (bStreamRejected || ResponseCode == 0 || Data.Num() < 12)
+        {
+            return;
+        }
+
+        // Error bodies and unknown formats are not played, the completed request reports the failure
+        if (!EHttpResponseCodes::IsOk(ResponseCode) || FMemory::Memcmp(Data.GetData(), "RIFF", 4) != 0)
+        {
+            bStreamRejected = true;
+            if (UWorld* World = GetWorld())
+            {
+                World->GetTimerManager().ClearTimer(StreamPumpTimer);
+            }
+            return;
+        }
+
+        // Wait for the whole header, up to the start of the "data" chunk
+        for (int32 i = 12; i + 8 <= Data.Num(); i++)
+        {
+            if (Data[i] == 'd' && Data[i + 1] == 'a' && Data[i + 2] == 't' && Data[i + 3] == 'a')
+            {
+                DataOffset = i + 8;
+                break;
+            }
+        }
+
+        if (DataOffset == 0 || Data.Num() < 36)
+        {
+            return;
+        }
+
+        StreamNumChannels = FMath::Max<int32>(*(const int16*)(Data.GetData() + 22), 1);
+        StreamSampleRate = FMath::Max(*(const int32*)(Data.GetData() + 24), 1);
+        StreamReadOffset += DataOffset;
+        bStreamHeaderParsed = true;
+    }
+
+    // Only whole sample frames are queued
+    const int32 BytesPerFrame = 2 * StreamNumChannels;
+    int32 NumBytes = Data.Num() - DataOffset;
+    NumBytes -= NumBytes % BytesPerFrame;
+    if (NumBytes <= 0)
+    {
+        return;
+    }
+
+    const uint8* PCMData = Data.GetData() + DataOffset;
+    if (bStreamPlaying)
+    {
+        PlaybackSoundWave->QueueAudio(PCMData, NumBytes);
+        StreamReadOffset += NumBytes;
+        return;
+    }
+
+    const int32 StartBytes = FMath::CeilToInt(StreamStartBufferSeconds * StreamSampleRate) * BytesPerFrame;
+    if (NumBytes < StartBytes)
+    {
+        return;
+    }
+
+    // The line keeps playing until the sound wave drains after the response completed
+    if (!BeginPlayback(StreamSampleRate, StreamNumChannels, INDEFINITELY_LOOPING_DURATION, PCMData, NumBytes))
+    {
+        ResetStream();
+        return;
+    }
+
+    StreamReadOffset += NumBytes;
+    bStreamPlaying = true;
+
+    UE_LOG(ADSAITextToSpeechLog, Log, TEXT("Started streaming TTS audio: SampleRate=%d, Channels=%d"), StreamSampleRate, StreamNumChannels);
+    SetTTSState(EAITTSState::PlayingAudio);
+}
+
+void UADSAITextToSpeech::ResetStream()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(StreamPumpTimer);
+    }
+
+    StreamBuffer.Reset();
+    StreamReadOffset = 0;
+    StreamSampleRate = 16000;
+    StreamNumChannels = 1;
+    bStreamHeaderParsed = false;
+    bStreamPlaying = false;
+    bStreamRejected = false;
+}
+
+void UADSAITextToSpeech::StopWhenDrained()
+{
+    FScopeLock ScopeLock(&DrainState->Lock);
+    DrainState->LineId = ActiveLineId;
 }
 
 void UADSAITextToSpeech::OnAudioFinished()
 {
-    UE_LOG(ADSAITextToSpeechLog, Log, TEXT("Audio finished playing"));
-    
-    // Clean up the current audio component
-    if (CurrentAudioComponent.Get())
+    // The component is reused, a finished event of the previous line can arrive after the next one started
+    if (CurrentAudioComponent.Get() && CurrentAudioComponent->IsPlaying())
     {
-        CurrentAudioComponent->OnAudioFinished.RemoveDynamic(this, &UADSAITextToSpeech::OnAudioFinished);
-        CurrentAudioComponent = nullptr;
+        return;
     }
-    
+
+    UE_LOG(ADSAITextToSpeechLog, Log, TEXT("Audio finished playing"));
+
     // If we were playing audio, transition to completed
     if (CurrentTTSState == EAITTSState::PlayingAudio)
     {
@@ -500,11 +829,12 @@ void UADSAITextToSpeech::StopTTSAudio(bool bFadeOut, float FadeOutDuration)
         }
     }
     
-    // Clean up the audio component reference
-    if (CurrentAudioComponent.Get())
+    // Stop streaming and drop a pending line, the audio component is kept for the next one
+    ResetStream();
+    bPlayActiveLine = false;
     {
-        CurrentAudioComponent->OnAudioFinished.RemoveDynamic(this, &UADSAITextToSpeech::OnAudioFinished);
-        CurrentAudioComponent = nullptr;
+        FScopeLock ScopeLock(&DrainState->Lock);
+        DrainState->LineId = INDEX_NONE;
     }
 
     // If we were in PlayingAudio state, transition to Idle
@@ -549,6 +879,72 @@ bool UADSAITextToSpeech::PlayCachedAudioData()
     return true;
 }
 
+void UADSAITextToSpeech::PrefetchText(const FString& Text)
+{
+    UADSDialogueDeveloperSettings* Settings = GetDialogueSettings();
+    if (Text.IsEmpty() || !Settings || !Settings->IsTTSEnabled())
+    {
+        return;
+    }
+
+    UADSTTSCacheSubsystem* Cache = GEngine ? GEngine->GetEngineSubsystem<UADSTTSCacheSubsystem>() : nullptr;
+    if (Cache && Cache->IsCacheEnabled())
+    {
+        Cache->Prefetch(Text, GetAITTSVoice(), GetAITTSModel(), GetAITTSAPIEndpoint(), GetAITTSAPIKey());
+    }
+}
+
+void UADSAITextToSpeech::PrefetchDialogueLines(UADSDialogue* Dialogue, int32 MaxDepth)
+{
+    if (!Dialogue || !Dialogue->GetCurrentNode())
+    {
+        return;
+    }
+
+    // Breadth first, so that the lines most likely to be spoken next are generated first
+    TArray<TPair<UAGSGraphNode*, int32>> PendingNodes;
+    TSet<UAGSGraphNode*> VisitedNodes;
+    PendingNodes.Add({ Dialogue->GetCurrentNode(), 0 });
+    VisitedNodes.Add(Dialogue->GetCurrentNode());
+
+    for (int32 Index = 0; Index < PendingNodes.Num(); Index++)
+    {
+        const TPair<UAGSGraphNode*, int32> Pending = PendingNodes[Index];
+        if (Pending.Value >= MaxDepth)
+        {
+            continue;
+        }
+
+        for (UAGSGraphNode* Child : Pending.Key->ChildrenNodes)
+        {
+            if (!Child || VisitedNodes.Contains(Child))
+            {
+                continue;
+            }
+            VisitedNodes.Add(Child);
+            PendingNodes.Add({ Child, Pending.Value + 1 });
+
+            UADSGraphNode* DialogueNode = Cast<UADSGraphNode>(Child);
+            if (!DialogueNode)
+            {
+                continue;
+            }
+
+            // Lines are generated with the voice of the component that will speak them
+            UADSAITextToSpeech* Speaker = this;
+            UADSDialoguePartecipantComponent* Participant = DialogueNode->GetDialogueParticipant();
+            if (Participant && Participant->GetOwner())
+            {
+                if (UADSAITextToSpeech* ParticipantTTS = Participant->GetOwner()->FindComponentByClass<UADSAITextToSpeech>())
+                {
+                    Speaker = ParticipantTTS;
+                }
+            }
+            Speaker->PrefetchText(DialogueNode->GetDialogueText().ToString());
+        }
+    }
+}
+
 void UADSAITextToSpeech::ClearAllLocalOverrides()
 {
     VoiceType.Empty();
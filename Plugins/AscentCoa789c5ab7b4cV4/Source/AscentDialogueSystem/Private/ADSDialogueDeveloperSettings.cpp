@@ -1,6 +1,7 @@
 // Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
 
 #include "ADSDialogueDeveloperSettings.h"
+#include "ADSAIRequestBuilder.h"
 #include "ADSDialogueSubsystem.h"
 #include "ADSVoiceConfigDataAsset.h"
 
@@ -11,30 +12,8 @@ UADSVoiceConfigDataAsset* UADSDialogueDeveloperSettings::GetVoiceConfigDataAsset
 
 FString UADSDialogueDeveloperSettings::ProcessPayloadTemplate(const FString& SystemPrompt, const FString& UserMessage, const FString& Model, int32 InMaxTokens) const
 {
-    TMap<FString, FString> TagValues;
-    TagValues.Add(TEXT("MODEL"), Model);
-    TagValues.Add(TEXT("MAX_TOKENS"), FString::FromInt(InMaxTokens));
-
-    // Proper JSON escaping for strings
-    FString EscapedSystemPrompt = SystemPrompt;
-    EscapedSystemPrompt = EscapedSystemPrompt.Replace(TEXT("\\"), TEXT("\\\\")); // Escape backslashes first
-    EscapedSystemPrompt = EscapedSystemPrompt.Replace(TEXT("\""), TEXT("\\\"")); // Escape quotes
-    EscapedSystemPrompt = EscapedSystemPrompt.Replace(TEXT("\n"), TEXT("\\n")); // Escape newlines
-    EscapedSystemPrompt = EscapedSystemPrompt.Replace(TEXT("\r"), TEXT("\\r")); // Escape carriage returns
-    EscapedSystemPrompt = EscapedSystemPrompt.Replace(TEXT("\t"), TEXT("\\t")); // Escape tabs
-
-    FString EscapedUserMessage = UserMessage;
-    EscapedUserMessage = EscapedUserMessage.Replace(TEXT("\\"), TEXT("\\\\")); // Escape backslashes first
-    EscapedUserMessage = EscapedUserMessage.Replace(TEXT("\""), TEXT("\\\"")); // Escape quotes
-    EscapedUserMessage = EscapedUserMessage.Replace(TEXT("\n"), TEXT("\\n")); // Escape newlines
-    EscapedUserMessage = EscapedUserMessage.Replace(TEXT("\r"), TEXT("\\r")); // Escape carriage returns
-    EscapedUserMessage = EscapedUserMessage.Replace(TEXT("\t"), TEXT("\\t")); // Escape tabs
-
-    TagValues.Add(TEXT("SYSTEM_PROMPT"), EscapedSystemPrompt);
-    TagValues.Add(TEXT("USER_MESSAGE"), EscapedUserMessage);
-    TagValues.Add(TEXT("TEMPERATURE"), TEXT("0.7"));
-
-    return ReplaceTags(AIPayloadTemplate, TagValues);
+    return FADSAIRequestBuilder::FillPayloadTemplate(AIPayloadTemplate, Model, InMaxTokens,
+        FADSAIRequestBuilder::Escape(SystemPrompt), FADSAIRequestBuilder::Escape(UserMessage));
 }
 
 TMap<FString, FString> UADSDialogueDeveloperSettings::ProcessHeadersTemplate(const FString& APIKey) const
@@ -0,0 +1,338 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ADSTTSCacheSubsystem.h"
+#include "ADSAITextToSpeech.h"
+#include "ADSDialogueDeveloperSettings.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+
+void UADSTTSCacheSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	InitializeCache(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("ADS"), TEXT("TTSCache")));
+}
+
+void UADSTTSCacheSubsystem::InitializeCache(const FString& directory)
+{
+	CacheDirectory = directory;
+	DiskEntries.Empty();
+	DiskSize = 0;
+
+	// index the lines cached by previous sessions, the file timestamp is the last access time
+	IFileManager::Get().IterateDirectoryStat(*CacheDirectory, [this](const TCHAR* path, const FFileStatData& statData) {
+		if (!statData.bIsDirectory && FPaths::GetExtension(path) == TEXT("wav")) {
+			FDiskEntry& entry = DiskEntries.Add(FPaths::GetBaseFilename(path));
+			entry.Size = statData.FileSize;
+			entry.LastAccess = statData.ModificationTime;
+			DiskSize += statData.FileSize;
+		}
+		return true;
+	});
+
+	EvictDisk();
+}
+
+void UADSTTSCacheSubsystem::SetMaxSizes(int64 maxDiskSize, int64 maxMemorySize)
+{
+	MaxDiskSizeOverride = maxDiskSize;
+	MaxMemorySizeOverride = maxMemorySize;
+
+	EvictMemory();
+	EvictDisk();
+}
+
+void UADSTTSCacheSubsystem::Deinitialize()
+{
+	DiskEntries.Empty();
+	MemoryEntries.Empty();
+	PrefetchQueue.Empty();
+	PrefetchWaiters.Empty();
+	DiskSize = 0;
+	MemorySize = 0;
+
+	Super::Deinitialize();
+}
+
+FString UADSTTSCacheSubsystem::MakeCacheKey(const FString& text, const FString& voice, const FString& model)
+{
+	const FTCHARToUTF8 content(*FString::Printf(TEXT("%s\n%s\n%s"), *text, *voice, *model));
+	uint8 hash[FSHA1::DigestSize];
+	FSHA1::HashBuffer(content.Get(), content.Length(), hash);
+	return BytesToHex(hash, FSHA1::DigestSize);
+}
+
+TSharedRef<IHttpRequest, ESPMode::ThreadSafe> UADSTTSCacheSubsystem::CreateTTSRequest(const FString& text, const FString& voice, const FString& model, const FString& endpoint, const FString& apiKey)
+{
+	const UADSDialogueDeveloperSettings* settings = GetDefault<UADSDialogueDeveloperSettings>();
+
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> request = FHttpModule::Get().CreateRequest();
+	request->SetURL(endpoint);
+	request->SetVerb(TEXT("POST"));
+
+	for (const auto& headerPair : settings->ProcessTTSHeadersTemplate(apiKey)) {
+		request->SetHeader(headerPair.Key, headerPair.Value);
+	}
+
+	request->SetContentAsString(settings->ProcessTTSPayloadTemplate(text, voice, model));
+	return request;
+}
+
+bool UADSTTSCacheSubsystem::IsCacheEnabled() const
+{
+	return GetDefault<UADSDialogueDeveloperSettings>()->IsTTSCacheEnabled();
+}
+
+bool UADSTTSCacheSubsystem::IsCached(const FString& key) const
+{
+	return MemoryEntries.Contains(key) || DiskEntries.Contains(key);
+}
+
+bool UADSTTSCacheSubsystem::TryGetFromMemory(const FString& key, TArray<uint8>& outAudioData)
+{
+	FMemoryEntry* entry = MemoryEntries.Find(key);
+	if (!entry) {
+		return false;
+	}
+
+	entry->LastAccess = ++AccessCounter;
+	outAudioData = *entry->AudioData;
+	Touch(key);
+	return true;
+}
+
+void UADSTTSCacheSubsystem::LoadAsync(const FString& key, FOnADSTTSCacheLoaded onLoaded)
+{
+	if (!DiskEntries.Contains(key)) {
+		onLoaded.ExecuteIfBound(false, TArray<uint8>());
+		return;
+	}
+
+	Touch(key);
+
+	TWeakObjectPtr<UADSTTSCacheSubsystem> weakThis(this);
+	Async(EAsyncExecution::ThreadPool, [weakThis, key, filePath = GetCacheFilePath(key), onLoaded]() {
+		TSharedPtr<TArray<uint8>, ESPMode::ThreadSafe> audioData = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>();
+		const bool bLoaded = FFileHelper::LoadFileToArray(*audioData, *filePath, FILEREAD_Silent) && audioData->Num() > 0;
+
+		AsyncTask(ENamedThreads::GameThread, [weakThis, key, audioData, bLoaded, onLoaded]() {
+			if (UADSTTSCacheSubsystem* cache = weakThis.Get()) {
+				if (bLoaded) {
+					cache->AddToMemory(key, audioData);
+				} else if (const FDiskEntry* entry = cache->DiskEntries.Find(key)) {
+					// the file was deleted behind our back
+					cache->DiskSize -= entry->Size;
+					cache->DiskEntries.Remove(key);
+				}
+			}
+			onLoaded.ExecuteIfBound(bLoaded, *audioData);
+		});
+	});
+}
+
+void UADSTTSCacheSubsystem::Store(const FString& key, const TArray<uint8>& audioData)
+{
+	if (audioData.Num() == 0) {
+		return;
+	}
+
+	TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> sharedData = MakeShared<const TArray<uint8>, ESPMode::ThreadSafe>(audioData);
+	AddToMemory(key, sharedData);
+
+	if (const FDiskEntry* existing = DiskEntries.Find(key)) {
+		DiskSize -= existing->Size;
+	}
+	FDiskEntry& entry = DiskEntries.Add(key);
+	entry.Size = audioData.Num();
+	entry.LastAccess = FDateTime::UtcNow();
+	entry.AccessOrder = ++AccessCounter;
+	DiskSize += entry.Size;
+
+	Async(EAsyncExecution::ThreadPool, [sharedData, filePath = GetCacheFilePath(key)]() {
+		if (!FFileHelper::SaveArrayToFile(*sharedData, *filePath)) {
+			UE_LOG(ADSAITextToSpeechLog, Warning, TEXT("Failed to write TTS cache file %s"), *filePath);
+		}
+	});
+
+	EvictDisk();
+}
+
+void UADSTTSCacheSubsystem::Prefetch(const FString& text, const FString& voice, const FString& model, const FString& endpoint, const FString& apiKey)
+{
+	if (text.IsEmpty() || apiKey.IsEmpty()) {
+		return;
+	}
+
+	const FString key = MakeCacheKey(text, voice, model);
+	if (IsCached(key) || PrefetchWaiters.Contains(key)) {
+		return;
+	}
+
+	PrefetchWaiters.Add(key);
+	PrefetchQueue.Add({ key, text, voice, model, endpoint, apiKey });
+	StartNextPrefetch();
+}
+
+bool UADSTTSCacheSubsystem::WaitForPrefetch(const FString& key, FOnADSTTSCacheLoaded onLoaded)
+{
+	TArray<FOnADSTTSCacheLoaded>* waiters = PrefetchWaiters.Find(key);
+	if (!waiters) {
+		return false;
+	}
+
+	waiters->Add(onLoaded);
+	return true;
+}
+
+void UADSTTSCacheSubsystem::ClearTTSCache()
+{
+	for (const TPair<FString, FDiskEntry>& entry : DiskEntries) {
+		IFileManager::Get().Delete(*GetCacheFilePath(entry.Key), false, false, true);
+	}
+
+	DiskEntries.Empty();
+	MemoryEntries.Empty();
+	DiskSize = 0;
+	MemorySize = 0;
+}
+
+FString UADSTTSCacheSubsystem::GetCacheFilePath(const FString& key) const
+{
+	return FPaths::Combine(CacheDirectory, key + TEXT(".wav"));
+}
+
+int64 UADSTTSCacheSubsystem::GetMaxDiskSize() const
+{
+	return MaxDiskSizeOverride >= 0 ? MaxDiskSizeOverride : GetDefault<UADSDialogueDeveloperSettings>()->GetTTSCacheMaxSize();
+}
+
+int64 UADSTTSCacheSubsystem::GetMaxMemorySize() const
+{
+	return MaxMemorySizeOverride >= 0 ? MaxMemorySizeOverride : GetDefault<UADSDialogueDeveloperSettings>()->GetTTSMemoryCacheMaxSize();
+}
+
+void UADSTTSCacheSubsystem::Touch(const FString& key)
+{
+	if (FDiskEntry* entry = DiskEntries.Find(key)) {
+		entry->LastAccess = FDateTime::UtcNow();
+		entry->AccessOrder = ++AccessCounter;
+
+		// persist the access time for the next sessions
+		Async(EAsyncExecution::ThreadPool, [filePath = GetCacheFilePath(key), accessTime = entry->LastAccess]() {
+			IFileManager::Get().SetTimeStamp(*filePath, accessTime);
+		});
+	}
+}
+
+void UADSTTSCacheSubsystem::AddToMemory(const FString& key, const TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe>& audioData)
+{
+	const int64 maxMemorySize = GetMaxMemorySize();
+	if (!audioData.IsValid() || audioData->Num() > maxMemorySize) {
+		return;
+	}
+
+	if (const FMemoryEntry* existing = MemoryEntries.Find(key)) {
+		MemorySize -= existing->AudioData->Num();
+	}
+
+	FMemoryEntry& entry = MemoryEntries.Add(key);
+	entry.AudioData = audioData;
+	entry.LastAccess = ++AccessCounter;
+	MemorySize += audioData->Num();
+
+	EvictMemory();
+}
+
+void UADSTTSCacheSubsystem::EvictMemory()
+{
+	const int64 maxMemorySize = GetMaxMemorySize();
+	while (MemorySize > maxMemorySize && MemoryEntries.Num() > 0) {
+		auto oldest = MemoryEntries.CreateIterator();
+		for (auto it = MemoryEntries.CreateIterator(); it; ++it) {
+			if (it.Value().LastAccess < oldest.Value().LastAccess) {
+				oldest = it;
+			}
+		}
+		MemorySize -= oldest.Value().AudioData->Num();
+		oldest.RemoveCurrent();
+	}
+}
+
+void UADSTTSCacheSubsystem::EvictDisk()
+{
+	const int64 maxDiskSize = GetMaxDiskSize();
+	if (DiskSize <= maxDiskSize) {
+		return;
+	}
+
+	TArray<FString> keys;
+	DiskEntries.GetKeys(keys);
+	keys.Sort([this](const FString& A, const FString& B) {
+		const FDiskEntry& entryA = DiskEntries[A];
+		const FDiskEntry& entryB = DiskEntries[B];
+		return entryA.LastAccess < entryB.LastAccess || (entryA.LastAccess == entryB.LastAccess && entryA.AccessOrder < entryB.AccessOrder);
+	});
+
+	TArray<FString> filesToDelete;
+	for (const FString& key : keys) {
+		if (DiskSize <= maxDiskSize) {
+			break;
+		}
+		DiskSize -= DiskEntries[key].Size;
+		DiskEntries.Remove(key);
+		filesToDelete.Add(GetCacheFilePath(key));
+	}
+
+	Async(EAsyncExecution::ThreadPool, [filesToDelete = MoveTemp(filesToDelete)]() {
+		for (const FString& filePath : filesToDelete) {
+			IFileManager::Get().Delete(*filePath, false, false, true);
+		}
+	});
+}
+
+void UADSTTSCacheSubsystem::StartNextPrefetch()
+{
+	while (NumActivePrefetches < MaxConcurrentPrefetches && PrefetchQueue.Num() > 0) {
+		const FPrefetchRequest prefetch = PrefetchQueue[0];
+		PrefetchQueue.RemoveAt(0);
+
+		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> request = CreateTTSRequest(prefetch.Text, prefetch.Voice, prefetch.Model, prefetch.Endpoint, prefetch.ApiKey);
+
+		TWeakObjectPtr<UADSTTSCacheSubsystem> weakThis(this);
+		const FString key = prefetch.Key;
+		request->OnProcessRequestComplete().BindLambda([weakThis, key](FHttpRequestPtr requestPtr, FHttpResponsePtr response, bool bSuccess) {
+			if (UADSTTSCacheSubsystem* cache = weakThis.Get()) {
+				cache->NumActivePrefetches--;
+				const bool bValid = bSuccess && response.IsValid() && response->GetResponseCode() == 200 && response->GetContent().Num() > 0;
+				cache->CompletePrefetch(key, bValid ? response->GetContent() : TArray<uint8>(), bValid);
+				cache->StartNextPrefetch();
+			}
+		});
+
+		NumActivePrefetches++;
+		if (!request->ProcessRequest()) {
+			NumActivePrefetches--;
+			CompletePrefetch(key, TArray<uint8>(), false);
+		}
+	}
+}
+
+void UADSTTSCacheSubsystem::CompletePrefetch(const FString& key, const TArray<uint8>& audioData, bool bSuccess)
+{
+	if (bSuccess) {
+		Store(key, audioData);
+	} else {
+		UE_LOG(ADSAITextToSpeechLog, Warning, TEXT("TTS prefetch failed, the line will be generated when spoken"));
+	}
+
+	TArray<FOnADSTTSCacheLoaded> waiters;
+	PrefetchWaiters.RemoveAndCopyValue(key, waiters);
+	for (const FOnADSTTSCacheLoaded& waiter : waiters) {
+		waiter.ExecuteIfBound(bSuccess, audioData);
+	}
+}
@@ -0,0 +1,530 @@
+#include "ADSVisemeAnalyzer.h"
+#include "Async/Async.h"
+#include "Math/VectorRegister.h"
+
+namespace ADSVisemes
+{
+    // Intensity boost applied to each viseme to make it more readable on the face
+    static const float IntensityMultipliers[Num] =
+    {
+        1.0f, // sil
+        1.8f, // PP
+        1.8f, // FF
+        1.6f, // TH
+        1.8f, // DD
+        1.9f, // kk
+        1.6f, // CH
+        1.6f, // SS
+        1.7f, // nn
+        1.7f, // RR
+        2.0f, // aa
+        1.8f, // E
+        1.8f, // ih
+        2.0f, // oh
+        2.0f, // ou
+    };
+
+    // Band masks repeat every 12 samples of the first channel for any channel count, as bands are chosen by index % 6
+    constexpr int32 BandPeriod = 12;
+}
+
+// === ANALYZER ===
+
+FADSVisemeAnalyzer::FADSVisemeAnalyzer(int32 InSampleRate, int32 InNumChannels, float InFrameDuration)
+    : SampleRate(InSampleRate)
+    , NumChannels(InNumChannels)
+    , FrameDuration(FMath::Clamp(InFrameDuration, 0.016f, 0.05f)) // Optimized frame duration for better lip-sync (60fps timing)
+{
+}
+
+void FADSVisemeAnalyzer::Append(const uint8* Data, int32 NumBytes, TArray<FADSVisemeWeights>& OutFrames)
+{
+    if (!bHeaderChecked)
+    {
+        bHeaderChecked = true;
+
+        // Parse WAV header if present
+        const int32 PCMDataOffset = ParseWAVHeader(Data, NumBytes, SampleRate, NumChannels);
+        Data += PCMDataOffset;
+        NumBytes -= PCMDataOffset;
+
+        SampleRate = FMath::Max(SampleRate, 1);
+        NumChannels = FMath::Max(NumChannels, 1);
+        SamplesPerFrame = FMath::Max(NumChannels, FMath::RoundToInt(SampleRate * NumChannels * FrameDuration));
+    }
+
+    if (NumBytes <= 0)
+    {
+        return;
+    }
+
+    NumReceivedBytes += NumBytes;
+    PendingBytes.Append(Data, NumBytes);
+
+    const int32 BytesPerFrame = SamplesPerFrame * sizeof(int16);
+    int32 ConsumedBytes = 0;
+    while (PendingBytes.Num() - ConsumedBytes >= BytesPerFrame)
+    {
+        const int16* Samples = reinterpret_cast<const int16*>(PendingBytes.GetData() + ConsumedBytes);
+        AnalyzeFrame(Samples, SamplesPerFrame, NumAnalyzedSamples, OutFrames.AddDefaulted_GetRef());
+
+        NumAnalyzedSamples += SamplesPerFrame;
+        ConsumedBytes += BytesPerFrame;
+    }
+
+    if (ConsumedBytes > 0)
+    {
+        PendingBytes.RemoveAt(0, ConsumedBytes);
+    }
+}
+
+void FADSVisemeAnalyzer::Flush(TArray<FADSVisemeWeights>& OutFrames)
+{
+    const int32 NumRemainingSamples = PendingBytes.Num() / sizeof(int16);
+    if (NumRemainingSamples > 0)
+    {
+        AnalyzeFrame(reinterpret_cast<const int16*>(PendingBytes.GetData()), NumRemainingSamples, NumAnalyzedSamples, OutFrames.AddDefaulted_GetRef());
+        NumAnalyzedSamples += NumRemainingSamples;
+    }
+
+    PendingBytes.Empty();
+}
+
+double FADSVisemeAnalyzer::GetAudioDuration() const
+{
+    // 2 bytes per sample (16-bit)
+    return (double)NumReceivedBytes / ((double)FMath::Max(SampleRate, 1) * (double)FMath::Max(NumChannels, 1) * 2.0);
+}
+
+int32 FADSVisemeAnalyzer::ParseWAVHeader(const uint8* Data, int32 NumBytes, int32& OutSampleRate, int32& OutNumChannels)
+{
+    if (NumBytes <= 44)
+    {
+        return 0;
+    }
+
+    // Check WAV signature
+    if (Data[0] != 'R' || Data[1] != 'I' || Data[2] != 'F' || Data[3] != 'F')
+    {
+        return 0;
+    }
+
+    // Read parameters from WAV header
+    OutNumChannels = *(const int16*)(Data + 22);
+    OutSampleRate = *(const int32*)(Data + 24);
+
+    // Find PCM data start (search for "data" chunk)
+    int32 DataOffset = 44; // Default
+    for (int32 i = 12; i < NumBytes - 8; i++)
+    {
+        if (Data[i] == 'd' && Data[i + 1] == 'a' && Data[i + 2] == 't' && Data[i + 3] == 'a')
+        {
+            DataOffset = i + 8; // Skip "data" + size (4 bytes)
+            break;
+        }
+    }
+
+    return DataOffset;
+}
+
+void FADSVisemeAnalyzer::AnalyzeFrame(const int16* Samples, int32 NumFrameSamples, int64 FirstSampleIndex, FADSVisemeWeights& OutWeights)
+{
+    using namespace ADSVisemes;
+
+    // Normalize the first channel to -1..1 in a contiguous buffer so the kernels below can run 4 samples at a time
+    const int32 NumChannelSamples = (NumFrameSamples + NumChannels - 1) / NumChannels;
+    ScratchSamples.SetNumUninitialized(NumChannelSamples);
+    float* S = ScratchSamples.GetData();
+    for (int32 k = 0; k < NumChannelSamples; ++k)
+    {
+        S[k] = (float)Samples[k * NumChannels] / 32767.0f;
+    }
+
+    const int32 NumSamplesPerChannel = FMath::Max(1, NumFrameSamples / NumChannels);
+    float Lanes[4];
+
+    // Calculate RMS energy with better normalization
+    VectorRegister4Float EnergySum = VectorZeroFloat();
+    VectorRegister4Float MaxAbs = VectorZeroFloat();
+    int32 k = 0;
+    for (; k + 4 <= NumChannelSamples; k += 4)
+    {
+        const VectorRegister4Float Value = VectorLoad(S + k);
+        EnergySum = VectorMultiplyAdd(Value, Value, EnergySum);
+        MaxAbs = VectorMax(MaxAbs, VectorAbs(Value));
+    }
+
+    VectorStore(EnergySum, Lanes);
+    float TotalEnergy = Lanes[0] + Lanes[1] + Lanes[2] + Lanes[3];
+    VectorStore(MaxAbs, Lanes);
+    float MaxAmplitude = FMath::Max(FMath::Max(Lanes[0], Lanes[1]), FMath::Max(Lanes[2], Lanes[3]));
+    for (; k < NumChannelSamples; ++k)
+    {
+        TotalEnergy += S[k] * S[k];
+        MaxAmplitude = FMath::Max(MaxAmplitude, FMath::Abs(S[k]));
+    }
+    TotalEnergy = FMath::Sqrt(TotalEnergy / NumSamplesPerChannel);
+
+    // Simple frequency analysis using time-domain differences, bands are picked by the interleaved sample index
+    float BandMasks[3][BandPeriod];
+    for (int32 j = 0; j < BandPeriod; ++j)
+    {
+        const int64 SampleIndex = FirstSampleIndex + (int64)j * NumChannels;
+        const int32 Band = (SampleIndex % 3 == 0) ? 0 : ((SampleIndex % 2 == 0) ? 1 : 2);
+        BandMasks[0][j] = Band == 0 ? 1.0f : 0.0f;
+        BandMasks[1][j] = Band == 1 ? 1.0f : 0.0f;
+        BandMasks[2][j] = Band == 2 ? 1.0f : 0.0f;
+    }
+
+    const int32 NumDiffSamples = NumChannelSamples - 1;
+    VectorRegister4Float HighSum = VectorZeroFloat();
+    VectorRegister4Float MidSum = VectorZeroFloat();
+    VectorRegister4Float LowSum = VectorZeroFloat();
+    k = 0;
+    for (; k + 4 <= NumDiffSamples; k += 4)
+    {
+        const VectorRegister4Float Diff = VectorSubtract(VectorLoad(S + k + 1), VectorLoad(S + k));
+        const VectorRegister4Float DiffSquared = VectorMultiply(Diff, Diff);
+        const int32 Phase = k % BandPeriod;
+        HighSum = VectorMultiplyAdd(DiffSquared, VectorLoad(&BandMasks[0][Phase]), HighSum);
+        MidSum = VectorMultiplyAdd(DiffSquared, VectorLoad(&BandMasks[1][Phase]), MidSum);
+        LowSum = VectorMultiplyAdd(DiffSquared, VectorLoad(&BandMasks[2][Phase]), LowSum);
+    }
+
+    VectorStore(HighSum, Lanes);
+    float HighFreqEnergy = Lanes[0] + Lanes[1] + Lanes[2] + Lanes[3];
+    VectorStore(MidSum, Lanes);
+    float MidFreqEnergy = Lanes[0] + Lanes[1] + Lanes[2] + Lanes[3];
+    VectorStore(LowSum, Lanes);
+    float LowFreqEnergy = Lanes[0] + Lanes[1] + Lanes[2] + Lanes[3];
+    for (; k < NumDiffSamples; ++k)
+    {
+        const float Diff = S[k + 1] - S[k];
+        const int32 Phase = k % BandPeriod;
+        HighFreqEnergy += Diff * Diff * BandMasks[0][Phase];
+        MidFreqEnergy += Diff * Diff * BandMasks[1][Phase];
+        LowFreqEnergy += Diff * Diff * BandMasks[2][Phase];
+    }
+
+    const int32 NumDiffs = FMath::Max(1, NumSamplesPerChannel - 1);
+    HighFreqEnergy = FMath::Sqrt(HighFreqEnergy / (NumDiffs / 3.0f + 1));
+    MidFreqEnergy = FMath::Sqrt(MidFreqEnergy / (NumDiffs / 3.0f + 1));
+    LowFreqEnergy = FMath::Sqrt(LowFreqEnergy / (NumDiffs / 3.0f + 1));
+
+    // Enhanced zero crossing rate for pitch detection
+    int32 ZeroCrossings = 0;
+    bool bLastNegative = false;
+    for (k = 0; k < NumChannelSamples; ++k)
+    {
+        const bool bNegative = S[k] < 0.0f;
+        ZeroCrossings += bNegative != bLastNegative;
+        bLastNegative = bNegative;
+    }
+    const float ZeroCrossingRate = (float)ZeroCrossings / FMath::Max(1, NumSamplesPerChannel - 1);
+
+    // Spectral centroid approximation
+    const float SpectralCentroid = (HighFreqEnergy * 3.0f + MidFreqEnergy * 2.0f + LowFreqEnergy * 1.0f) /
+                                   FMath::Max(0.001f, HighFreqEnergy + MidFreqEnergy + LowFreqEnergy);
+
+    // Enhanced intensity calculation with adaptive scaling
+    float RawIntensity = TotalEnergy;
+    if (MaxAmplitude > 0.5f) // Loud speech
+    {
+        RawIntensity *= 1.2f;
+    }
+    else if (MaxAmplitude < 0.1f) // Quiet speech
+    {
+        RawIntensity *= 3.5f;
+    }
+    else
+    {
+        RawIntensity *= 2.5f;
+    }
+
+    // Dynamic range compression
+    RawIntensity = FMath::Pow(RawIntensity, 0.9f);
+
+    // Silence detection with improved threshold
+    if (TotalEnergy < 0.002f || MaxAmplitude < 0.01f)
+    {
+        LastFrameIntensity = FMath::Lerp(LastFrameIntensity, 0.0f, 0.4f);
+        OutWeights.Values[Sil] = LastFrameIntensity;
+        return;
+    }
+
+    int32 Viseme = Sil;
+
+    // Primary vowel detection with energy-based classification
+    if (TotalEnergy > 0.04f && ZeroCrossingRate < 0.35f && SpectralCentroid < 2.2f)
+    {
+        if (LowFreqEnergy > HighFreqEnergy * 1.3f) // Low formant dominance
+        {
+            Viseme = MidFreqEnergy > LowFreqEnergy * 0.6f ? aa : oh;
+        }
+        else if (HighFreqEnergy > LowFreqEnergy * 0.6f) // Higher formants
+        {
+            Viseme = SpectralCentroid > 1.8f ? ih : ou;
+        }
+        else // Balanced formants
+        {
+            Viseme = E;
+        }
+    }
+    // Fricative and sibilant detection
+    else if (HighFreqEnergy > 0.08f || (ZeroCrossingRate > 0.4f && SpectralCentroid > 2.0f))
+    {
+        if (HighFreqEnergy > 0.2f && ZeroCrossingRate > 0.6f) // Strong sibilants
+        {
+            Viseme = SS;
+        }
+        else if (TotalEnergy > 0.03f && HighFreqEnergy > 0.08f) // Fricatives
+        {
+            Viseme = SpectralCentroid > 2.2f ? FF : CH;
+        }
+        else // Weak fricatives
+        {
+            Viseme = TH;
+        }
+    }
+    // Plosive and stop consonant detection
+    else if (TotalEnergy > 0.04f && ZeroCrossingRate > 0.25f && MaxAmplitude > 0.15f)
+    {
+        if (HighFreqEnergy > MidFreqEnergy * 1.0f) // High-frequency bursts
+        {
+            Viseme = SpectralCentroid > 1.8f ? kk : DD;
+        }
+        else if (LowFreqEnergy > HighFreqEnergy * 0.8f) // Low-frequency emphasis
+        {
+            Viseme = PP;
+        }
+        else
+        {
+            Viseme = DD;
+        }
+    }
+    // Nasal and liquid consonant detection
+    else if (TotalEnergy > 0.02f)
+    {
+        if (ZeroCrossingRate < 0.2f && LowFreqEnergy > HighFreqEnergy * 1.1f) // Low-frequency dominated
+        {
+            Viseme = MidFreqEnergy > LowFreqEnergy * 0.3f ? nn : RR;
+        }
+        else if (ZeroCrossingRate > 0.15f && ZeroCrossingRate < 0.4f) // Moderate modulation
+        {
+            Viseme = SpectralCentroid > 1.4f ? ih : RR;
+        }
+        else if (TotalEnergy > 0.015f)
+        {
+            // Low energy but still detectable - use varied visemes
+            if (ZeroCrossingRate > 0.3f)
+            {
+                Viseme = SS;
+            }
+            else if (ZeroCrossingRate > 0.2f)
+            {
+                Viseme = FF;
+            }
+            else
+            {
+                Viseme = aa;
+            }
+        }
+    }
+
+    // Viseme importance weighting
+    RawIntensity *= IntensityMultipliers[Viseme];
+
+    // Adaptive smoothing based on energy change
+    float SmoothingFactor = 0.25f;
+    const float EnergyDelta = FMath::Abs(RawIntensity - LastFrameIntensity);
+    if (EnergyDelta > 0.3f) // Large energy change
+    {
+        SmoothingFactor = 0.15f;
+    }
+    else if (EnergyDelta < 0.05f) // Small energy change
+    {
+        SmoothingFactor = 0.4f;
+    }
+
+    float Intensity = FMath::Lerp(LastFrameIntensity, RawIntensity, SmoothingFactor);
+
+    // Minimum intensity enforcement for non-silence
+    if (Viseme != Sil)
+    {
+        Intensity = FMath::Max(Intensity, 0.25f);
+    }
+
+    Intensity = FMath::Clamp(Intensity, 0.0f, 1.0f);
+
+    // Soft limit near maximum to prevent harsh animation
+    if (Intensity > 0.85f)
+    {
+        Intensity = 0.85f + (Intensity - 0.85f) * 0.3f;
+    }
+
+    LastFrameIntensity = Intensity;
+    OutWeights.Values[Viseme] = Intensity;
+}
+
+// === STREAM ===
+
+FADSVisemeStream::FADSVisemeStream(int32 InSampleRate, int32 InNumChannels, float InFrameDuration)
+    : Analyzer(InSampleRate, InNumChannels, InFrameDuration)
+    , FrameDuration(Analyzer.GetFrameDuration())
+{
+}
+
+void FADSVisemeStream::Enqueue(TArray<uint8>&& AudioChunk)
+{
+    if (AudioChunk.Num() == 0)
+    {
+        return;
+    }
+
+    FScopeLock Lock(&PendingLock);
+    if (bFinishRequested || bCancelled)
+    {
+        return;
+    }
+
+    PendingChunks.Add(MoveTemp(AudioChunk));
+    LaunchWorker();
+}
+
+void FADSVisemeStream::Finish()
+{
+    FScopeLock Lock(&PendingLock);
+    if (bFinishRequested)
+    {
+        return;
+    }
+
+    bFinishRequested = true;
+    LaunchWorker();
+}
+
+void FADSVisemeStream::Cancel()
+{
+    bCancelled = true;
+
+    FScopeLock Lock(&PendingLock);
+    PendingChunks.Empty();
+}
+
+void FADSVisemeStream::LaunchWorker()
+{
+    // PendingLock is held by the caller
+    if (bWorkerRunning)
+    {
+        return;
+    }
+
+    bWorkerRunning = true;
+    Async(EAsyncExecution::ThreadPool, [Stream = AsShared()]()
+    {
+        Stream->ProcessPending();
+    });
+}
+
+void FADSVisemeStream::ProcessPending()
+{
+    TArray<FADSVisemeWeights> NewFrames;
+
+    while (true)
+    {
+        TArray<uint8> Chunk;
+        bool bFlush = false;
+        {
+            FScopeLock Lock(&PendingLock);
+            if (bCancelled)
+            {
+                bWorkerRunning = false;
+                return;
+            }
+
+            if (PendingChunks.Num() > 0)
+            {
+                Chunk = MoveTemp(PendingChunks[0]);
+                PendingChunks.RemoveAt(0);
+            }
+            else if (bFinishRequested)
+            {
+                bFlush = true;
+            }
+            else
+            {
+                bWorkerRunning = false;
+                return;
+            }
+        }
+
+        NewFrames.Reset();
+        if (bFlush)
+        {
+            Analyzer.Flush(NewFrames);
+        }
+        else
+        {
+            Analyzer.Append(Chunk.GetData(), Chunk.Num(), NewFrames);
+        }
+
+        {
+            FScopeLock Lock(&FramesLock);
+            Frames.Append(NewFrames);
+            Duration = Analyzer.GetAudioDuration();
+            bComplete = bFlush;
+        }
+
+        if (bFlush)
+        {
+            // finish is never requested twice, the worker is done for good
+            FScopeLock Lock(&PendingLock);
+            bWorkerRunning = false;
+            return;
+        }
+    }
+}
+
+bool FADSVisemeStream::Sample(double Time, FADSVisemeWeights& OutWeights) const
+{
+    OutWeights = FADSVisemeWeights();
+
+    FScopeLock Lock(&FramesLock);
+    if (bComplete && (Time >= Duration || Frames.Num() == 0))
+    {
+        return false;
+    }
+
+    // Calculate current frame based on time and frame rate
+    const double FrameTime = FMath::Max(Time, 0.0) / FrameDuration;
+    const int32 CurrentFrameIndex = FMath::FloorToInt(FrameTime);
+    if (CurrentFrameIndex >= Frames.Num())
+    {
+        // analysis has not caught up with playback yet, keep the mouth closed
+        return true;
+    }
+
+    const int32 NextFrameIndex = FMath::Min(CurrentFrameIndex + 1, Frames.Num() - 1);
+    const float Alpha = FMath::Clamp((float)(FrameTime - CurrentFrameIndex), 0.0f, 1.0f);
+
+    const FADSVisemeWeights& StartFrame = Frames[CurrentFrameIndex];
+    const FADSVisemeWeights& EndFrame = Frames[NextFrameIndex];
+    for (int32 i = 0; i < ADSVisemes::Num; ++i)
+    {
+        OutWeights.Values[i] = FMath::Lerp(StartFrame.Values[i], EndFrame.Values[i], Alpha);
+    }
+
+    return true;
+}
+
+int32 FADSVisemeStream::GetNumFrames() const
+{
+    FScopeLock Lock(&FramesLock);
+    return Frames.Num();
+}
+
+bool FADSVisemeStream::IsComplete() const
+{
+    FScopeLock Lock(&FramesLock);
+    return bComplete;
+}
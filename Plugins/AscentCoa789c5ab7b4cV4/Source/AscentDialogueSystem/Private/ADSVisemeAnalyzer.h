@@ -0,0 +1,115 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include <atomic>
+
+namespace ADSVisemes
+{
+    // Indices match UADSMetahumanLipSync::VisemeNames
+    enum EIndex : int32
+    {
+        Sil = 0, PP, FF, TH, DD, kk, CH, SS, nn, RR, aa, E, ih, oh, ou,
+        Num
+    };
+}
+
+/** Weight of every viseme for a single analysis frame, indexed by ADSVisemes::EIndex */
+struct FADSVisemeWeights
+{
+    float Values[ADSVisemes::Num] = {};
+};
+
+/**
+ * Incremental viseme analyzer for 16-bit PCM audio.
+ *
+ * Audio can be appended in chunks of any size (a WAV header is accepted on the first chunk): every
+ * complete frame is analyzed as soon as it is available and the trailing partial frame on Flush.
+ * Energy and band accumulation are vectorized over the frame samples.
+ */
+class FADSVisemeAnalyzer
+{
+public:
+    FADSVisemeAnalyzer(int32 InSampleRate, int32 InNumChannels, float InFrameDuration);
+
+    /** Analyze every complete frame available after appending the chunk */
+    void Append(const uint8* Data, int32 NumBytes, TArray<FADSVisemeWeights>& OutFrames);
+
+    /** Analyze the remaining samples as a last, shorter frame */
+    void Flush(TArray<FADSVisemeWeights>& OutFrames);
+
+    float GetFrameDuration() const { return FrameDuration; }
+
+    /** Duration in seconds of all the audio appended so far */
+    double GetAudioDuration() const;
+
+    /** Parse a WAV header and return the PCM data offset, or 0 if the data has no header */
+    static int32 ParseWAVHeader(const uint8* Data, int32 NumBytes, int32& OutSampleRate, int32& OutNumChannels);
+
+private:
+    void AnalyzeFrame(const int16* Samples, int32 NumFrameSamples, int64 FirstSampleIndex, FADSVisemeWeights& OutWeights);
+
+    int32 SampleRate;
+    int32 NumChannels;
+    float FrameDuration;
+    int32 SamplesPerFrame = 0;
+
+    bool bHeaderChecked = false;
+
+    // bytes not yet forming a complete frame
+    TArray<uint8> PendingBytes;
+    int64 NumAnalyzedSamples = 0;
+    int64 NumReceivedBytes = 0;
+
+    float LastFrameIntensity = 0.0f;
+
+    // reused buffer of normalized samples of the first channel
+    TArray<float> ScratchSamples;
+};
+
+/**
+ * Viseme frames of a single line of audio, analyzed on a background thread as chunks are queued.
+ * Shared between the lip sync component and its analysis task so either one can go away first.
+ */
+class FADSVisemeStream : public TSharedFromThis<FADSVisemeStream, ESPMode::ThreadSafe>
+{
+public:
+    FADSVisemeStream(int32 InSampleRate, int32 InNumChannels, float InFrameDuration);
+
+    /** Queue a chunk of audio for background analysis */
+    void Enqueue(TArray<uint8>&& AudioChunk);
+
+    /** Mark the end of the audio, the trailing partial frame is analyzed once queued chunks are done */
+    void Finish();
+
+    /** Drop any queued audio, frames already analyzed stay available */
+    void Cancel();
+
+    /**
+     * Interpolated viseme weights at the provided playback time. Safe to call from any thread.
+     * @return False once the whole audio has been analyzed and played.
+     */
+    bool Sample(double Time, FADSVisemeWeights& OutWeights) const;
+
+    int32 GetNumFrames() const;
+    bool IsComplete() const;
+
+private:
+    void LaunchWorker();
+    void ProcessPending();
+
+    FADSVisemeAnalyzer Analyzer;
+    const float FrameDuration;
+
+    FCriticalSection PendingLock;
+    TArray<TArray<uint8>> PendingChunks;
+    bool bFinishRequested = false;
+    bool bWorkerRunning = false;
+
+    mutable FCriticalSection FramesLock;
+    TArray<FADSVisemeWeights> Frames;
+    double Duration = 0.0;
+    bool bComplete = false;
+
+    std::atomic<bool> bCancelled { false };
+};
@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
 #include "Graph/ADSDialogue.h"
+#include "ADSAIRequestBuilder.h"
 #include "ADSBaseDialoguePartecipantComponent.h"
 #include "CineCameraActor.h"
 #include "Engine/TargetPoint.h"
@@ -122,6 +123,10 @@ public:
     UFUNCTION(BlueprintPure, Category = "ADS|AI")
     FString GetLastErrorMessage() const { return LastErrorMessage; }
 
+    // Gets the time in milliseconds spent building the payload of the last request
+    UFUNCTION(BlueprintPure, Category = "ADS|AI")
+    float GetLastRequestBuildTime() const { return LastRequestBuildTime; }
+
     // Event triggered when AI response is received
     UPROPERTY(BlueprintAssignable, Category = "ADS|AI")
     FOnAIResponseReceived OnAIResponseReceived;
@@ -325,6 +330,18 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ADS|AI", meta = (ClampMin = "1", ClampMax = "50"))
     int32 MaxConversationHistory = 10;
 
+    // Maximum estimated tokens of conversation history sent with each request, older exchanges are left out first (0 = no limit)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ADS|AI", meta = (ClampMin = "0"))
+    int32 MaxHistoryTokens = 0;
+
+    // Answers the requests locally with MockResponse instead of calling the endpoint, to test dialogues without network access
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ADS|AI|Debug")
+    bool bUseMockEndpoint = false;
+
+    // Response returned by the local mock endpoint
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ADS|AI|Debug", meta = (EditCondition = "bUseMockEndpoint"))
+    FString MockResponse = "I have nothing to say right now.";
+
     // Structured conversation history using the new format
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ADS|AI", meta = (AllowPrivateAccess = "true"))
     TArray<FADSConversationEntry> StructuredConversationHistory;
@@ -353,9 +370,21 @@ private:
     // Sets the AI dialogue state and broadcasts the change
     void SetAIDialogueState(EAIDialogueState NewState);
 
+    // Sends a built payload to the endpoint, or to the local mock endpoint
+    void SendAIRequest(const FString& Payload);
+
     // HTTP response handler for AI API calls
     void OnHTTPResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
 
+    // Handles the content of a response of the endpoint
+    void HandleAIResponse(int32 ResponseCode, const FString& ResponseContent);
+
+    // Checks once that a payload template produces valid JSON
+    bool ValidatePayloadTemplate(const FString& PayloadTemplate);
+
+    // Returns the escaped character information, rebuilt only when it changed
+    const FString& GetCharacterPrompt();
+
     // Handles dialogue started events
     UFUNCTION()
     void HandleDialogueStarted();
@@ -375,4 +404,22 @@ private:
 
     // Maintains the conversation history size within limits
     void TrimConversationHistory();
+
+    // Conversation history already formatted for the requests, in sync with StructuredConversationHistory
+    FADSConversationBuffer ConversationBuffer;
+
+    // Escaped character information and the values it was built from
+    FString CharacterPrompt;
+    FString CharacterPromptName;
+    FString CharacterPromptPersonality;
+    FString CharacterPromptDescription;
+    FString CharacterPromptRules;
+
+    // Last payload template checked to produce valid JSON
+    FString ValidatedPayloadTemplate;
+
+    // Identifies the request being built, payloads of cancelled requests are dropped
+    int32 RequestSerial = 0;
+
+    float LastRequestBuildTime = 0.f;
 };
\ No newline at end of file
@@ -0,0 +1,80 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Conversation line already formatted and JSON escaped, shared between the history and the requests being built
+using FADSPromptLine = TSharedRef<const FString, ESPMode::ThreadSafe>;
+
+// Values captured on the game thread to build an AI request payload on any thread
+struct ASCENTDIALOGUESYSTEM_API FADSAIRequestSnapshot {
+    FString PayloadTemplate;
+
+    FString Model;
+
+    int32 MaxTokens = 0;
+
+    // Escaped character information opening the system prompt
+    FString CharacterPrompt;
+
+    // Escaped history lines, oldest first
+    TArray<FADSPromptLine> HistoryLines;
+
+    // Escaped additional context
+    FString Context;
+
+    // Escaped player message
+    FString UserMessage;
+};
+
+// Conversation history kept in the form sent to the AI endpoint.
+// Each turn is formatted and escaped once when it is appended, together with its estimated token count,
+// so building a request only joins the lines that fit the budget instead of escaping the whole conversation again.
+class ASCENTDIALOGUESYSTEM_API FADSConversationBuffer {
+public:
+    // Formats, escapes and appends a turn
+    void Append(const FString& speaker, const FString& message);
+
+    // Drops the oldest turns
+    void RemoveOldest(int32 count);
+
+    void Reset();
+
+    int32 Num() const { return Lines.Num(); }
+
+    int32 GetTotalTokens() const { return TotalTokens; }
+
+    // Collects the most recent lines fitting maxTokens (no limit if 0), oldest first, ignoring the newest skipNewest turns
+    void GatherLines(int32 skipNewest, int32 maxTokens, TArray<FADSPromptLine>& outLines) const;
+
+private:
+    struct FLine {
+        FADSPromptLine Text;
+        int32 Tokens;
+    };
+
+    TArray<FLine> Lines;
+
+    int32 TotalTokens = 0;
+};
+
+// Builds the payloads of the AI dialogue requests. All the functions are thread safe.
+struct ASCENTDIALOGUESYSTEM_API FADSAIRequestBuilder {
+    // Appends text escaped to be placed inside a JSON string
+    static void AppendEscaped(FString& out, FStringView text);
+
+    static FString Escape(FStringView text);
+
+    // Rough token count of a text, about four characters per token for english prose
+    static int32 EstimateTokens(int32 numChars) { return FMath::DivideAndRoundUp(numChars, 4); }
+
+    // Escaped character information opening the system prompt
+    static FString BuildCharacterPrompt(const FString& name, const FString& personality, const FString& description, const FString& rules);
+
+    // Replaces the tags of a payload template in a single pass, the prompt and message must be already escaped
+    static FString FillPayloadTemplate(const FString& payloadTemplate, const FString& model, int32 maxTokens, FStringView escapedSystemPrompt, FStringView escapedUserMessage);
+
+    // Builds the complete request payload
+    static FString BuildPayload(const FADSAIRequestSnapshot& snapshot);
+};
@@ -4,8 +4,12 @@
 #include "Components/ActorComponent.h"
 #include "Sound/SoundWave.h"
 #include <Components/AudioComponent.h>
+#include "Engine/TimerHandle.h"
 #include "ADSAITextToSpeech.generated.h"
 
+class UADSDialogue;
+class USoundWaveProcedural;
+
 DECLARE_LOG_CATEGORY_EXTERN(ADSAITextToSpeechLog, Log, All);
 
 // Enum for AI TTS state
@@ -172,6 +176,14 @@ public:
     UFUNCTION(BlueprintCallable, Category = "ADS AI TTS")
     bool PlayCachedAudioData();
 
+    // Generate the audio of a line in the background so that speaking it later plays from the cache
+    UFUNCTION(BlueprintCallable, Category = "ADS AI TTS")
+    void PrefetchText(const FString& Text);
+
+    // Prefetch the lines following the current node of the dialogue, each with the voice of its speaker
+    UFUNCTION(BlueprintCallable, Category = "ADS AI TTS")
+    void PrefetchDialogueLines(UADSDialogue* Dialogue, int32 MaxDepth = 2);
+
     // === EVENTS ===
     
     // Delegate to notify when AI TTS audio is ready
@@ -220,6 +232,16 @@ protected:
         meta = (DisplayName = "API Key Override", ToolTip = "Local TTS API key override. Leave empty to use global settings.", PasswordField = true))
     FString LocalAITTSAPIKey;
 
+    // === STREAMING ===
+
+    // Start playing generated audio while the response is still being received
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ADS AI TTS")
+    bool bStreamPlayback = true;
+
+    // Seconds of audio to receive before streamed playback starts, to absorb network jitter
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ADS AI TTS", meta = (EditCondition = "bStreamPlayback", ClampMin = "0.0"))
+    float StreamStartBufferSeconds = 0.3f;
+
 private:
     // === ORIGINAL PRIVATE VARIABLES ===
 
@@ -243,6 +265,10 @@ private:
     UPROPERTY()
     TObjectPtr<UAudioComponent> CurrentAudioComponent;
 
+    // Procedural wave reused by every playback
+    UPROPERTY()
+    TObjectPtr<USoundWaveProcedural> PlaybackSoundWave;
+
     // Cached audio data from last successful TTS generation
     UPROPERTY()
     TArray<uint8> CachedAudioData;
@@ -258,9 +284,62 @@ private:
     // Internal AI TTS generation function
     void GenerateAITTSInternal(const FString& Text, const FString& Voice, const FString& Model, const FString& ApiKey, bool bPlayAudio);
 
+    // Send the HTTP request generating a line, streaming the audio to the speaker if requested
+    void RequestAITTS(const FString& Text, const FString& CacheKey, const FString& Voice, const FString& Model, const FString& ApiKey);
+
+    // Handle generated or cached audio of a line
+    void OnAITTSAudioReceived(const FString& Text, const TArray<uint8>& AudioData, bool bPlayAudio, bool bAlreadyPlaying);
+
     // Play audio from buffer
     void PlayAudioFromBuffer(const TArray<uint8>& AudioData, int32 SampleRate, int32 NumChannels, bool bIsWav);
 
+    // Reset the reused sound wave for a new line, queue the initial audio and start the audio component
+    bool BeginPlayback(int32 SampleRate, int32 NumChannels, float Duration, const uint8* PCMData, int32 PCMSize);
+
+    // Queue the streamed audio received so far, starting playback once enough is buffered
+    void PumpStreamedAudio();
+
+    // Stop streaming audio to the speaker, the request itself is left to complete and fill the cache
+    void ResetStream();
+
+    // Stop the streamed line once the sound wave has played all of its queued audio
+    void StopWhenDrained();
+
+    // Incremented for every spoken line, so that late responses of a previous line are ignored
+    int32 ActiveLineId = 0;
+
+    // Whether the audio of the active line must be played once available
+    bool bPlayActiveLine = false;
+
+    // Streamed response received so far, appended from the HTTP thread
+    struct FStreamBuffer
+    {
+        FCriticalSection Lock;
+        TArray<uint8> Data;
+        int32 ResponseCode = 0;
+    };
+    TSharedPtr<FStreamBuffer, ESPMode::ThreadSafe> StreamBuffer;
+
+    // Bytes of the stream buffer already queued to the sound wave
+    int32 StreamReadOffset = 0;
+    int32 StreamSampleRate = 16000;
+    int32 StreamNumChannels = 1;
+    bool bStreamHeaderParsed = false;
+    bool bStreamPlaying = false;
+
+    // Set when the response can't be streamed, the failure is reported once the request completes
+    bool bStreamRejected = false;
+
+    // Line to stop once the sound wave runs out of audio, written on the game thread and read on the audio thread
+    struct FDrainState
+    {
+        FCriticalSection Lock;
+        int32 LineId = INDEX_NONE;
+    };
+    TSharedRef<FDrainState, ESPMode::ThreadSafe> DrainState = MakeShared<FDrainState, ESPMode::ThreadSafe>();
+
+    FTimerHandle StreamPumpTimer;
+
     // Correct WAV header parsing
     int32 ParseWAVHeader(const TArray<uint8>& AudioData, int32& OutSampleRate, int32& OutNumChannels);
 
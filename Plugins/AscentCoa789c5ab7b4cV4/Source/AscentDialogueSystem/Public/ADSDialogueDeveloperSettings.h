@@ -106,6 +106,18 @@ protected:
     UPROPERTY(EditAnywhere, config, Category = "Conversational AI|TTS", meta = (DisplayName = "Enable TTS"))
     bool bEnableTTS = false;
 
+    // Store generated TTS audio on disk, keyed by text, voice and model, so repeated lines don't hit the service again
+    UPROPERTY(EditAnywhere, config, Category = "Conversational AI|TTS", meta = (DisplayName = "Enable TTS Cache"))
+    bool bEnableTTSCache = true;
+
+    // Max size of the TTS disk cache, least recently used lines are evicted first
+    UPROPERTY(EditAnywhere, config, Category = "Conversational AI|TTS", meta = (DisplayName = "TTS Cache Max Size (MB)", ClampMin = "1", EditCondition = "bEnableTTSCache"))
+    int32 TTSCacheMaxSizeMB = 256;
+
+    // Max size of the recently played lines kept in memory on top of the disk cache
+    UPROPERTY(EditAnywhere, config, Category = "Conversational AI|TTS", meta = (DisplayName = "TTS Memory Cache Size (MB)", ClampMin = "0", EditCondition = "bEnableTTSCache"))
+    int32 TTSMemoryCacheSizeMB = 16;
+
 public:
     // Gets the default player response tag
     FGameplayTag GetDefaultPlayerResponseTag() const
@@ -233,6 +245,24 @@ public:
         return bEnableTTS;
     }
 
+    // Gets whether generated TTS audio is cached
+    bool IsTTSCacheEnabled() const
+    {
+        return bEnableTTSCache;
+    }
+
+    // Gets the max size of the TTS disk cache in bytes
+    int64 GetTTSCacheMaxSize() const
+    {
+        return (int64)FMath::Max(TTSCacheMaxSizeMB, 1) * 1024 * 1024;
+    }
+
+    // Gets the max size of the TTS memory cache in bytes
+    int64 GetTTSMemoryCacheMaxSize() const
+    {
+        return (int64)FMath::Max(TTSMemoryCacheSizeMB, 0) * 1024 * 1024;
+    }
+
     // Processes the payload template by replacing tags with actual values
     UFUNCTION(BlueprintCallable, Category = "Conversational AI")
     FString ProcessPayloadTemplate(const FString& SystemPrompt, const FString& UserMessage, const FString& Model, int32 InMaxTokens) const;
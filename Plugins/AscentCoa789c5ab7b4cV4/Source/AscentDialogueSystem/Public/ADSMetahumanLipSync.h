@@ -83,6 +83,8 @@ struct FADSAnimationSequence
     }
 };
 
+class FADSVisemeStream;
+
 /**
  * Advanced Metahuman Lip Sync Component with Precise Timing Synchronization
  * 
@@ -92,12 +94,13 @@ struct FADSAnimationSequence
  * and maintains perfect synchronization with audio playback.
  * 
  * Main Usage:
- * 1. Call GenerateAndBroadcastVisemesFromAudio() with your audio data
- * 2. Subscribe to OnVisemeValuesChanged in your Animation Blueprint
+ * 1. Call GenerateAndBroadcastVisemesFromAudio() with your audio data, or stream it with
+ *    BeginVisemeStream() / AppendVisemeStreamAudio() / FinishVisemeStream() as it arrives
+ * 2. Call EvaluateVisemeValues() from your Animation Blueprint update, or subscribe to OnVisemeValuesChanged
  * 3. Use the viseme values to drive facial bone transforms or blend shapes
  * 
- * The system uses tick-based timing updates for precise synchronization and smooth interpolation,
- * making it ideal for professional character animation and Metahuman integration.
+ * Audio analysis runs on a background thread, so long lines never stall the game thread, and
+ * playback is evaluated from the elapsed time whenever it is sampled.
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class ASCENTDIALOGUESYSTEM_API UADSMetahumanLipSync : public UActorComponent
@@ -112,6 +115,7 @@ protected:
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
     
     // === MAIN WORKFLOW FUNCTION ===
     
@@ -121,6 +125,21 @@ public:
      */
     UFUNCTION(BlueprintCallable, Category = "ADS Metahuman LipSync")
     bool GenerateAndBroadcastVisemesFromAudio(const TArray<uint8>& AudioData, int32 SampleRate = 16000, int32 NumChannels = 1, float FrameDuration = 0.016f);
+
+    /** 
+     * Start playing visemes for audio that will be provided in chunks, ie: while TTS audio is downloaded.
+     * Playback time starts now, chunks are analyzed in the background as soon as they are appended.
+     */
+    UFUNCTION(BlueprintCallable, Category = "ADS Metahuman LipSync")
+    void BeginVisemeStream(int32 SampleRate = 16000, int32 NumChannels = 1, float FrameDuration = 0.016f);
+
+    /** Append the next chunk of 16-bit PCM audio (the first one may contain a WAV header) to the current stream */
+    UFUNCTION(BlueprintCallable, Category = "ADS Metahuman LipSync")
+    bool AppendVisemeStreamAudio(const TArray<uint8>& AudioChunk);
+
+    /** Notify that the whole audio of the current stream has been appended */
+    UFUNCTION(BlueprintCallable, Category = "ADS Metahuman LipSync")
+    void FinishVisemeStream();
     
     /** Stop the viseme broadcast to Animation Blueprint */
     UFUNCTION(BlueprintCallable, Category = "ADS Metahuman LipSync")
@@ -131,6 +150,14 @@ public:
     void ForceRecalculateStartTime();
     
     // === ANIMATION BLUEPRINT INTERFACE ===
+
+    /**
+     * Evaluate the viseme values at the current playback time. Thread safe, meant to be called
+     * from the Animation Blueprint (thread safe) update so blend shapes follow the anim update rate.
+     * @return False if no sequence is playing.
+     */
+    UFUNCTION(BlueprintCallable, Category = "ADS Metahuman LipSync", meta = (BlueprintThreadSafe))
+    bool EvaluateVisemeValues(TArray<float>& OutVisemeValues) const;
     
     /** Get current viseme values as array of float (for Animation Blueprint) */
     UFUNCTION(BlueprintPure, Category = "ADS Metahuman LipSync")
@@ -154,42 +181,31 @@ public:
     UPROPERTY(BlueprintAssignable)
     FOnVisemeValuesChanged OnVisemeValuesChanged;
 
+    /**
+     * If true, the component ticks while playing to update the current values and broadcast OnVisemeValuesChanged.
+     * Disable it when the Animation Blueprint pulls the values with EvaluateVisemeValues.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ADS Metahuman LipSync")
+    bool bBroadcastVisemeEvents = true;
+
 private:
     
     // === TIMING AND SYNCHRONIZATION ===
     
     // Calculate starting time for precise timing synchronization
     void CalculateStartingTime();
-    
-    // Tick-based viseme playback for precise timing
-    void TickVisemePlayback();
-    
-    // Interpolate between two frames for smooth animation
-    TMap<FName, float> InterpolateFrames(const TMap<FName, float>& StartFrame, const TMap<FName, float>& EndFrame, float Alpha);
+
+    // Start playing the provided stream from now
+    void StartPlayback(const TSharedRef<FADSVisemeStream, ESPMode::ThreadSafe>& Stream);
     
     // Apply interpolated frame to current state
-    void ApplyInterpolatedFrame(const TMap<FName, float>& FrameData);
-    
-    // Calculate audio duration from raw data
-    float CalculateAudioDuration(const TArray<uint8>& AudioData, int32 SampleRate, int32 NumChannels);
+    void ApplyInterpolatedFrame(const float* VisemeWeights);
     
     // === PRIVATE IMPLEMENTATION ===
     
     // Send silent frame to reset animation
     void SendSilentFrame();
     
-    // Generate visemes from audio buffer
-    TArray<FVisemeFrame> GenerateVisemesFromAudio(const TArray<uint8>& AudioData, int32 SampleRate, int32 NumChannels, float FrameDuration);
-    
-    // Analyze a single audio frame for viseme generation
-    void AnalyzeAudioFrame(const int16* Samples, int32 StartSample, int32 EndSample, int32 NumChannels, int32 SampleRate, FString& OutVisemeName, float& OutIntensity);
-    
-    // Parse WAV header and return PCM data offset
-    int32 ParseWAVHeader(const TArray<uint8>& AudioData, int32& OutSampleRate, int32& OutNumChannels);
-    
-    // Static variables for audio frame analysis smoothing
-    static float LastFrameIntensity;
-    
     // === PRIVATE MEMBER VARIABLES ===
     
     // Viseme names array
@@ -197,17 +213,13 @@ private:
     
     // Timing and synchronization variables
     double StartTime;
-    float CurrentSequenceTimePassed;
     bool bIsPlaying;
     
-    // Animation sequence buffer for precise timing
-    FADSAnimationSequence MainSequenceBuffer;
+    // Stream currently played, analyzed on a background thread
+    TSharedPtr<FADSVisemeStream, ESPMode::ThreadSafe> ActiveStream;
     
     // Critical section for thread safety
-    FCriticalSection SequenceCriticalSection;
-    
-    // Timer for precise tick-based playback
-    FTimerHandle VisemePlaybackTimer;
+    mutable FCriticalSection SequenceCriticalSection;
     
     // Current viseme values for Animation Blueprint access
     UPROPERTY()
@@ -218,4 +230,6 @@ private:
     
     UPROPERTY()
     float CurrentActiveVisemeIntensity;
-};
\ No newline at end of file
+
+    int32 CurrentActiveVisemeIndex = 0;
+};
@@ -0,0 +1,146 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include <Subsystems/EngineSubsystem.h>
+
+#include "ADSTTSCacheSubsystem.generated.h"
+
+DECLARE_DELEGATE_TwoParams(FOnADSTTSCacheLoaded, bool /*bFound*/, const TArray<uint8>& /*AudioData*/);
+
+/**
+ * Content addressed cache of generated TTS audio.
+ *
+ * Lines are keyed by a hash of their text, voice and model and stored as files in the project Saved
+ * folder, with least recently used eviction once the size set in the dialogue settings is exceeded.
+ * The most recently used lines are also kept in memory so that barks play without touching the disk.
+ * Lines can be prefetched in the background before they are spoken.
+ */
+UCLASS()
+class ASCENTDIALOGUESYSTEM_API UADSTTSCacheSubsystem : public UEngineSubsystem {
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Indexes the lines cached in a directory and stores the new ones there. Initialize uses the project Saved folder.
+	 */
+	void InitializeCache(const FString& directory);
+
+	/**
+	 * Overrides the cache sizes set in the dialogue settings, evicting the least recently used lines if needed.
+	 * Negative sizes restore the ones of the settings.
+	 */
+	void SetMaxSizes(int64 maxDiskSize, int64 maxMemorySize);
+
+	/**
+	 * Returns the cache key of a line.
+	 */
+	static FString MakeCacheKey(const FString& text, const FString& voice, const FString& model);
+
+	/**
+	 * Creates the HTTP request generating a line, using the TTS templates of the dialogue settings.
+	 */
+	static TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CreateTTSRequest(const FString& text, const FString& voice, const FString& model, const FString& endpoint, const FString& apiKey);
+
+	bool IsCacheEnabled() const;
+
+	bool IsCached(const FString& key) const;
+
+	/**
+	 * Copies the audio of a line if it is in the memory cache.
+	 */
+	bool TryGetFromMemory(const FString& key, TArray<uint8>& outAudioData);
+
+	/**
+	 * Reads the audio of a line from the disk cache on a background thread. The callback is executed on the game thread.
+	 */
+	void LoadAsync(const FString& key, FOnADSTTSCacheLoaded onLoaded);
+
+	/**
+	 * Adds the audio of a line to the memory and disk caches. The file is written on a background thread.
+	 */
+	void Store(const FString& key, const TArray<uint8>& audioData);
+
+	/**
+	 * Generates a line in the background and stores it in the cache, if not already cached or being generated.
+	 */
+	void Prefetch(const FString& text, const FString& voice, const FString& model, const FString& endpoint, const FString& apiKey);
+
+	/**
+	 * If the line is being prefetched, the callback is executed on the game thread once it is done.
+	 * @return False if the line is not being prefetched.
+	 */
+	bool WaitForPrefetch(const FString& key, FOnADSTTSCacheLoaded onLoaded);
+
+	/**
+	 * Returns the number of lines queued or being generated by prefetches.
+	 */
+	int32 GetNumPendingPrefetches() const { return PrefetchWaiters.Num(); }
+
+	/**
+	 * Deletes every cached line from memory and disk.
+	 */
+	UFUNCTION(BlueprintCallable, Category = ADS)
+	void ClearTTSCache();
+
+	UFUNCTION(BlueprintPure, Category = ADS)
+	int64 GetDiskCacheSize() const { return DiskSize; }
+
+private:
+	struct FDiskEntry {
+		int64 Size = 0;
+		FDateTime LastAccess;
+		// orders the accesses of this session, the clock may not tell them apart
+		uint64 AccessOrder = 0;
+	};
+
+	struct FMemoryEntry {
+		TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> AudioData;
+		uint64 LastAccess = 0;
+	};
+
+	struct FPrefetchRequest {
+		FString Key;
+		FString Text;
+		FString Voice;
+		FString Model;
+		FString Endpoint;
+		FString ApiKey;
+	};
+
+	FString GetCacheFilePath(const FString& key) const;
+	int64 GetMaxDiskSize() const;
+	int64 GetMaxMemorySize() const;
+
+	void Touch(const FString& key);
+	void AddToMemory(const FString& key, const TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe>& audioData);
+	void EvictMemory();
+	void EvictDisk();
+
+	void StartNextPrefetch();
+	void CompletePrefetch(const FString& key, const TArray<uint8>& audioData, bool bSuccess);
+
+	FString CacheDirectory;
+
+	TMap<FString, FDiskEntry> DiskEntries;
+	int64 DiskSize = 0;
+
+	TMap<FString, FMemoryEntry> MemoryEntries;
+	int64 MemorySize = 0;
+	uint64 AccessCounter = 0;
+
+	int64 MaxDiskSizeOverride = -1;
+	int64 MaxMemorySizeOverride = -1;
+
+	TArray<FPrefetchRequest> PrefetchQueue;
+	TMap<FString, TArray<FOnADSTTSCacheLoaded>> PrefetchWaiters;
+	int32 NumActivePrefetches = 0;
+
+	// Prefetches never compete with the line being spoken for more than this amount of requests
+	static constexpr int32 MaxConcurrentPrefetches = 2;
+};
@@ -53,6 +53,7 @@ public class AscentDialogueSystemEditor : ModuleRules
                 "Slate",
                 "SlateCore",
                 "AscentDialogueSystem",
+                "AscentEditorExtensions",
                   "UnrealEd"
 				// ... add private dependencies that you statically link with here ...	
 			}
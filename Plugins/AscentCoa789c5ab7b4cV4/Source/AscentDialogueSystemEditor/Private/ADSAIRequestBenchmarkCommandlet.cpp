@@ -0,0 +1,105 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ADSAIRequestBenchmarkCommandlet.h"
+#include "ADSAIRequestBuilder.h"
+#include "ADSDialogueDeveloperSettings.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogADSAIRequestBenchmark, Log, All);
+
+namespace {
+const TCHAR* CharacterName = TEXT("Aldric");
+const TCHAR* Personality = TEXT("Gruff blacksmith");
+const TCHAR* Description = TEXT("The village blacksmith, distrustful of strangers but proud of his \"finest\" blades.");
+const TCHAR* Rules = TEXT("- Always stay in character\n- Keep responses concise and relevant\n- Never break the fourth wall");
+const TCHAR* Model = TEXT("gpt-3.5-turbo");
+const int32 MaxTokens = 150;
+
+FString MakeMessage(FRandomStream& random, int32 numWords)
+{
+    static const TCHAR* words[] = {
+        TEXT("the"), TEXT("sword"), TEXT("\"north\""), TEXT("gate,"), TEXT("tavern."), TEXT("it's"), TEXT("blade"),
+        TEXT("iron"), TEXT("path\\road"), TEXT("king"), TEXT("coin?"), TEXT("forge"), TEXT("night\n"), TEXT("\tand"), TEXT("wolves")
+    };
+
+    FString message;
+    for (int32 word = 0; word < numWords; word++) {
+        if (word > 0) {
+            message += TEXT(" ");
+        }
+        message += words[random.RandRange(0, UE_ARRAY_COUNT(words) - 1)];
+    }
+    return message;
+}
+}
+
+UADSAIRequestBenchmarkCommandlet::UADSAIRequestBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UADSAIRequestBenchmarkCommandlet::Main(const FString& Params)
+{
+    int32 numTurns = 500;
+    int32 maxHistory = 10;
+    int32 numWords = 40;
+    int32 seed = 1;
+    FParse::Value(*Params, TEXT("Turns="), numTurns);
+    FParse::Value(*Params, TEXT("History="), maxHistory);
+    FParse::Value(*Params, TEXT("Words="), numWords);
+    FParse::Value(*Params, TEXT("Seed="), seed);
+    numTurns = FMath::Max(numTurns, 1);
+    maxHistory = FMath::Max(maxHistory, 1);
+    numWords = FMath::Max(numWords, 1);
+
+    const FString payloadTemplate = GetDefault<UADSDialogueDeveloperSettings>()->GetAIPayloadTemplate();
+
+    // answers are generated up front, only the request building is timed
+    FRandomStream random(seed);
+    TArray<FString> playerMessages;
+    TArray<FString> answers;
+    for (int32 turn = 0; turn < numTurns; turn++) {
+        playerMessages.Add(MakeMessage(random, numWords));
+        answers.Add(MakeMessage(random, numWords * 2));
+    }
+
+    const int32 maxEntries = maxHistory * 2;
+    FADSConversationBuffer buffer;
+    const FString characterPrompt = FADSAIRequestBuilder::BuildCharacterPrompt(CharacterName, Personality, Description, Rules);
+    double buildTime = 0.0;
+    double maxTurnTime = 0.0;
+    int32 payloadChars = 0;
+    for (int32 turn = 0; turn < numTurns; turn++) {
+        const double turnStart = FPlatformTime::Seconds();
+        buffer.Append(TEXT("Player"), playerMessages[turn]);
+        buffer.RemoveOldest(buffer.Num() - maxEntries);
+
+        FADSAIRequestSnapshot snapshot;
+        snapshot.PayloadTemplate = payloadTemplate;
+        snapshot.Model = Model;
+        snapshot.MaxTokens = MaxTokens;
+        snapshot.CharacterPrompt = characterPrompt;
+        buffer.GatherLines(1, 0, snapshot.HistoryLines);
+        snapshot.Context = FADSAIRequestBuilder::Escape(FString::Printf(TEXT("Player said: '%s'"), *playerMessages[turn]));
+        snapshot.UserMessage = FADSAIRequestBuilder::Escape(playerMessages[turn]);
+        const FString payload = FADSAIRequestBuilder::BuildPayload(snapshot);
+        const double turnTime = FPlatformTime::Seconds() - turnStart;
+        buildTime += turnTime;
+        maxTurnTime = FMath::Max(maxTurnTime, turnTime);
+        payloadChars += payload.Len();
+
+        buffer.Append(CharacterName, answers[turn]);
+        buffer.RemoveOldest(buffer.Num() - maxEntries);
+    }
+
+    UE_LOG(LogADSAIRequestBenchmark, Display, TEXT("Turns %d | History %d exchanges | Average payload %d chars | History ~%d tokens"),
+        numTurns, maxHistory, payloadChars / numTurns, buffer.GetTotalTokens());
+    UE_LOG(LogADSAIRequestBenchmark, Display, TEXT("Request build: %.3f ms/turn | worst %.3f ms"),
+        buildTime * 1000.0 / numTurns, maxTurnTime * 1000.0);
+
+    return 0;
+}
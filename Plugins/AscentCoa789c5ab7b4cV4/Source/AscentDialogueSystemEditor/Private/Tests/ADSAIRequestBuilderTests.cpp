@@ -0,0 +1,139 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ADSAIRequestBuilder.h"
+#include "ADSDialogueDeveloperSettings.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Tests/ACFAutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace {
+const TCHAR* TestTemplate = TEXT("{\"model\": \"{MODEL}\", \"max_tokens\": {MAX_TOKENS}, \"temperature\": {TEMPERATURE}, \"system\": \"{SYSTEM_PROMPT}\", \"user\": \"{USER_MESSAGE}\"}");
+
+TSharedPtr<FJsonObject> ParsePayload(const FString& payload)
+{
+    TSharedPtr<FJsonObject> json;
+    TSharedRef<TJsonReader<>> reader = TJsonReaderFactory<>::Create(payload);
+    if (!FJsonSerializer::Deserialize(reader, json)) {
+        return nullptr;
+    }
+    return json;
+}
+
+FString ParseEscaped(const FString& escaped)
+{
+    const TSharedPtr<FJsonObject> json = ParsePayload(FString::Printf(TEXT("{\"value\": \"%s\"}"), *escaped));
+    return json ? json->GetStringField(TEXT("value")) : FString();
+}
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FADSAIRequestEscapeTest, "ACF.Dialogue.AIRequest.Escape")
+
+bool FADSAIRequestEscapeTest::RunTest(const FString& Parameters)
+{
+    const FString texts[] = {
+        TEXT("plain text"),
+        TEXT("his \"finest\" blades"),
+        TEXT("path\\road"),
+        TEXT("line\nbreak\r\n\tindented"),
+        FString::Printf(TEXT("bell %c and escape %c"), (TCHAR)0x07, (TCHAR)0x1b),
+        TEXT("{USER_MESSAGE} stays as written")
+    };
+
+    for (const FString& text : texts) {
+        TestEqual(FString::Printf(TEXT("Escaped text reads back: %s"), *text.ReplaceCharWithEscapedChar()), ParseEscaped(FADSAIRequestBuilder::Escape(text)), text);
+    }
+    return true;
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FADSAIRequestPayloadTest, "ACF.Dialogue.AIRequest.Payload")
+
+bool FADSAIRequestPayloadTest::RunTest(const FString& Parameters)
+{
+    FADSConversationBuffer buffer;
+    buffer.Append(TEXT("Player"), TEXT("Do you sell \"north\" blades?"));
+    buffer.Append(TEXT("Aldric"), TEXT("Only to those\nwho can pay."));
+    buffer.Append(TEXT("Player"), TEXT("What about {MODEL}?"));
+
+    FADSAIRequestSnapshot snapshot;
+    snapshot.PayloadTemplate = TestTemplate;
+    snapshot.Model = TEXT("test-model");
+    snapshot.MaxTokens = 150;
+    snapshot.CharacterPrompt = FADSAIRequestBuilder::BuildCharacterPrompt(TEXT("Aldric"), TEXT("Gruff"), FString(), TEXT("- Stay in character"));
+    buffer.GatherLines(1, 0, snapshot.HistoryLines);
+    snapshot.Context = FADSAIRequestBuilder::Escape(TEXT("At the forge"));
+    snapshot.UserMessage = FADSAIRequestBuilder::Escape(TEXT("What about {MODEL}?"));
+
+    const TSharedPtr<FJsonObject> json = ParsePayload(FADSAIRequestBuilder::BuildPayload(snapshot));
+    if (!TestNotNull("Payload is valid JSON", json.Get())) {
+        return false;
+    }
+
+    const FString expectedPrompt = TEXT("You are Aldric.\n")
+                                   TEXT("Personality: Gruff\n")
+                                   TEXT("Rules:\n- Stay in character\n")
+                                   TEXT("\nConversation context (recent exchanges):\n")
+                                   TEXT("Player: Do you sell \"north\" blades?\n")
+                                   TEXT("Aldric: Only to those\nwho can pay.\n")
+                                   TEXT("\n")
+                                   TEXT("Current context: At the forge\n")
+                                   TEXT("Respond naturally to the player's message, staying in character and considering the conversation history.");
+    TestEqual("Model is filled", json->GetStringField(TEXT("model")), FString(TEXT("test-model")));
+    TestEqual("Max tokens are filled", json->GetIntegerField(TEXT("max_tokens")), 150);
+    TestEqual("System prompt holds the character, the history and the context", json->GetStringField(TEXT("system")), expectedPrompt);
+    TestEqual("Tags written by the player are not replaced", json->GetStringField(TEXT("user")), FString(TEXT("What about {MODEL}?")));
+
+    snapshot.PayloadTemplate = GetDefault<UADSDialogueDeveloperSettings>()->GetAIPayloadTemplate();
+    TestNotNull("Default template builds valid JSON", ParsePayload(FADSAIRequestBuilder::BuildPayload(snapshot)).Get());
+    return true;
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FADSConversationBufferTest, "ACF.Dialogue.AIRequest.ConversationBuffer")
+
+bool FADSConversationBufferTest::RunTest(const FString& Parameters)
+{
+    FADSConversationBuffer buffer;
+    buffer.Append(TEXT("Player"), TEXT("aaaa"));
+    buffer.Append(TEXT("Aldric"), TEXT("bbbbbbbb"));
+    buffer.Append(TEXT("Player"), TEXT("cccc"));
+    TestEqual("Every turn is appended", buffer.Num(), 3);
+
+    const int32 lineTokens[] = {
+        FADSAIRequestBuilder::EstimateTokens(FCString::Strlen(TEXT("Player: aaaa\n"))),
+        FADSAIRequestBuilder::EstimateTokens(FCString::Strlen(TEXT("Aldric: bbbbbbbb\n"))),
+        FADSAIRequestBuilder::EstimateTokens(FCString::Strlen(TEXT("Player: cccc\n")))
+    };
+    TestEqual("Tokens are counted per turn", buffer.GetTotalTokens(), lineTokens[0] + lineTokens[1] + lineTokens[2]);
+
+    TArray<FADSPromptLine> lines;
+    buffer.GatherLines(0, 0, lines);
+    TestEqual("Every line is gathered without a budget", lines.Num(), 3);
+    if (lines.Num() == 3) {
+        TestEqual("Lines are formatted and escaped", *lines[1], FString(TEXT("Aldric: bbbbbbbb\\n")));
+    }
+
+    buffer.GatherLines(1, 0, lines);
+    TestEqual("Newest turns are skipped", lines.Num(), 2);
+
+    buffer.GatherLines(0, lineTokens[1] + lineTokens[2], lines);
+    TestEqual("Only the newest lines fit the budget", lines.Num(), 2);
+    if (lines.Num() == 2) {
+        TestEqual("Budget keeps the lines in order", *lines[0], FString(TEXT("Aldric: bbbbbbbb\\n")));
+    }
+
+    buffer.GatherLines(0, 1, lines);
+    TestEqual("No line fits a budget smaller than the newest line", lines.Num(), 0);
+
+    buffer.RemoveOldest(2);
+    TestEqual("Oldest turns are removed", buffer.Num(), 1);
+    TestEqual("Removed turns release their tokens", buffer.GetTotalTokens(), lineTokens[2]);
+
+    buffer.RemoveOldest(5);
+    TestEqual("Removing more turns than stored empties the buffer", buffer.Num(), 0);
+    TestEqual("Empty buffer has no tokens", buffer.GetTotalTokens(), 0);
+    return true;
+}
+
+#endif
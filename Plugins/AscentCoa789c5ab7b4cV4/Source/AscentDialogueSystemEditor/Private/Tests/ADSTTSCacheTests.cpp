@@ -0,0 +1,148 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ADSTTSCacheSubsystem.h"
+#include "HAL/FileManager.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "Tests/ACFAutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace {
+// a cache of its own in the transient test folder, so that the lines of the project are never touched
+struct FTTSCacheTestContext {
+    UADSTTSCacheSubsystem* Cache = nullptr;
+    FString Directory;
+
+    FTTSCacheTestContext(int64 maxDiskSize, int64 maxMemorySize)
+    {
+        Directory = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("ADSTTSCache"), FGuid::NewGuid().ToString());
+        Cache = NewObject<UADSTTSCacheSubsystem>();
+        Cache->AddToRoot();
+        Cache->InitializeCache(Directory);
+        Cache->SetMaxSizes(maxDiskSize, maxMemorySize);
+    }
+
+    ~FTTSCacheTestContext()
+    {
+        Cache->ClearTTSCache();
+        Cache->RemoveFromRoot();
+    }
+
+    void Store(const FString& key, int32 size)
+    {
+        TArray<uint8> audioData;
+        audioData.SetNumZeroed(size);
+        Cache->Store(key, audioData);
+    }
+
+    bool IsInMemory(const FString& key)
+    {
+        TArray<uint8> audioData;
+        return Cache->TryGetFromMemory(key, audioData);
+    }
+};
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FADSTTSCacheKeyTest, "ACF.Dialogue.TTSCache.Key")
+
+bool FADSTTSCacheKeyTest::RunTest(const FString& Parameters)
+{
+    // keys name the files cached by previous sessions, they must never change
+    TestEqual("Key is the hash of the text, voice and model", UADSTTSCacheSubsystem::MakeCacheKey(TEXT("Hello there"), TEXT("alloy"), TEXT("tts-1")),
+        FString(TEXT("7786C5B81280C7B39CFF0BB9E4E7566689804572")));
+    TestEqual("Same line gives the same key", UADSTTSCacheSubsystem::MakeCacheKey(TEXT("Hello there"), TEXT("alloy"), TEXT("tts-1")),
+        UADSTTSCacheSubsystem::MakeCacheKey(TEXT("Hello there"), TEXT("alloy"), TEXT("tts-1")));
+    TestNotEqual("Voice is part of the key", UADSTTSCacheSubsystem::MakeCacheKey(TEXT("Hello there"), TEXT("alloy"), TEXT("tts-1")),
+        UADSTTSCacheSubsystem::MakeCacheKey(TEXT("Hello there"), TEXT("echo"), TEXT("tts-1")));
+    TestNotEqual("Model is part of the key", UADSTTSCacheSubsystem::MakeCacheKey(TEXT("Hello there"), TEXT("alloy"), TEXT("tts-1")),
+        UADSTTSCacheSubsystem::MakeCacheKey(TEXT("Hello there"), TEXT("alloy"), TEXT("tts-1-hd")));
+    TestNotEqual("Fields are not concatenated", UADSTTSCacheSubsystem::MakeCacheKey(TEXT("Hello"), TEXT("alloy"), TEXT("tts-1")),
+        UADSTTSCacheSubsystem::MakeCacheKey(TEXT("Hell"), TEXT("oalloy"), TEXT("tts-1")));
+    return true;
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FADSTTSCacheMemoryEvictionTest, "ACF.Dialogue.TTSCache.MemoryEviction")
+
+bool FADSTTSCacheMemoryEvictionTest::RunTest(const FString& Parameters)
+{
+    FTTSCacheTestContext context(10000, 250);
+
+    context.Store(TEXT("first"), 100);
+    context.Store(TEXT("second"), 100);
+    TestTrue("Lines within the budget are kept in memory", context.IsInMemory(TEXT("first")) && context.IsInMemory(TEXT("second")));
+
+    // reading the first line makes the second one the least recently used
+    context.IsInMemory(TEXT("first"));
+    context.Store(TEXT("third"), 100);
+    TestFalse("Least recently used line is evicted", context.IsInMemory(TEXT("second")));
+    TestTrue("Recently used lines are kept", context.IsInMemory(TEXT("first")) && context.IsInMemory(TEXT("third")));
+    TestTrue("Evicted line is still cached on disk", context.Cache->IsCached(TEXT("second")));
+
+    context.Store(TEXT("large"), 300);
+    TestFalse("Line larger than the budget is not kept in memory", context.IsInMemory(TEXT("large")));
+    TestTrue("Line larger than the budget evicts nothing", context.IsInMemory(TEXT("first")) && context.IsInMemory(TEXT("third")));
+
+    context.Cache->SetMaxSizes(10000, 100);
+    TestEqual("Lowering the budget evicts down to it", int32(context.IsInMemory(TEXT("first"))) + int32(context.IsInMemory(TEXT("third"))), 1);
+    return true;
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FADSTTSCacheDiskEvictionTest, "ACF.Dialogue.TTSCache.DiskEviction")
+
+bool FADSTTSCacheDiskEvictionTest::RunTest(const FString& Parameters)
+{
+    // without a memory cache, every line is only on disk
+    FTTSCacheTestContext context(250, 0);
+
+    context.Store(TEXT("first"), 100);
+    context.Store(TEXT("second"), 100);
+    TestEqual("Disk size counts every line", context.Cache->GetDiskCacheSize(), int64(200));
+
+    // loading the first line makes the second one the least recently used
+    context.Cache->LoadAsync(TEXT("first"), FOnADSTTSCacheLoaded());
+    context.Store(TEXT("third"), 100);
+    TestFalse("Least recently used line is evicted", context.Cache->IsCached(TEXT("second")));
+    TestTrue("Recently used lines are kept", context.Cache->IsCached(TEXT("first")) && context.Cache->IsCached(TEXT("third")));
+    TestEqual("Evicted line releases its size", context.Cache->GetDiskCacheSize(), int64(200));
+
+    context.Store(TEXT("third"), 150);
+    TestEqual("Stored again, a line replaces its size", context.Cache->GetDiskCacheSize(), int64(250));
+
+    context.Cache->ClearTTSCache();
+    TestEqual("Cleared cache is empty", context.Cache->GetDiskCacheSize(), int64(0));
+    TestFalse("Cleared lines are not cached", context.Cache->IsCached(TEXT("first")));
+    return true;
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FADSTTSCachePrefetchTest, "ACF.Dialogue.TTSCache.Prefetch")
+
+bool FADSTTSCachePrefetchTest::RunTest(const FString& Parameters)
+{
+    FTTSCacheTestContext context(10000, 10000);
+    UADSTTSCacheSubsystem* cache = context.Cache;
+
+    // nothing listens on the endpoint, the checks are done before any request completes
+    const FString endpoint = TEXT("http://127.0.0.1:1/tts");
+    cache->Prefetch(TEXT("First line"), TEXT("alloy"), TEXT("tts-1"), endpoint, TEXT("key"));
+    cache->Prefetch(TEXT("First line"), TEXT("alloy"), TEXT("tts-1"), endpoint, TEXT("key"));
+    TestEqual("Line prefetched twice is generated once", cache->GetNumPendingPrefetches(), 1);
+
+    cache->Prefetch(TEXT("First line"), TEXT("echo"), TEXT("tts-1"), endpoint, TEXT("key"));
+    cache->Prefetch(TEXT("Second line"), TEXT("alloy"), TEXT("tts-1"), endpoint, TEXT("key"));
+    cache->Prefetch(TEXT("Third line"), TEXT("alloy"), TEXT("tts-1"), endpoint, TEXT("key"));
+    TestEqual("Lines queued beyond the concurrent prefetches are pending", cache->GetNumPendingPrefetches(), 4);
+
+    cache->Prefetch(TEXT("Third line"), TEXT("alloy"), TEXT("tts-1"), endpoint, TEXT("key"));
+    TestEqual("Queued line is not queued again", cache->GetNumPendingPrefetches(), 4);
+    TestTrue("Speaking a prefetched line waits for it", cache->WaitForPrefetch(UADSTTSCacheSubsystem::MakeCacheKey(TEXT("Third line"), TEXT("alloy"), TEXT("tts-1")), FOnADSTTSCacheLoaded()));
+
+    context.Store(UADSTTSCacheSubsystem::MakeCacheKey(TEXT("Cached line"), TEXT("alloy"), TEXT("tts-1")), 100);
+    cache->Prefetch(TEXT("Cached line"), TEXT("alloy"), TEXT("tts-1"), endpoint, TEXT("key"));
+    cache->Prefetch(FString(), TEXT("alloy"), TEXT("tts-1"), endpoint, TEXT("key"));
+    TestEqual("Cached and empty lines are not prefetched", cache->GetNumPendingPrefetches(), 4);
+    TestFalse("Speaking a line not prefetched does not wait", cache->WaitForPrefetch(UADSTTSCacheSubsystem::MakeCacheKey(TEXT("Fourth line"), TEXT("alloy"), TEXT("tts-1")), FOnADSTTSCacheLoaded()));
+    return true;
+}
+
+#endif
@@ -0,0 +1,23 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "CoreMinimal.h"
+
+#include "ADSAIRequestBenchmarkCommandlet.generated.h"
+
+/**
+ * Benchmarks the per-turn build time of AI dialogue requests without network access, as a conversation
+ * grows up to the history limit.
+ * Usage: UnrealEditor-Cmd.exe Project.uproject -run=ADSAIRequestBenchmark -Turns=500 -History=10 -Words=40 -Seed=1
+ */
+UCLASS()
+class ASCENTDIALOGUESYSTEMEDITOR_API UADSAIRequestBenchmarkCommandlet : public UCommandlet {
+    GENERATED_BODY()
+
+public:
+    UADSAIRequestBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -45,7 +45,8 @@ public class AscentEditor : ModuleRules {
                 "AnimGraph",
                 "AnimGraphRuntime",
                 "BlueprintGraph", "Persona", "AnimationEditMode", "CharacterController",
-                "ActionsSystem","AscentGASRuntime", "EditorScriptingUtilities"
+                "ActionsSystem","AscentGASRuntime", "EditorScriptingUtilities",
+                "GameplayTags", "InventorySystem", "CraftingSystem", "AIFramework", "AscentCombatFramework", "AscentEditorExtensions"
                 // ... add private dependencies that you statically link with here ...
             });
 
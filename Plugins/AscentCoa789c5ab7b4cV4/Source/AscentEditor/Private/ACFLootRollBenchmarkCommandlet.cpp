@@ -0,0 +1,92 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ACFLootRollBenchmarkCommandlet.h"
+#include "ACFLootTable.h"
+#include "Engine/DataTable.h"
+#include "GameplayTagsManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogACFLootRollBenchmark, Log, All);
+
+UACFLootRollBenchmarkCommandlet::UACFLootRollBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UACFLootRollBenchmarkCommandlet::Main(const FString& Params)
+{
+    int32 numRows = 10000;
+    int32 numRules = 64;
+    int32 numRolls = 100000;
+    int32 seed = 1;
+    FParse::Value(*Params, TEXT("Rows="), numRows);
+    FParse::Value(*Params, TEXT("Rules="), numRules);
+    FParse::Value(*Params, TEXT("Rolls="), numRolls);
+    FParse::Value(*Params, TEXT("Seed="), seed);
+    numRows = FMath::Max(numRows, 1);
+    numRules = FMath::Max(numRules, 1);
+    numRolls = FMath::Max(numRolls, 1);
+
+    FRandomStream random(seed);
+
+    // rows use the project tags so that rules resolve tag hierarchies as they do in game
+    FGameplayTagContainer allTags;
+    UGameplayTagsManager::Get().RequestAllGameplayTags(allTags, true);
+    TArray<FGameplayTag> tags;
+    allTags.GetGameplayTagArray(tags);
+    if (tags.Num() == 0) {
+        UE_LOG(LogACFLootRollBenchmark, Warning, TEXT("No gameplay tags registered, every rule will match every row"));
+        tags.Add(FGameplayTag());
+    }
+
+    UDataTable* itemsDB = NewObject<UDataTable>(GetTransientPackage());
+    itemsDB->RowStruct = FItemGenerationSlot::StaticStruct();
+    for (int32 index = 0; index < numRows; index++) {
+        FItemGenerationSlot slot;
+        slot.Category = tags[random.RandRange(0, tags.Num() - 1)];
+        slot.Rarity = tags[random.RandRange(0, FMath::Min(tags.Num(), 8) - 1)];
+        slot.DropWeight = random.FRandRange(0.1f, 10.f);
+        itemsDB->AddRow(*FString::Printf(TEXT("Item_%d"), index), slot);
+    }
+
+    // each rule targets the parent category of an existing row, like a loot table asking for "any weapon"
+    TArray<FACFItemGenerationRule> rules;
+    rules.Reserve(numRules);
+    const TArray<FName> rowNames = itemsDB->GetRowNames();
+    for (int32 index = 0; index < numRules; index++) {
+        const FItemGenerationSlot* slot = itemsDB->FindRow<FItemGenerationSlot>(rowNames[random.RandRange(0, rowNames.Num() - 1)], TEXT(""));
+        FACFItemGenerationRule& rule = rules.AddDefaulted_GetRef();
+        const FGameplayTag parentCategory = slot->Category.RequestDirectParent();
+        rule.Category = parentCategory.IsValid() ? parentCategory : slot->Category;
+        rule.Rarity = slot->Rarity;
+    }
+
+    FACFLootTable lootTable;
+    const double buildStart = FPlatformTime::Seconds();
+    lootTable.Build(itemsDB);
+    for (const FACFItemGenerationRule& rule : rules) {
+        lootTable.FindOrAddRule(rule);
+    }
+    const double buildTime = FPlatformTime::Seconds() - buildStart;
+
+    // every roll resolves the picked row from the table, as item generation does
+    int32 picks = 0;
+    const double rollStart = FPlatformTime::Seconds();
+    for (int32 roll = 0; roll < numRolls; roll++) {
+        const FACFLootTable::FRuleEntries& entries = lootTable.FindOrAddRule(rules[roll % rules.Num()]);
+        if (lootTable.FindSlot(lootTable.PickSlot(entries, &random))) {
+            picks++;
+        }
+    }
+    const double rollTime = FPlatformTime::Seconds() - rollStart;
+
+    UE_LOG(LogACFLootRollBenchmark, Display, TEXT("Rows %d | Buckets %d | Rules %d | Rolls %d"), numRows, lootTable.NumBuckets(), rules.Num(), numRolls);
+    UE_LOG(LogACFLootRollBenchmark, Display, TEXT("Loot table: %.2f ms | %.0f rolls/s (%d picks) | build %.2f ms"),
+        rollTime * 1000.0, rollTime > 0.0 ? numRolls / rollTime : 0.0, picks, buildTime * 1000.0);
+
+    return 0;
+}
@@ -0,0 +1,89 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ACFThreatBenchmarkCommandlet.h"
+#include "Actors/ACFCharacter.h"
+#include "Components/ACFThreatManagerComponent.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogACFThreatBenchmark, Log, All);
+
+UACFThreatBenchmarkCommandlet::UACFThreatBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UACFThreatBenchmarkCommandlet::Main(const FString& Params)
+{
+    FString threatenersParam = TEXT("50,100,200");
+    int32 numHits = 100000;
+    int32 seed = 1;
+    FParse::Value(*Params, TEXT("Threateners="), threatenersParam);
+    FParse::Value(*Params, TEXT("Hits="), numHits);
+    FParse::Value(*Params, TEXT("Seed="), seed);
+    numHits = FMath::Max(numHits, 1);
+
+    TArray<FString> threatenerCounts;
+    threatenersParam.ParseIntoArray(threatenerCounts, TEXT(","));
+
+    UWorld* world = UWorld::CreateWorld(EWorldType::Game, false);
+    if (!world) {
+        UE_LOG(LogACFThreatBenchmark, Error, TEXT("Unable to create the benchmark world"));
+        return 1;
+    }
+
+    FActorSpawnParameters spawnParams;
+    spawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    AActor* owner = world->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, spawnParams);
+
+    for (const FString& countString : threatenerCounts) {
+        const int32 numThreateners = FMath::Max(FCString::Atoi(*countString), 1);
+        FRandomStream random(seed);
+
+        TArray<AActor*> threateners;
+        threateners.Reserve(numThreateners);
+        for (int32 index = 0; index < numThreateners; index++) {
+            threateners.Add(world->SpawnActor<AACFCharacter>(AACFCharacter::StaticClass(), FTransform::Identity, spawnParams));
+        }
+
+        TArray<int32> hitActors;
+        TArray<float> hitDamages;
+        hitActors.SetNumUninitialized(numHits);
+        hitDamages.SetNumUninitialized(numHits);
+        for (int32 hit = 0; hit < numHits; hit++) {
+            hitActors[hit] = random.RandRange(0, numThreateners - 1);
+            hitDamages[hit] = random.FRandRange(1.f, 50.f);
+        }
+
+        UACFThreatManagerComponent* threatComponent = NewObject<UACFThreatManagerComponent>(owner);
+        int32 targetChanges = 0;
+        AActor* target = nullptr;
+        const double heapStart = FPlatformTime::Seconds();
+        for (int32 hit = 0; hit < numHits; hit++) {
+            threatComponent->AddThreat(threateners[hitActors[hit]], hitDamages[hit]);
+            AActor* newTarget = threatComponent->GetActorWithHigherThreat();
+            if (newTarget != target) {
+                target = newTarget;
+                targetChanges++;
+            }
+        }
+        const double heapTime = FPlatformTime::Seconds() - heapStart;
+
+        UE_LOG(LogACFThreatBenchmark, Display, TEXT("Threateners %d | Hits %d"), numThreateners, numHits);
+        UE_LOG(LogACFThreatBenchmark, Display, TEXT("Threat heap: %.2f ms | %.0f hits/s (%d target changes)"),
+            heapTime * 1000.0, heapTime > 0.0 ? numHits / heapTime : 0.0, targetChanges);
+
+        threatComponent->RemoveAllThreatenings();
+        for (AActor* threatening : threateners) {
+            world->DestroyActor(threatening);
+        }
+    }
+
+    world->DestroyWorld(false);
+
+    return 0;
+}
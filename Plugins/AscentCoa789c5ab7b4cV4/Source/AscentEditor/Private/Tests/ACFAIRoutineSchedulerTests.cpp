@@ -0,0 +1,158 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2025. All Rights Reserved.
+
+#include "ACFAIRoutineSubsystem.h"
+#include "AIController.h"
+#include "Components/ACFAIRoutineComponent.h"
+#include "Data/ACFAIRoutineDataAsset.h"
+#include "GameFramework/Pawn.h"
+#include "Tests/ACFAutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace {
+constexpr int32 MinutesOf(int32 hour, int32 minute = 0)
+{
+    return hour * 60 + minute;
+}
+
+FAIRoutineTask MakeTask(int32 hour, int32 minute = 0)
+{
+    FAIRoutineTask task;
+    task.TaskTime = FRoutineTime::FromMinutes(MinutesOf(hour, minute));
+    return task;
+}
+
+// the clock is advanced by the tests, the world is never ticked
+struct FRoutineTestContext {
+    FACFTestWorld TestWorld;
+    UACFAIRoutineSubsystem* Scheduler = nullptr;
+
+    FRoutineTestContext()
+    {
+        Scheduler = TestWorld.World->GetSubsystem<UACFAIRoutineSubsystem>();
+    }
+
+    // routines start their tasks on the pawn of the controller owning them
+    UACFAIRoutineComponent* AddRoutine(const TArray<FAIRoutineTask>& tasks)
+    {
+        AAIController* controller = TestWorld.SpawnActor<AAIController>();
+        controller->SetPawn(TestWorld.SpawnActor<APawn>());
+        UACFAIRoutineComponent* routine = NewObject<UACFAIRoutineComponent>(controller);
+        routine->RoutineDataAsset = NewObject<UACFAIRoutineDataAsset>(routine);
+        routine->RoutineDataAsset->DailyTasks = tasks;
+        for (const FAIRoutineTask& task : tasks) {
+            routine->AddTask(task);
+        }
+        Scheduler->RegisterRoutine(routine);
+        return routine;
+    }
+
+    int32 AdvanceToMinute(int32 dayMinute)
+    {
+        Scheduler->AdvanceToMinute(dayMinute);
+        return Scheduler->GetWokenRoutinesLastFrame();
+    }
+};
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FACFRoutineSchedulerOrderTest, "ACF.AI.RoutineScheduler.Order")
+
+bool FACFRoutineSchedulerOrderTest::RunTest(const FString& Parameters)
+{
+    FRoutineTestContext context;
+    if (!TestNotNull("Game worlds have a routine scheduler", context.Scheduler)) {
+        return false;
+    }
+
+    const TArray<FAIRoutineTask> farmerTasks = { MakeTask(6), MakeTask(18) };
+    const TArray<FAIRoutineTask> smithTasks = { MakeTask(7, 30), MakeTask(20) };
+    const TArray<FAIRoutineTask> guardTasks = { MakeTask(7) };
+    UACFAIRoutineComponent* farmer = context.AddRoutine(farmerTasks);
+    UACFAIRoutineComponent* smith = context.AddRoutine(smithTasks);
+    UACFAIRoutineComponent* guard = context.AddRoutine(guardTasks);
+    TestEqual("Every routine is registered", context.Scheduler->GetNumRoutines(), 3);
+
+    TestEqual("First clock starts every routine", context.AdvanceToMinute(MinutesOf(5)), 3);
+    TestTrue("Routine before its first task runs the last task of the day before", farmer->GetCurrentTaskGuid() == farmerTasks[1].EntryGuid);
+    TestTrue("Routine with a single task always runs it", guard->GetCurrentTaskGuid() == guardTasks[0].EntryGuid);
+
+    TestEqual("Clock not crossing a boundary wakes nothing", context.AdvanceToMinute(MinutesOf(5, 30)), 0);
+    TestEqual("Earliest boundary wakes its routine only", context.AdvanceToMinute(MinutesOf(6)), 1);
+    TestTrue("Woken routine moves to its new task", farmer->GetCurrentTaskGuid() == farmerTasks[0].EntryGuid);
+    TestTrue("Routines not woken keep their task", smith->GetCurrentTaskGuid() == smithTasks[1].EntryGuid);
+
+    TestEqual("Clock before the next boundary wakes nothing", context.AdvanceToMinute(MinutesOf(6, 50)), 0);
+    TestEqual("Every boundary crossed by one update wakes its routine", context.AdvanceToMinute(MinutesOf(7, 40)), 2);
+    TestTrue("Routine woken with others moves to its new task", smith->GetCurrentTaskGuid() == smithTasks[0].EntryGuid);
+    TestEqual("Woken routines are queued on their next boundary", context.AdvanceToMinute(MinutesOf(8)), 0);
+
+    // the farmer's next boundary is still queued, it is skipped when it reaches the top
+    context.Scheduler->UnregisterRoutine(farmer);
+    TestEqual("Unregistered routine is not scheduled", context.Scheduler->GetNumRoutines(), 2);
+    for (int32 hour = 9; hour <= 18; hour++) {
+        context.AdvanceToMinute(MinutesOf(hour));
+    }
+    TestTrue("Unregistered routine is never woken", farmer->GetCurrentTaskGuid() == farmerTasks[0].EntryGuid);
+    return true;
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FACFRoutineSchedulerMidnightTest, "ACF.AI.RoutineScheduler.Midnight")
+
+bool FACFRoutineSchedulerMidnightTest::RunTest(const FString& Parameters)
+{
+    FRoutineTestContext context;
+    if (!TestNotNull("Game worlds have a routine scheduler", context.Scheduler)) {
+        return false;
+    }
+
+    const TArray<FAIRoutineTask> watchTasks = { MakeTask(23), MakeTask(1) };
+    UACFAIRoutineComponent* watch = context.AddRoutine(watchTasks);
+
+    context.AdvanceToMinute(MinutesOf(22, 30));
+    TestTrue("Routine starts on the task of the current time", watch->GetCurrentTaskGuid() == watchTasks[1].EntryGuid);
+    TestEqual("Last boundary of the day wakes the routine", context.AdvanceToMinute(MinutesOf(23)), 1);
+    TestTrue("Routine moves to the late task", watch->GetCurrentTaskGuid() == watchTasks[0].EntryGuid);
+
+    TestEqual("Clock before midnight wakes nothing", context.AdvanceToMinute(MinutesOf(23, 40)), 0);
+    TestEqual("Crossing midnight wakes nothing without a boundary", context.AdvanceToMinute(MinutesOf(0, 20)), 0);
+    TestEqual("Boundary after midnight wakes the routine", context.AdvanceToMinute(MinutesOf(1)), 1);
+    TestTrue("Routine moves to the task of the new day", watch->GetCurrentTaskGuid() == watchTasks[1].EntryGuid);
+    return true;
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FACFRoutineSchedulerTimeSkipTest, "ACF.AI.RoutineScheduler.TimeSkip")
+
+bool FACFRoutineSchedulerTimeSkipTest::RunTest(const FString& Parameters)
+{
+    FRoutineTestContext context;
+    if (!TestNotNull("Game worlds have a routine scheduler", context.Scheduler)) {
+        return false;
+    }
+
+    const TArray<FAIRoutineTask> innkeeperTasks = { MakeTask(6), MakeTask(12), MakeTask(18) };
+    UACFAIRoutineComponent* innkeeper = context.AddRoutine(innkeeperTasks);
+    UACFAIRoutineComponent* idle = context.AddRoutine({});
+
+    context.AdvanceToMinute(MinutesOf(6));
+    TestTrue("Routine starts on the task of the current time", innkeeper->GetCurrentTaskGuid() == innkeeperTasks[0].EntryGuid);
+
+    // sleeping skips the noon boundary, every routine jumps to the task of the new time
+    TestEqual("Time skip resyncs every routine", context.AdvanceToMinute(MinutesOf(13)), 2);
+    TestTrue("Routine jumps to the task of the new time", innkeeper->GetCurrentTaskGuid() == innkeeperTasks[1].EntryGuid);
+    TestFalse("Routine without tasks has no task", idle->GetCurrentTaskGuid().IsValid());
+
+    // a save loaded at an earlier time moves the clock backwards
+    context.AdvanceToMinute(MinutesOf(7));
+    TestTrue("Clock set backwards resyncs the routine", innkeeper->GetCurrentTaskGuid() == innkeeperTasks[0].EntryGuid);
+
+    int32 wokenBeforeNoon = 0;
+    for (int32 hour = 8; hour < 12; hour++) {
+        wokenBeforeNoon += context.AdvanceToMinute(MinutesOf(hour));
+    }
+    TestEqual("Resynced routine is not woken before its next boundary", wokenBeforeNoon, 0);
+    TestEqual("Resynced routine is woken on its next boundary", context.AdvanceToMinute(MinutesOf(12)), 1);
+    TestTrue("Routine moves to the task of its boundary", innkeeper->GetCurrentTaskGuid() == innkeeperTasks[1].EntryGuid);
+    return true;
+}
+
+#endif
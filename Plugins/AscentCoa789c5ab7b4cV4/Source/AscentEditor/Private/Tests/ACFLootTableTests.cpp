@@ -0,0 +1,150 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ACFLootTable.h"
+#include "Engine/DataTable.h"
+#include "Math/RandomStream.h"
+#include "NativeGameplayTags.h"
+#include "Tests/ACFAutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace {
+// rules match tag hierarchies, so the tests need a child tag and a tag outside of its hierarchy
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_ACFTest_Loot_Parent, "ACF.Test.Loot.Category");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_ACFTest_Loot_Child, "ACF.Test.Loot.Category.Child");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_ACFTest_Loot_Other, "ACF.Test.Loot.Other");
+
+UDataTable* CreateItemsDB()
+{
+    UDataTable* itemsDB = NewObject<UDataTable>(GetTransientPackage());
+    itemsDB->RowStruct = FItemGenerationSlot::StaticStruct();
+    return itemsDB;
+}
+
+void AddItemRow(UDataTable* itemsDB, const FName rowName, const FGameplayTag& category, const FGameplayTag& rarity, float dropWeight)
+{
+    FItemGenerationSlot slot;
+    slot.Category = category;
+    slot.Rarity = rarity;
+    slot.DropWeight = dropWeight;
+    itemsDB->AddRow(rowName, slot);
+}
+
+FACFItemGenerationRule MakeRule(const FGameplayTag& category, const FGameplayTag& rarity)
+{
+    FACFItemGenerationRule rule;
+    rule.Category = category;
+    rule.Rarity = rarity;
+    return rule;
+}
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FACFLootTableMatchingTest, "ACF.Crafting.LootTable.MatchingRows")
+
+bool FACFLootTableMatchingTest::RunTest(const FString& Parameters)
+{
+    const FGameplayTag parent = TAG_ACFTest_Loot_Parent;
+    const FGameplayTag child = TAG_ACFTest_Loot_Child;
+    const FGameplayTag other = TAG_ACFTest_Loot_Other;
+
+    UDataTable* itemsDB = CreateItemsDB();
+    AddItemRow(itemsDB, TEXT("Child"), child, other, 1.f);
+    AddItemRow(itemsDB, TEXT("Parent"), parent, other, 2.f);
+    AddItemRow(itemsDB, TEXT("Other"), other, other, 1.f);
+    AddItemRow(itemsDB, TEXT("NoWeight"), child, other, 0.f);
+    AddItemRow(itemsDB, TEXT("OtherRarity"), child, child, 1.f);
+
+    FACFLootTable lootTable;
+    lootTable.Build(itemsDB);
+    TestTrue("Table is built for the items DB", lootTable.IsBuiltFor(itemsDB));
+    TestEqual("Every row is indexed", lootTable.NumSlots(), 5);
+
+    const FACFLootTable::FRuleEntries& parentEntries = lootTable.FindOrAddRule(MakeRule(parent, other));
+    TestEqual("Parent category matches itself and its children with a weight", parentEntries.Num(), 2);
+    for (const int32 slotIndex : parentEntries.Slots) {
+        const FItemGenerationSlot* slot = lootTable.FindSlot(slotIndex);
+        TestTrue("Matching row resolves", slot != nullptr);
+        if (slot) {
+            TestTrue("Matching row matches the rule", FACFLootTable::DoesSlotMatchRule(MakeRule(parent, other), *slot));
+            TestTrue("Matching row has a weight", slot->DropWeight > 0.f);
+        }
+    }
+    const FItemGenerationSlot* mostLikelySlot = parentEntries.Num() > 0 ? lootTable.FindSlot(parentEntries.Slots[0]) : nullptr;
+    TestTrue("Entries are sorted by weight", mostLikelySlot && mostLikelySlot->DropWeight == 2.f);
+
+    TestEqual("Child category does not match its parent", lootTable.FindOrAddRule(MakeRule(child, other)).Num(), 1);
+    TestEqual("Rarity is matched", lootTable.FindOrAddRule(MakeRule(child, child)).Num(), 1);
+    return true;
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FACFLootTableWeightsTest, "ACF.Crafting.LootTable.Weights")
+
+bool FACFLootTableWeightsTest::RunTest(const FString& Parameters)
+{
+    const FGameplayTag child = TAG_ACFTest_Loot_Child;
+    const FGameplayTag other = TAG_ACFTest_Loot_Other;
+
+    UDataTable* itemsDB = CreateItemsDB();
+    AddItemRow(itemsDB, TEXT("Common"), child, other, 3.f);
+    AddItemRow(itemsDB, TEXT("Rare"), child, other, 1.f);
+    AddItemRow(itemsDB, TEXT("Never"), child, other, 0.f);
+
+    FACFLootTable lootTable;
+    lootTable.Build(itemsDB);
+    const FACFLootTable::FRuleEntries& entries = lootTable.FindOrAddRule(MakeRule(child, other));
+
+    constexpr int32 numRolls = 40000;
+    FRandomStream random(1);
+    TMap<FName, int32> picks;
+    for (int32 roll = 0; roll < numRolls; roll++) {
+        const FItemGenerationSlot* slot = lootTable.FindSlot(lootTable.PickSlot(entries, &random));
+        if (slot) {
+            picks.FindOrAdd(slot->DropWeight == 3.f ? TEXT("Common") : slot->DropWeight == 1.f ? TEXT("Rare") : TEXT("Never"))++;
+        }
+    }
+
+    TestEqual("Every roll picks a row", picks.FindRef(TEXT("Common")) + picks.FindRef(TEXT("Rare")), numRolls);
+    TestEqual("Rows without weight are never picked", picks.FindRef(TEXT("Never")), 0);
+    const float commonRatio = static_cast<float>(picks.FindRef(TEXT("Common"))) / numRolls;
+    TestTrue(FString::Printf(TEXT("Rows are picked by weight (%.3f of the rolls for 0.75 of the weight)"), commonRatio), FMath::IsNearlyEqual(commonRatio, 0.75f, 0.02f));
+    return true;
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FACFLootTableChangedTableTest, "ACF.Crafting.LootTable.ChangedTable")
+
+bool FACFLootTableChangedTableTest::RunTest(const FString& Parameters)
+{
+    const FGameplayTag child = TAG_ACFTest_Loot_Child;
+    const FGameplayTag other = TAG_ACFTest_Loot_Other;
+
+    UDataTable* itemsDB = CreateItemsDB();
+    AddItemRow(itemsDB, TEXT("Kept"), child, other, 1.f);
+    AddItemRow(itemsDB, TEXT("Removed"), child, other, 1.f);
+
+    FACFLootTable lootTable;
+    lootTable.Build(itemsDB);
+    const FACFLootTable::FRuleEntries& entries = lootTable.FindOrAddRule(MakeRule(child, other));
+    TestEqual("Both rows match", entries.Num(), 2);
+
+    // rows are resolved by name, a removed row is never read from freed memory
+    itemsDB->RemoveRow(TEXT("Removed"));
+    int32 resolvedRows = 0;
+    for (const int32 slotIndex : entries.Slots) {
+        if (lootTable.FindSlot(slotIndex)) {
+            resolvedRows++;
+        }
+    }
+    TestEqual("Only the kept row resolves", resolvedRows, 1);
+
+    // edits and reimports broadcast the change
+    AddItemRow(itemsDB, TEXT("Removed"), child, other, 1.f);
+    itemsDB->HandleDataTableChanged();
+    TestFalse("Changed table needs a rebuild", lootTable.IsBuiltFor(itemsDB));
+
+    lootTable.Build(itemsDB);
+    TestTrue("Rebuilt table is up to date", lootTable.IsBuiltFor(itemsDB));
+    TestEqual("Rebuilt table matches both rows", lootTable.FindOrAddRule(MakeRule(child, other)).Num(), 2);
+    return true;
+}
+
+#endif
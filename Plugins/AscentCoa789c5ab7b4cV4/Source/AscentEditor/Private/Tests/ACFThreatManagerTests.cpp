@@ -0,0 +1,116 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "Actors/ACFCharacter.h"
+#include "Components/ACFThreatManagerComponent.h"
+#include "Math/RandomStream.h"
+#include "Tests/ACFAutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace {
+struct FThreatTestContext {
+    FACFTestWorld TestWorld;
+    UACFThreatManagerComponent* ThreatComponent = nullptr;
+    TArray<AActor*> Threateners;
+
+    explicit FThreatTestContext(int32 numThreateners)
+    {
+        ThreatComponent = NewObject<UACFThreatManagerComponent>(TestWorld.SpawnActor());
+        for (int32 index = 0; index < numThreateners; index++) {
+            Threateners.Add(TestWorld.SpawnActor<AACFCharacter>());
+        }
+    }
+
+    // expected result, every tracked threat is tested
+    float GetMaxThreat() const
+    {
+        float maxThreat = -1.f;
+        for (const AActor* threatening : Threateners) {
+            maxThreat = FMath::Max(maxThreat, ThreatComponent->GetThreatForActor(threatening));
+        }
+        return maxThreat;
+    }
+};
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FACFThreatAccumulationTest, "ACF.AI.Threat.Accumulation")
+
+bool FACFThreatAccumulationTest::RunTest(const FString& Parameters)
+{
+    FThreatTestContext context(2);
+    AActor* first = context.Threateners[0];
+    AActor* second = context.Threateners[1];
+    UACFThreatManagerComponent* threatComponent = context.ThreatComponent;
+
+    threatComponent->AddThreat(first, 10.f);
+    TestEqual("First hit sets the threat", threatComponent->GetThreatForActor(first), 10.f);
+    TestTrue("Only threatening actor is the target", threatComponent->GetActorWithHigherThreat() == first);
+
+    threatComponent->AddThreat(second, 15.f);
+    TestTrue("Higher threat becomes the target", threatComponent->GetActorWithHigherThreat() == second);
+
+    threatComponent->SetThreatMultiplierForClass(AACFCharacter::StaticClass(), 2.f);
+    threatComponent->AddThreat(first, 5.f);
+    TestEqual("Accumulated threat is multiplied", threatComponent->GetThreatForActor(first), 25.f);
+    TestTrue("Accumulated threat takes the target back", threatComponent->GetActorWithHigherThreat() == first);
+
+    threatComponent->AddThreat(second, 0.f);
+    threatComponent->AddThreat(threatComponent->GetOwner(), 100.f);
+    TestEqual("Empty hits and the owner are ignored", threatComponent->GetNumThreatenings(), 2);
+
+    threatComponent->RemoveThreatening(first);
+    TestFalse("Removed actor is not threatening", threatComponent->IsThreatening(first));
+    TestTrue("Next highest threat becomes the target", threatComponent->GetActorWithHigherThreat() == second);
+
+    context.TestWorld.World->DestroyActor(second);
+    TestEqual("Destroyed actors are removed", threatComponent->GetNumThreatenings(), 0);
+    TestTrue("No target is left", threatComponent->GetActorWithHigherThreat() == nullptr);
+    return true;
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FACFThreatHeapTest, "ACF.AI.Threat.RandomHits")
+
+bool FACFThreatHeapTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 numThreateners = 64;
+    constexpr int32 numHits = 5000;
+
+    FThreatTestContext context(numThreateners);
+    UACFThreatManagerComponent* threatComponent = context.ThreatComponent;
+    threatComponent->SetThreatMultiplierForClass(AACFCharacter::StaticClass(), 0.9f);
+
+    FRandomStream random(1);
+    int32 wrongTargets = 0;
+    for (int32 hit = 0; hit < numHits; hit++) {
+        AActor* threatening = context.Threateners[random.RandRange(0, numThreateners - 1)];
+        const float damage = random.FRandRange(1.f, 50.f);
+        if (random.RandRange(0, 9) == 0) {
+            // damage healed back, or the actor left the fight
+            threatComponent->RemoveThreat(threatening, damage);
+        } else if (random.RandRange(0, 49) == 0) {
+            threatComponent->RemoveThreatening(threatening);
+        } else {
+            threatComponent->AddThreat(threatening, damage);
+        }
+
+        // ties may pick different actors, the threat of the picked one must be the highest
+        const AActor* target = threatComponent->GetActorWithHigherThreat();
+        if (threatComponent->GetThreatForActor(target) != context.GetMaxThreat()) {
+            wrongTargets++;
+        }
+    }
+
+    TestEqual("Target always has the highest threat", wrongTargets, 0);
+
+    int32 numThreatening = 0;
+    for (AActor* threatening : context.Threateners) {
+        numThreatening += threatComponent->IsThreatening(threatening) ? 1 : 0;
+    }
+    TestEqual("Every threatening actor is tracked once", threatComponent->GetNumThreatenings(), numThreatening);
+
+    threatComponent->RemoveAllThreatenings();
+    TestEqual("Every threatening actor is removed", threatComponent->GetNumThreatenings(), 0);
+    return true;
+}
+
+#endif
@@ -0,0 +1,22 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "CoreMinimal.h"
+
+#include "ACFLootRollBenchmarkCommandlet.generated.h"
+
+/**
+ * Benchmarks FACFLootTable loot rolls over a synthetic items DB.
+ * Usage: UnrealEditor-Cmd.exe Project.uproject -run=ACFLootRollBenchmark -Rows=10000 -Rules=64 -Rolls=100000 -Seed=1
+ */
+UCLASS()
+class ASCENTEDITOR_API UACFLootRollBenchmarkCommandlet : public UCommandlet {
+    GENERATED_BODY()
+
+public:
+    UACFLootRollBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
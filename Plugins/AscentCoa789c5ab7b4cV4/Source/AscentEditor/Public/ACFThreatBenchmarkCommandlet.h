@@ -0,0 +1,22 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "CoreMinimal.h"
+
+#include "ACFThreatBenchmarkCommandlet.generated.h"
+
+/**
+ * Benchmarks hit processing of UACFThreatManagerComponent with a growing number of threatening characters.
+ * Usage: UnrealEditor-Cmd.exe Project.uproject -run=ACFThreatBenchmark -Threateners=50,100,200 -Hits=100000 -Seed=1
+ */
+UCLASS()
+class ASCENTEDITOR_API UACFThreatBenchmarkCommandlet : public UCommandlet {
+    GENERATED_BODY()
+
+public:
+    UACFThreatBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,47 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/* ACF tests run in the editor and in clients, and are listed with the engine tests */
+#define ACF_AUTOMATION_TEST_FLAGS (EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+/* Declares an ACF test, named ACF.<System>.<Feature>.<Case> */
+#define IMPLEMENT_ACF_AUTOMATION_TEST(TClass, PrettyName) IMPLEMENT_SIMPLE_AUTOMATION_TEST(TClass, PrettyName, ACF_AUTOMATION_TEST_FLAGS)
+
+/**
+ * Game world owned by a single test, destroyed with every actor spawned in it when the test ends.
+ */
+struct FACFTestWorld {
+    UWorld* World = nullptr;
+
+    FACFTestWorld()
+    {
+        World = UWorld::CreateWorld(EWorldType::Game, false);
+    }
+
+    ~FACFTestWorld()
+    {
+        World->DestroyWorld(false);
+    }
+
+    FACFTestWorld(const FACFTestWorld&) = delete;
+    FACFTestWorld& operator=(const FACFTestWorld&) = delete;
+
+    /* Spawns at the origin, tests spawn every actor in the same place */
+    template <typename TActor = AActor>
+    TActor* SpawnActor(TSubclassOf<TActor> actorClass = TActor::StaticClass())
+    {
+        FActorSpawnParameters spawnParams;
+        spawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        return World->SpawnActor<TActor>(actorClass, FTransform::Identity, spawnParams);
+    }
+};
+
+#endif
@@ -41,6 +41,7 @@ public class AscentGASEditor : ModuleRules
     "ApplicationCore",
     "EditorSubsystem",
     "AscentGASRuntime",
+    "AscentEditorExtensions",
     "AssetRegistry",
     "Slate",           
     "SlateCore",      
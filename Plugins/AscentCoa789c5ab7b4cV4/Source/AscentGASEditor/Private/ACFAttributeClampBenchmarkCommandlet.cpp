@@ -0,0 +1,88 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ACFAttributeClampBenchmarkCommandlet.h"
+#include "ACFStatisticsSet.h"
+#include "AbilitySystemComponent.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogACFAttributeClampBenchmark, Log, All);
+
+UACFAttributeClampBenchmarkCommandlet::UACFAttributeClampBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UACFAttributeClampBenchmarkCommandlet::Main(const FString& Params)
+{
+    int32 numUpdates = 1000000;
+    int32 seed = 1;
+    FParse::Value(*Params, TEXT("Updates="), numUpdates);
+    FParse::Value(*Params, TEXT("Seed="), seed);
+    numUpdates = FMath::Max(numUpdates, 1);
+
+    UWorld* world = UWorld::CreateWorld(EWorldType::Game, false);
+    if (!world) {
+        UE_LOG(LogACFAttributeClampBenchmark, Error, TEXT("Unable to create the benchmark world"));
+        return 1;
+    }
+
+    AActor* owner = world->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity);
+    UAbilitySystemComponent* abilityComp = NewObject<UAbilitySystemComponent>(owner);
+    abilityComp->RegisterComponent();
+    abilityComp->InitAbilityActorInfo(owner, owner);
+
+    // clamp rules are set on the benchmarked set only, its class defaults are left untouched
+    UACFStatisticsSet* statistics = NewObject<UACFStatisticsSet>(owner);
+    const TArray<FAttributeClamps> clamps = {
+        FAttributeClamps(statistics->HealthAttribute(), statistics->MaxHealthAttribute(), true),
+        FAttributeClamps(statistics->StaminaAttribute(), statistics->MaxStaminaAttribute(), true),
+        FAttributeClamps(statistics->ManaAttribute(), statistics->MaxManaAttribute(), true),
+        FAttributeClamps(statistics->EquilibriumAttribute(), statistics->MaxEquilibriumAttribute(), false)
+    };
+    statistics->SetClamps(clamps);
+
+    statistics->InitMaxHealth(500.f);
+    statistics->InitMaxStamina(200.f);
+    statistics->InitMaxMana(150.f);
+    statistics->InitMaxEquilibrium(100.f);
+    abilityComp->AddSpawnedAttribute(statistics);
+
+    // regens are not clamped and exercise the miss path
+    const TArray<FGameplayAttribute> attributes = {
+        statistics->HealthAttribute(),
+        statistics->StaminaAttribute(),
+        statistics->ManaAttribute(),
+        statistics->EquilibriumAttribute(),
+        statistics->HealthRegenAttribute(),
+        statistics->StaminaRegenAttribute()
+    };
+
+    FRandomStream random(seed);
+    TArray<uint8> updateAttributes;
+    TArray<float> updateValues;
+    updateAttributes.SetNumUninitialized(numUpdates);
+    updateValues.SetNumUninitialized(numUpdates);
+    for (int32 update = 0; update < numUpdates; update++) {
+        updateAttributes[update] = static_cast<uint8>(random.RandRange(0, attributes.Num() - 1));
+        updateValues[update] = random.FRandRange(-200.f, 800.f);
+    }
+
+    // full attribute updates through the ability system, base and current value clamps included
+    const double updateStart = FPlatformTime::Seconds();
+    for (int32 update = 0; update < numUpdates; update++) {
+        abilityComp->SetNumericAttributeBase(attributes[updateAttributes[update]], updateValues[update]);
+    }
+    const double updateTime = FPlatformTime::Seconds() - updateStart;
+
+    UE_LOG(LogACFAttributeClampBenchmark, Display, TEXT("Updates %d | Clamp rules %d"), numUpdates, clamps.Num());
+    UE_LOG(LogACFAttributeClampBenchmark, Display, TEXT("Ability system updates: %.2f ms | %.0f updates/s"),
+        updateTime * 1000.0, updateTime > 0.0 ? numUpdates / updateTime : 0.0);
+
+    world->DestroyWorld(false);
+    return 0;
+}
@@ -0,0 +1,152 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ACFAttributeSet.h"
+#include "ACFStatisticsSet.h"
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "GameplayEffectExtension.h"
+#include "Tests/ACFAutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace {
+struct FClampTestContext {
+    FACFTestWorld TestWorld;
+    UAbilitySystemComponent* AbilityComp = nullptr;
+    UACFStatisticsSet* Statistics = nullptr;
+
+    explicit FClampTestContext(const TArray<FAttributeClamps>& clamps)
+    {
+        AActor* owner = TestWorld.SpawnActor();
+        AbilityComp = NewObject<UAbilitySystemComponent>(owner);
+        AbilityComp->RegisterComponent();
+        AbilityComp->InitAbilityActorInfo(owner, owner);
+
+        Statistics = NewObject<UACFStatisticsSet>(owner);
+        Statistics->SetClamps(clamps);
+        Statistics->InitMaxHealth(500.f);
+        Statistics->InitMaxStamina(200.f);
+        Statistics->InitMaxEquilibrium(100.f);
+        AbilityComp->AddSpawnedAttribute(Statistics);
+    }
+
+    float SetBase(const FGameplayAttribute& attribute, float value)
+    {
+        AbilityComp->SetNumericAttributeBase(attribute, value);
+        return AbilityComp->GetNumericAttributeBase(attribute);
+    }
+
+    // applies an instant effect adding the magnitude to the attribute, and returns its current value
+    float ApplyEffect(const FGameplayAttribute& attribute, float magnitude)
+    {
+        UGameplayEffect* effect = NewObject<UGameplayEffect>(GetTransientPackage());
+        effect->DurationPolicy = EGameplayEffectDurationType::Instant;
+        FGameplayModifierInfo& modifier = effect->Modifiers.AddDefaulted_GetRef();
+        modifier.Attribute = attribute;
+        modifier.ModifierOp = EGameplayModOp::Additive;
+        modifier.ModifierMagnitude = FScalableFloat(magnitude);
+        AbilityComp->ApplyGameplayEffectToSelf(effect, 1.f, AbilityComp->MakeEffectContext());
+        return AbilityComp->GetNumericAttribute(attribute);
+    }
+};
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FACFAttributeClampBoundsTest, "ACF.GAS.AttributeClamp.Bounds")
+
+bool FACFAttributeClampBoundsTest::RunTest(const FString& Parameters)
+{
+    const UACFStatisticsSet* defaults = GetDefault<UACFStatisticsSet>();
+    FClampTestContext context({
+        FAttributeClamps(defaults->HealthAttribute(), defaults->MaxHealthAttribute(), true),
+        FAttributeClamps(defaults->EquilibriumAttribute(), defaults->MaxEquilibriumAttribute(), false)
+    });
+
+    TestEqual("Value above the max is clamped to the max", context.SetBase(defaults->HealthAttribute(), 800.f), 500.f);
+    TestEqual("Value below zero is clamped to zero", context.SetBase(defaults->HealthAttribute(), -50.f), 0.f);
+    TestEqual("Value in range is kept", context.SetBase(defaults->HealthAttribute(), 320.f), 320.f);
+    TestEqual("Value below zero is kept without bClampToZero", context.SetBase(defaults->EquilibriumAttribute(), -50.f), -50.f);
+    TestEqual("Value above the max is clamped without bClampToZero", context.SetBase(defaults->EquilibriumAttribute(), 150.f), 100.f);
+    TestEqual("Attribute without rules is not clamped", context.SetBase(defaults->HealthRegenAttribute(), 800.f), 800.f);
+
+    context.SetBase(defaults->MaxHealthAttribute(), 250.f);
+    TestEqual("Changed max is used by the next clamp", context.SetBase(defaults->HealthAttribute(), 800.f), 250.f);
+    return true;
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FACFAttributeClampFirstRuleTest, "ACF.GAS.AttributeClamp.FirstRuleWins")
+
+bool FACFAttributeClampFirstRuleTest::RunTest(const FString& Parameters)
+{
+    const UACFStatisticsSet* defaults = GetDefault<UACFStatisticsSet>();
+    FClampTestContext context({
+        FAttributeClamps(defaults->HealthAttribute(), defaults->MaxStaminaAttribute(), true),
+        FAttributeClamps(defaults->HealthAttribute(), defaults->MaxHealthAttribute(), true),
+        FAttributeClamps(defaults->StaminaAttribute(), defaults->MaxStaminaAttribute(), true)
+    });
+
+    TestEqual("First rule of an attribute is applied", context.SetBase(defaults->HealthAttribute(), 800.f), 200.f);
+    TestEqual("Following rules are applied", context.SetBase(defaults->StaminaAttribute(), 800.f), 200.f);
+    return true;
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FACFAttributeClampEditedRulesTest, "ACF.GAS.AttributeClamp.EditedRules")
+
+bool FACFAttributeClampEditedRulesTest::RunTest(const FString& Parameters)
+{
+    const UACFStatisticsSet* defaults = GetDefault<UACFStatisticsSet>();
+    FClampTestContext context({ FAttributeClamps(defaults->HealthAttribute(), defaults->MaxHealthAttribute(), true) });
+
+    TestEqual("Initial rule is applied", context.SetBase(defaults->HealthAttribute(), 800.f), 500.f);
+
+    context.Statistics->SetClamps({ FAttributeClamps(defaults->HealthAttribute(), defaults->MaxStaminaAttribute(), true) });
+    TestEqual("Edited rule is applied", context.SetBase(defaults->HealthAttribute(), 800.f), 200.f);
+
+    context.Statistics->SetClamps({});
+    TestEqual("Removed rule is not applied", context.SetBase(defaults->HealthAttribute(), 800.f), 800.f);
+    return true;
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FACFAttributeClampGameplayEffectTest, "ACF.GAS.AttributeClamp.GameplayEffect")
+
+bool FACFAttributeClampGameplayEffectTest::RunTest(const FString& Parameters)
+{
+    const UACFStatisticsSet* defaults = GetDefault<UACFStatisticsSet>();
+    FClampTestContext context({ FAttributeClamps(defaults->HealthAttribute(), defaults->MaxHealthAttribute(), true) });
+    context.SetBase(defaults->HealthAttribute(), 100.f);
+
+    TestEqual("Effect above the max is clamped to the max", context.ApplyEffect(defaults->HealthAttribute(), 1000.f), 500.f);
+    TestEqual("Base value is clamped to the same max", context.AbilityComp->GetNumericAttributeBase(defaults->HealthAttribute()), 500.f);
+    TestEqual("Effect below zero is clamped to zero", context.ApplyEffect(defaults->HealthAttribute(), -1000.f), 0.f);
+
+    TestEqual("Effect changes the max", context.ApplyEffect(defaults->MaxHealthAttribute(), -250.f), 250.f);
+    TestEqual("Max changed by an effect is used by the next one", context.ApplyEffect(defaults->HealthAttribute(), 1000.f), 250.f);
+    return true;
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FACFAttributeClampVetoedEffectTest, "ACF.GAS.AttributeClamp.VetoedEffect")
+
+bool FACFAttributeClampVetoedEffectTest::RunTest(const FString& Parameters)
+{
+    const UACFStatisticsSet* defaults = GetDefault<UACFStatisticsSet>();
+    const UACFAttributeSet* attributeDefaults = GetDefault<UACFAttributeSet>();
+
+    // a max from another set is read through the ability system, nothing in this set tells when it changes
+    FClampTestContext context({ FAttributeClamps(defaults->HealthAttribute(), attributeDefaults->MeleeDamageAttribute(), true) });
+    UACFAttributeSet* attributes = NewObject<UACFAttributeSet>(context.AbilityComp->GetOwner());
+    attributes->InitMeleeDamage(300.f);
+    context.AbilityComp->AddSpawnedAttribute(attributes);
+
+    // a subclass returning false from its Pre after calling Super vetoes the effect, Post is never called
+    FGameplayEffectSpec spec;
+    FGameplayModifierEvaluatedData evaluatedData(defaults->HealthAttribute(), EGameplayModOp::Additive, 1000.f);
+    FGameplayEffectModCallbackData callbackData(spec, evaluatedData, *context.AbilityComp);
+    context.Statistics->PreGameplayEffectExecute(callbackData);
+
+    TestEqual("Max of another set is applied", context.SetBase(defaults->HealthAttribute(), 800.f), 300.f);
+    context.SetBase(attributeDefaults->MeleeDamageAttribute(), 100.f);
+    TestEqual("Max changed after a vetoed effect is used", context.SetBase(defaults->HealthAttribute(), 800.f), 100.f);
+    TestEqual("Effect applied after a vetoed one is clamped", context.ApplyEffect(defaults->HealthAttribute(), 1000.f), 100.f);
+    return true;
+}
+
+#endif
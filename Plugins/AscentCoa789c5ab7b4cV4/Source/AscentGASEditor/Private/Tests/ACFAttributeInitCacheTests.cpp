@@ -0,0 +1,100 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ACFAttributeInitCache.h"
+#include "ACFGASTypes.h"
+#include "ACFStatisticsSet.h"
+#include "Engine/CurveTable.h"
+#include "Engine/DataTable.h"
+#include "Tests/ACFAutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace {
+UDataTable* MakeTable(UScriptStruct* rowStruct)
+{
+    UDataTable* table = NewObject<UDataTable>(GetTransientPackage());
+    table->RowStruct = rowStruct;
+    return table;
+}
+
+FACFAttributeInits MakeInits(const FGameplayAttribute& attribute, float value)
+{
+    FACFAttributeInits inits;
+    inits.PawnAttributesInit.Add(FAttributeInit(attribute, value));
+    return inits;
+}
+
+FAttributeSerializeKeys MakeCurveRow(const FGameplayAttribute& attribute)
+{
+    FAttributeSerializeKeys curveRow;
+    curveRow.Attribute = attribute;
+    return curveRow;
+}
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FACFAttributeInitCacheTableChangedTest, "ACF.GAS.AttributeInitCache.TableChanged")
+
+bool FACFAttributeInitCacheTableChangedTest::RunTest(const FString& Parameters)
+{
+    const UACFStatisticsSet* defaults = GetDefault<UACFStatisticsSet>();
+    FACFAttributeInitCache& cache = FACFAttributeInitCache::Get();
+
+    UDataTable* startingTable = MakeTable(FACFAttributeInits::StaticStruct());
+    startingTable->AddRow(TEXT("Wolf"), MakeInits(defaults->HealthAttribute(), 100.f));
+
+    const TSharedRef<const TArray<FACFResolvedAttributeInit>> initial = cache.FindOrAddFromTable(startingTable, TEXT("Wolf"), ELevelingType::ECantLevelUp);
+    if (!TestEqual("Row attributes are resolved", initial->Num(), 1)) {
+        return false;
+    }
+    TestEqual("Row value is resolved", (*initial)[0].Value, 100.f);
+    TestTrue("Same row is served from the cache", &*cache.FindOrAddFromTable(startingTable, TEXT("Wolf"), ELevelingType::ECantLevelUp) == &*initial);
+    TestTrue("Leveling type is part of the key", &*cache.FindOrAddFromTable(startingTable, TEXT("Wolf"), ELevelingType::EGenerateNewStatsFromCurves) != &*initial);
+
+    // editing a row notifies the table, as the data table editor and reimports do
+    startingTable->FindRow<FACFAttributeInits>(TEXT("Wolf"), FString())->PawnAttributesInit[0].InitValue = 250.f;
+    startingTable->HandleDataTableChanged(TEXT("Wolf"));
+
+    const TSharedRef<const TArray<FACFResolvedAttributeInit>> changed = cache.FindOrAddFromTable(startingTable, TEXT("Wolf"), ELevelingType::ECantLevelUp);
+    if (TestEqual("Changed row attributes are resolved", changed->Num(), 1)) {
+        TestEqual("Changed table is resolved again", (*changed)[0].Value, 250.f);
+    }
+    TestEqual("Values held while applying outlive the invalidation", (*initial)[0].Value, 100.f);
+
+    startingTable->RemoveRow(TEXT("Wolf"));
+    startingTable->HandleDataTableChanged(TEXT("Wolf"));
+    TestEqual("Removed row resolves no attribute", cache.FindOrAddFromTable(startingTable, TEXT("Wolf"), ELevelingType::ECantLevelUp)->Num(), 0);
+    return true;
+}
+
+IMPLEMENT_ACF_AUTOMATION_TEST(FACFAttributeInitCacheCurvesTest, "ACF.GAS.AttributeInitCache.Curves")
+
+bool FACFAttributeInitCacheCurvesTest::RunTest(const FString& Parameters)
+{
+    const UACFStatisticsSet* defaults = GetDefault<UACFStatisticsSet>();
+    FACFAttributeInitCache& cache = FACFAttributeInitCache::Get();
+
+    UCurveTable* attributesByLevel = NewObject<UCurveTable>(GetTransientPackage());
+    FRichCurve& healthCurve = attributesByLevel->AddRichCurve(TEXT("Health"));
+    healthCurve.AddKey(1.f, 100.f);
+    healthCurve.AddKey(10.f, 1000.f);
+
+    // two configurations mapping the same curve row to different attributes
+    UDataTable* healthRows = MakeTable(FAttributeSerializeKeys::StaticStruct());
+    healthRows->AddRow(TEXT("Health"), MakeCurveRow(defaults->HealthAttribute()));
+    UDataTable* maxHealthRows = MakeTable(FAttributeSerializeKeys::StaticStruct());
+    maxHealthRows->AddRow(TEXT("Health"), MakeCurveRow(defaults->MaxHealthAttribute()));
+
+    const TSharedRef<const TArray<FACFResolvedAttributeInit>> health = cache.FindOrAddFromCurves(attributesByLevel, healthRows, 10);
+    const TSharedRef<const TArray<FACFResolvedAttributeInit>> maxHealth = cache.FindOrAddFromCurves(attributesByLevel, maxHealthRows, 10);
+    if (!TestEqual("Curve rows are resolved", health->Num(), 1) || !TestEqual("Curve rows of the other configuration are resolved", maxHealth->Num(), 1)) {
+        return false;
+    }
+
+    TestEqual("Curve is evaluated at the level", (*health)[0].Value, 1000.f);
+    TestTrue("Row table maps the curve to its attribute", (*health)[0].Attribute == defaults->HealthAttribute());
+    TestTrue("Row table is part of the key", (*maxHealth)[0].Attribute == defaults->MaxHealthAttribute());
+    TestEqual("Level is part of the key", (*cache.FindOrAddFromCurves(attributesByLevel, healthRows, 1))[0].Value, 100.f);
+    return true;
+}
+
+#endif
@@ -0,0 +1,22 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "CoreMinimal.h"
+
+#include "ACFAttributeClampBenchmarkCommandlet.generated.h"
+
+/**
+ * Benchmarks clamped attribute updates of UACFBaseAttributeSet through the ability system component.
+ * Usage: UnrealEditor-Cmd.exe Project.uproject -run=ACFAttributeClampBenchmark -Updates=1000000 -Seed=1
+ */
+UCLASS()
+class ASCENTGASEDITOR_API UACFAttributeClampBenchmarkCommandlet : public UCommandlet {
+    GENERATED_BODY()
+
+public:
+    UACFAttributeClampBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,101 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ACFAttributeInitCache.h"
+#include "AbilitySystemComponent.h"
+#include "Engine/CurveTable.h"
+#include "Engine/DataTable.h"
+#include "Logging.h"
+
+FACFAttributeInitCache& FACFAttributeInitCache::Get()
+{
+    static FACFAttributeInitCache cache;
+    return cache;
+}
+
+TSharedRef<const TArray<FACFResolvedAttributeInit>> FACFAttributeInitCache::FindOrAddFromTable(const UDataTable* startingTable, FName characterRow, ELevelingType levelingType)
+{
+    const FKey key { startingTable, nullptr, characterRow, 0, levelingType };
+    if (const TSharedRef<const TArray<FACFResolvedAttributeInit>>* cached = Entries.Find(key)) {
+        return *cached;
+    }
+
+    TArray<FACFResolvedAttributeInit> resolved;
+    const FACFAttributeInits* attInits = startingTable ? startingTable->FindRow<FACFAttributeInits>(characterRow, "") : nullptr;
+    if (attInits) {
+        resolved.Reserve(attInits->PawnAttributesInit.Num());
+        for (const FAttributeInit& attribute : attInits->PawnAttributesInit) {
+            resolved.Add({ attribute.Attribute, attribute.InitValue });
+        }
+    }
+
+    WatchTable(startingTable);
+    return Entries.Add(key, MakeShared<TArray<FACFResolvedAttributeInit>>(MoveTemp(resolved)));
+}
+
+TSharedRef<const TArray<FACFResolvedAttributeInit>> FACFAttributeInitCache::FindOrAddFromCurves(const UCurveTable* attributesByLevel, const UDataTable* attributesByCurveRow, int32 level)
+{
+    const FKey key { attributesByLevel, attributesByCurveRow, NAME_None, level, ELevelingType::EGenerateNewStatsFromCurves };
+    if (const TSharedRef<const TArray<FACFResolvedAttributeInit>>* cached = Entries.Find(key)) {
+        return *cached;
+    }
+
+    TArray<FACFResolvedAttributeInit> resolved;
+    if (attributesByLevel && attributesByCurveRow) {
+        resolved.Reserve(attributesByCurveRow->GetRowMap().Num());
+        for (const TPair<FName, uint8*>& Elem : attributesByCurveRow->GetRowMap()) {
+            const FAttributeSerializeKeys* AttributeKey = attributesByCurveRow->FindRow<FAttributeSerializeKeys>(Elem.Key, TEXT("InitAttributes"));
+            if (!AttributeKey) {
+                continue;
+            }
+
+            const FRealCurve* Curve = attributesByLevel->FindCurve(Elem.Key, FString());
+            if (Curve) {
+                resolved.Add({ AttributeKey->Attribute, Curve->Eval(static_cast<float>(level)) });
+            } else {
+                UE_LOG(LogAscentGASRuntime, Warning, TEXT("Missing curve row for attribute: %s"), *Elem.Key.ToString());
+            }
+        }
+    }
+
+    WatchCurveTable(attributesByLevel);
+    WatchTable(attributesByCurveRow);
+    return Entries.Add(key, MakeShared<TArray<FACFResolvedAttributeInit>>(MoveTemp(resolved)));
+}
+
+void FACFAttributeInitCache::ApplyAttributes(UAbilitySystemComponent* abilityComp, const TArray<FACFResolvedAttributeInit>& attributes)
+{
+    if (!abilityComp) {
+        return;
+    }
+
+    for (const FACFResolvedAttributeInit& attribute : attributes) {
+        if (abilityComp->HasAttributeSetForAttribute(attribute.Attribute)) {
+            abilityComp->SetNumericAttributeBase(attribute.Attribute, attribute.Value);
+        }
+    }
+}
+
+void FACFAttributeInitCache::Invalidate()
+{
+    Entries.Empty();
+}
+
+void FACFAttributeInitCache::WatchTable(const UDataTable* table)
+{
+    if (!table || WatchedSources.Contains(table)) {
+        return;
+    }
+
+    WatchedSources.Add(table);
+    const_cast<UDataTable*>(table)->OnDataTableChanged().AddRaw(this, &FACFAttributeInitCache::Invalidate);
+}
+
+void FACFAttributeInitCache::WatchCurveTable(const UCurveTable* curveTable)
+{
+    if (!curveTable || WatchedSources.Contains(curveTable)) {
+        return;
+    }
+
+    WatchedSources.Add(curveTable);
+    const_cast<UCurveTable*>(curveTable)->OnCurveTableChanged().AddRaw(this, &FACFAttributeInitCache::Invalidate);
+}
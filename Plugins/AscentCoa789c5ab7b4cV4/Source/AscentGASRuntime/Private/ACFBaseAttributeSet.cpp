@@ -3,10 +3,71 @@
 #include "ACFBaseAttributeSet.h"
 #include "ACFGASTypes.h"
 #include "AbilitySystemComponent.h"
+#include "GameplayEffectExtension.h"
+
+namespace {
+int32 GetAttributeOffset(const FProperty* property)
+{
+    return property ? property->GetOffset_ForInternal() : INDEX_NONE;
+}
+}
+
+bool UACFBaseAttributeSet::PreGameplayEffectExecute(FGameplayEffectModCallbackData& Data)
+{
+    // base and current value of the modified attribute are clamped against the same max during the execution
+    ExecutingProperty = Data.EvaluatedData.Attribute.GetUProperty();
+    bExecutionMaxValid = false;
+    return Super::PreGameplayEffectExecute(Data);
+}
+
+void UACFBaseAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data)
+{
+    EndExecution();
+    Super::PostGameplayEffectExecute(Data);
+}
+
+void UACFBaseAttributeSet::PostLoad()
+{
+    Super::PostLoad();
+    InvalidateClampTable();
+}
+
+void UACFBaseAttributeSet::SetClamps(const TArray<FAttributeClamps>& inClamps)
+{
+    Clamps = inClamps;
+    InvalidateClampTable();
+}
+
+#if WITH_EDITOR
+void UACFBaseAttributeSet::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+    if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UACFBaseAttributeSet, Clamps)) {
+        InvalidateClampTable();
+    }
+}
+#endif
+
+void UACFBaseAttributeSet::InvalidateClampTable()
+{
+    ClampTable.Reset();
+    bExecutionMaxValid = false;
+}
+
+void UACFBaseAttributeSet::EndExecution() const
+{
+    ExecutingProperty = nullptr;
+    bExecutionMaxValid = false;
+}
 
 void UACFBaseAttributeSet::PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue)
 {
     ExecuteClamp(Attribute, NewValue);
+    if (Attribute.GetUProperty() == ExecutingProperty) {
+        // the current value is the last change of the execution. A subclass may veto the execution in its Pre
+        // and skip Post, ending here keeps the max from outliving the base and current change it was read for
+        EndExecution();
+    }
     Super::PreAttributeChange(Attribute, NewValue);
 }
 
@@ -18,20 +79,125 @@ void UACFBaseAttributeSet::PreAttributeBaseChange(const FGameplayAttribute& Attr
 
 void UACFBaseAttributeSet::ExecuteClamp(const FGameplayAttribute& Attribute, float& NewValue) const
 {
-    if (Clamps.Contains(Attribute)) {
+    InvalidateExecutionMaxValue(Attribute);
+
+    const FCompiledClamp* clamp = FindCompiledClamp(Attribute);
+    if (!clamp) {
+        return;
+    }
+
+    const bool bExecutingClamp = clamp->ClampedProperty == ExecutingProperty;
+    float maxValue;
+    if (bExecutingClamp && bExecutionMaxValid) {
+        maxValue = ExecutionMaxValue;
+    } else if (GetClampMaxValue(*clamp, maxValue)) {
+        if (bExecutingClamp) {
+            ExecutionMaxValue = maxValue;
+            bExecutionMaxValid = true;
+        }
+    } else {
+        return;
+    }
+    NewValue = FMath::Min(FMath::Max(NewValue, clamp->MinValue), maxValue);
+}
+
+const UACFBaseAttributeSet::FCompiledClamp* UACFBaseAttributeSet::FindCompiledClamp(const FGameplayAttribute& Attribute) const
+{
+    if (!ClampTable.IsValid()) {
+        ClampTable = CompileClampTable();
+    }
+
+    const FProperty* property = Attribute.GetUProperty();
+    if (ClampTable->bLinearLookup) {
+        return ClampTable->Entries.FindByPredicate([property](const FCompiledClamp& clamp) {
+            return clamp.ClampedProperty == property;
+        });
+    }
+
+    const int32 slot = GetAttributeOffset(property) / ClampTableStride;
+    if (!ClampTable->EntryByOffset.IsValidIndex(slot) || ClampTable->EntryByOffset[slot] == 0) {
+        return nullptr;
+    }
+
+    const FCompiledClamp& clamp = ClampTable->Entries[ClampTable->EntryByOffset[slot] - 1];
+    return clamp.ClampedProperty == property ? &clamp : nullptr;
+}
+
+bool UACFBaseAttributeSet::GetClampMaxValue(const FCompiledClamp& clamp, float& outMaxValue) const
+{
+    if (clamp.LocalMaxOffset != INDEX_NONE) {
+        outMaxValue = reinterpret_cast<const FGameplayAttributeData*>(reinterpret_cast<const uint8*>(this) + clamp.LocalMaxOffset)->GetCurrentValue();
+    } else {
         const UAbilitySystemComponent* abilityComp = GetOwningAbilitySystemComponent();
-        const FAttributeClamps* clampData = Clamps.FindByKey(Attribute);
-        if (abilityComp && clampData) {
-            bool bFound;
-            const float MaxValue = abilityComp->GetGameplayAttributeValue(clampData->MaxValueAttribute, bFound);
-            const float currentValue = abilityComp->GetGameplayAttributeValue(clampData->AttributeToClamp, bFound);
-            if (bFound) {
-                if (clampData->bClampToZero) {
-                    NewValue = FMath::Clamp(NewValue, 0.f, MaxValue);
-                } else {
-                    NewValue = FMath::Clamp(NewValue, -BIG_NUMBER, MaxValue);
-                }
+        if (!abilityComp) {
+            return false;
+        }
+        bool bFound;
+        outMaxValue = abilityComp->GetGameplayAttributeValue(clamp.MaxValueAttribute, bFound);
+    }
+    return true;
+}
+
+void UACFBaseAttributeSet::InvalidateExecutionMaxValue(const FGameplayAttribute& Attribute) const
+{
+    if (!bExecutionMaxValid || !ClampTable.IsValid()) {
+        return;
+    }
+
+    // a max changed while the effect is executing, e.g. from an attribute change delegate
+    const int32 slot = GetAttributeOffset(Attribute.GetUProperty()) / ClampTableStride;
+    if (ClampTable->MaxByOffset.IsValidIndex(slot) && ClampTable->MaxByOffset[slot]) {
+        bExecutionMaxValid = false;
+    }
+}
+
+TSharedRef<const UACFBaseAttributeSet::FClampTable> UACFBaseAttributeSet::CompileClampTable() const
+{
+    TSharedRef<FClampTable> table = MakeShared<FClampTable>();
+    const UClass* setClass = GetClass();
+
+    for (const FAttributeClamps& clampData : Clamps) {
+        const FProperty* clampedProperty = clampData.AttributeToClamp.GetUProperty();
+        // only attributes of this set are ever clamped by it
+        if (!clampedProperty || !setClass->IsChildOf(clampData.AttributeToClamp.GetAttributeSetClass())) {
+            continue;
+        }
+
+        // as with FindByKey, the first rule of an attribute wins
+        const bool bAlreadyClamped = table->Entries.ContainsByPredicate([clampedProperty](const FCompiledClamp& clamp) {
+            return clamp.ClampedProperty == clampedProperty;
+        });
+        if (bAlreadyClamped) {
+            continue;
+        }
+
+        const int32 slot = GetAttributeOffset(clampedProperty) / ClampTableStride;
+        if (table->EntryByOffset.Num() <= slot) {
+            table->EntryByOffset.SetNumZeroed(slot + 1);
+        }
+        if (table->EntryByOffset[slot] != 0 || table->Entries.Num() >= MAX_uint8) {
+            // the slot belongs to another attribute or can't index more rules, no rule is dropped
+            table->bLinearLookup = true;
+        }
+
+        FCompiledClamp& clamp = table->Entries.AddDefaulted_GetRef();
+        clamp.ClampedProperty = clampedProperty;
+        clamp.MaxValueAttribute = clampData.MaxValueAttribute;
+        clamp.MinValue = clampData.bClampToZero ? 0.f : -BIG_NUMBER;
+
+        const FProperty* maxProperty = clampData.MaxValueAttribute.GetUProperty();
+        if (maxProperty && FGameplayAttribute::IsGameplayAttributeDataProperty(maxProperty) && setClass->IsChildOf(clampData.MaxValueAttribute.GetAttributeSetClass())) {
+            clamp.LocalMaxOffset = GetAttributeOffset(maxProperty);
+            const int32 maxSlot = clamp.LocalMaxOffset / ClampTableStride;
+            if (table->MaxByOffset.Num() <= maxSlot) {
+                table->MaxByOffset.Add(false, maxSlot + 1 - table->MaxByOffset.Num());
             }
+            table->MaxByOffset[maxSlot] = true;
+        }
+        if (!table->bLinearLookup) {
+            table->EntryByOffset[slot] = static_cast<uint8>(table->Entries.Num());
         }
     }
+
+    return table;
 }
@@ -1,6 +1,7 @@
 // Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2025. All Rights Reserved.
 
 #include "ACFGASAttributesComponent.h"
+#include "ACFAttributeInitCache.h"
 #include "ACFGASDeveloperSettings.h"
 #include "ACFGASTypes.h"
 #include "AttributeSet.h"
@@ -77,21 +78,15 @@ void UACFGASAttributesComponent::InitAttributesValue()
 
 void UACFGASAttributesComponent::InitAttributesFromDT()
 {
+    FACFAttributeInitCache& initCache = FACFAttributeInitCache::Get();
     for (const auto& startData : abilityComp->DefaultStartingData) {
         if (!startData.DefaultStartingTable) {
             continue;
         }
-        const FACFAttributeInits* attInits = startData.DefaultStartingTable->FindRow<FACFAttributeInits>(CharacterRow.RowName, "");
 
-        if (!attInits) {
-            continue;
-        }
-
-        for (const auto& attribute : attInits->PawnAttributesInit) {
-            if (abilityComp->HasAttributeSetForAttribute(attribute.Attribute)) {
-                abilityComp->SetNumericAttributeBase(attribute.Attribute, attribute.InitValue);
-            }
-        }
+        // the values are held until applied, attribute delegates may invalidate the cache
+        const TSharedRef<const TArray<FACFResolvedAttributeInit>> attributes = initCache.FindOrAddFromTable(startData.DefaultStartingTable, CharacterRow.RowName, GetLevelingType());
+        FACFAttributeInitCache::ApplyAttributes(abilityComp, *attributes);
     }
 }
 
@@ -109,24 +104,8 @@ void UACFGASAttributesComponent::InitAttributesFromLevelCurves()
         return;
     }
 
-    for (const TPair<FName, uint8*>& Elem : AttributesByCurveRow->GetRowMap()) {
-        const FName& RowName = Elem.Key;
-        const FAttributeSerializeKeys* AttributeKey = AttributesByCurveRow->FindRow<FAttributeSerializeKeys>(Elem.Key, TEXT("InitAttributes"));
-
-        if (!AttributeKey) {
-            continue;
-        }
-
-        const FRealCurve* Curve = AttributesByLevelCurve->FindCurve(RowName, FString());
-        if (Curve) {
-            const float Value = Curve->Eval(static_cast<float>(CharacterLevel));
-            if (abilityComp->HasAttributeSetForAttribute(AttributeKey->Attribute)) {
-                abilityComp->SetNumericAttributeBase(AttributeKey->Attribute, Value);
-            }
-        } else {
-            UE_LOG(LogTemp, Warning, TEXT("Missing curve row for attribute: %s"), *RowName.ToString());
-        }
-    }
+    const TSharedRef<const TArray<FACFResolvedAttributeInit>> attributes = FACFAttributeInitCache::Get().FindOrAddFromCurves(AttributesByLevelCurve, AttributesByCurveRow, CharacterLevel);
+    FACFAttributeInitCache::ApplyAttributes(abilityComp, *attributes);
 }
 
 void UACFGASAttributesComponent::ApplyPermanentEffects()
@@ -0,0 +1,79 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "ACFGASTypes.h"
+#include "AttributeSet.h"
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UAbilitySystemComponent;
+class UCurveTable;
+class UDataTable;
+
+/**
+ * * Attribute value resolved from an init table or a level curve.
+ */
+struct FACFResolvedAttributeInit {
+    FGameplayAttribute Attribute;
+    float Value = 0.f;
+};
+
+/**
+ * * Process-wide cache of the starting attribute values of characters.
+ *
+ * Characters sharing the same row, level and leveling type resolve their attributes once: the data table rows
+ * are found and the level curves evaluated the first time, then every other spawn applies the cached values.
+ * Entries are dropped when any of the source tables changes, e.g. on reimport or hot reload.
+ * Resolved values are shared, so that they outlive the entry while being applied: setting an attribute fires
+ * its delegates, which may spawn characters or invalidate the cache.
+ */
+class ASCENTGASRUNTIME_API FACFAttributeInitCache {
+public:
+    static FACFAttributeInitCache& Get();
+
+    /**
+     * * Attribute values of a character row of an FACFAttributeInits table.
+     */
+    TSharedRef<const TArray<FACFResolvedAttributeInit>> FindOrAddFromTable(const UDataTable* startingTable, FName characterRow, ELevelingType levelingType);
+
+    /**
+     * * Attribute values of the curves of attributesByLevel evaluated at level, rows are mapped to attributes by attributesByCurveRow.
+     */
+    TSharedRef<const TArray<FACFResolvedAttributeInit>> FindOrAddFromCurves(const UCurveTable* attributesByLevel, const UDataTable* attributesByCurveRow, int32 level);
+
+    /**
+     * * Sets the base value of the attributes the ability system has a set for, in a single pass.
+     */
+    static void ApplyAttributes(UAbilitySystemComponent* abilityComp, const TArray<FACFResolvedAttributeInit>& attributes);
+
+    void Invalidate();
+
+    int32 Num() const { return Entries.Num(); }
+
+private:
+    struct FKey {
+        TObjectKey<UObject> Source;
+        TObjectKey<UObject> RowSource;
+        FName Row;
+        int32 Level = 0;
+        ELevelingType LevelingType = ELevelingType::ECantLevelUp;
+
+        bool operator==(const FKey& other) const
+        {
+            return Source == other.Source && RowSource == other.RowSource && Row == other.Row && Level == other.Level && LevelingType == other.LevelingType;
+        }
+
+        friend uint32 GetTypeHash(const FKey& key)
+        {
+            const uint32 sourceHash = HashCombine(GetTypeHash(key.Source), GetTypeHash(key.RowSource));
+            return HashCombine(HashCombine(sourceHash, GetTypeHash(key.Row)), HashCombine(GetTypeHash(key.Level), GetTypeHash(key.LevelingType)));
+        }
+    };
+
+    void WatchTable(const UDataTable* table);
+    void WatchCurveTable(const UCurveTable* curveTable);
+
+    TMap<FKey, TSharedRef<const TArray<FACFResolvedAttributeInit>>> Entries;
+    TSet<TObjectKey<UObject>> WatchedSources;
+};
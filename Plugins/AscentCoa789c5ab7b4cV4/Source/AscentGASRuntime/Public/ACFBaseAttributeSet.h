@@ -31,11 +31,27 @@
 /**
  * Base AttributeSet class with automatic attribute clamping support.
  * Stores a list of clamp rules to apply to attributes after modification.
+ *
+ * The first time a set clamps, its rules are compiled into a table indexed by the offset of the clamped
+ * attribute. The table is compiled again after the rules are loaded or edited.
  */
 UCLASS()
 class ASCENTGASRUNTIME_API UACFBaseAttributeSet : public UAttributeSet {
     GENERATED_BODY()
 
+public:
+    virtual bool PreGameplayEffectExecute(struct FGameplayEffectModCallbackData& Data) override;
+    virtual void PostGameplayEffectExecute(const struct FGameplayEffectModCallbackData& Data) override;
+
+    virtual void PostLoad() override;
+
+    /* Replaces the clamp rules of this set, they are compiled again on the next clamp */
+    void SetClamps(const TArray<FAttributeClamps>& inClamps);
+
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
 protected:
     /**
      * List of clamp rules applied automatically to attributes.
@@ -48,4 +64,42 @@ protected:
     virtual void PreAttributeBaseChange(const FGameplayAttribute& Attribute, float& NewValue) const override;
 
     void ExecuteClamp(const FGameplayAttribute& Attribute, float& NewValue) const;
+
+private:
+    struct FCompiledClamp {
+        const FProperty* ClampedProperty = nullptr;
+        FGameplayAttribute MaxValueAttribute;
+        float MinValue = 0.f;
+        // offset of the max attribute when it lives in this same set and can be read directly
+        int32 LocalMaxOffset = INDEX_NONE;
+    };
+
+    struct FClampTable {
+        TArray<FCompiledClamp> Entries;
+        // clamp index + 1 by attribute offset / ClampTableStride, 0 when the attribute is not clamped
+        TArray<uint8> EntryByOffset;
+        // attributes of this set used as max by a clamp, by offset / ClampTableStride
+        TBitArray<> MaxByOffset;
+        // set when two clamped attributes share a slot, entries are then searched by property
+        bool bLinearLookup = false;
+    };
+
+    static constexpr int32 ClampTableStride = alignof(FGameplayAttributeData);
+
+    TSharedRef<const FClampTable> CompileClampTable() const;
+    void InvalidateClampTable();
+
+    const FCompiledClamp* FindCompiledClamp(const FGameplayAttribute& Attribute) const;
+    bool GetClampMaxValue(const FCompiledClamp& clamp, float& outMaxValue) const;
+    void InvalidateExecutionMaxValue(const FGameplayAttribute& Attribute) const;
+    void EndExecution() const;
+
+    // compiled from Clamps on the first clamp
+    mutable TSharedPtr<const FClampTable> ClampTable;
+
+    // attribute modified by the executing gameplay effect, from its Pre until the change of its current value
+    mutable const FProperty* ExecutingProperty = nullptr;
+    // max resolved for the base value of the executing attribute, reused for its current value
+    mutable float ExecutionMaxValue = 0.f;
+    mutable bool bExecutionMaxValid = false;
 };
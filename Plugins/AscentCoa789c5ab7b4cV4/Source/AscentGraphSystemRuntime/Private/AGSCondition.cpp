@@ -14,3 +14,14 @@ bool UAGSCondition::VerifyForNode(class APlayerController* playerController, UAG
     nodeOwner = inNodeOwner;
     return Verify(playerController);
 }
+
+bool UAGSCondition::IsNativeCondition() const
+{
+    return !GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UAGSCondition, VerifyCondition));
+}
+
+bool UAGSCondition::VerifyNative(class APlayerController* playerController)
+{
+    Controller = playerController;
+    return VerifyCondition_Implementation(Controller);
+}
@@ -22,6 +22,16 @@ public:
     bool Verify(class APlayerController* playerController);
     bool VerifyForNode(class APlayerController* playerController, UAGSGraphNode* inNodeOwner);
 
+    /**
+     * Whether VerifyCondition is only implemented in C++, in which case VerifyNative can skip the Blueprint VM.
+     */
+    bool IsNativeCondition() const;
+
+    /**
+     * Same as Verify, but calls the C++ implementation directly. Only valid for native conditions.
+     */
+    bool VerifyNative(class APlayerController* playerController);
+
 protected:
     UFUNCTION(BlueprintNativeEvent, Category = AGS)
     bool VerifyCondition(class APlayerController* playerController) const;
@@ -64,7 +64,7 @@ public:
     void GetNodesByLevel(int32 Level, TArray<UAGSGraphNode*>& Nodes);
 
     /* Clears the graph, removing all nodes and connections */
-    void ClearGraph();
+    virtual void ClearGraph();
 
     /* Returns the player controller associated with this graph instance */
     UFUNCTION(BlueprintPure, Category = "AGSGraph")
@@ -40,6 +40,20 @@ void UASMBaseFSMState::OnUpdate_Implementation(float deltaTime)
 
 }
 
+bool UASMBaseFSMState::WantsUpdate() const
+{
+	if (GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UASMBaseFSMState, OnUpdate))) {
+		return true;
+	}
+
+	// native overrides of OnUpdate_Implementation cannot be detected, assume native subclasses need it
+	const UClass* nativeClass = GetClass();
+	while (nativeClass && !nativeClass->HasAnyClassFlags(CLASS_Native)) {
+		nativeClass = nativeClass->GetSuperClass();
+	}
+	return nativeClass != UASMBaseFSMState::StaticClass();
+}
+
 void UASMBaseFSMState::OnTransition_Implementation(const UASMBaseFSMState* previousState)
 {
 
@@ -17,6 +17,11 @@ UASMFSMComponent::UASMFSMComponent()
 void UASMFSMComponent::BeginPlay()
 {
     Super::BeginPlay();
+
+    if (StateMachine) {
+        stateChangedHandle = StateMachine->OnStateChanged.AddUObject(this, &UASMFSMComponent::RefreshTickEnabled);
+    }
+    RefreshTickEnabled();
 //     if (StateMachine) {
 //         FSM = DuplicateObject<UASMStateMachine>(StateMachine, GetOuter());
 //     }
@@ -27,6 +32,7 @@ void UASMFSMComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
     Super::EndPlay(EndPlayReason);
 
     if (StateMachine) {
+        StateMachine->OnStateChanged.Remove(stateChangedHandle);
         StateMachine->StopFSM();
     }
 }
@@ -48,6 +54,7 @@ void UASMFSMComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
             pendingTransition = FGameplayTag();
         }
     }
+    RefreshTickEnabled();
 }
 
 void UASMFSMComponent::PostInitProperties()
@@ -57,6 +64,19 @@ void UASMFSMComponent::PostInitProperties()
     SetComponentTickEnabled(true);
 }
 
+void UASMFSMComponent::RefreshTickEnabled()
+{
+    if (!HasBegunPlay()) {
+        return;
+    }
+
+    const bool bIsActive = StateMachine && StateMachine->IsActive();
+    const bool bNeedsTick = bIsActive && (pendingTransition != FGameplayTag() || StateMachine->CurrentStateWantsUpdate());
+    if (IsComponentTickEnabled() != bNeedsTick) {
+        SetComponentTickEnabled(bNeedsTick);
+    }
+}
+
 void UASMFSMComponent::StartFSM()
 {
     if (StateMachine) {
@@ -78,6 +98,7 @@ void UASMFSMComponent::StopFSM()
 void UASMFSMComponent::TriggerTransition(const FGameplayTag& transition)
 {
     pendingTransition = transition;
+    RefreshTickEnabled();
 }
 
 void UASMFSMComponent::ClientTriggerTransition_Implementation(const FGameplayTag& transition)
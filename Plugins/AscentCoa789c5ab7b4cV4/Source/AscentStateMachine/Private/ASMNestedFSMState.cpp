@@ -12,6 +12,14 @@ bool UASMNestedFSMState::TriggerSubFSMTransition(const FGameplayTag& transition)
 	return false;
 }
 
+bool UASMNestedFSMState::WantsUpdate() const
+{
+	if (SubFSM && bCanFsmTick) {
+		return true;
+	}
+	return GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UASMBaseFSMState, OnUpdate));
+}
+
 void UASMNestedFSMState::OnEnter_Implementation()
 {
 	if (SubFSM) {
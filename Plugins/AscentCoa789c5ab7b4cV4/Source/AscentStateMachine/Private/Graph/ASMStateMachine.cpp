@@ -6,12 +6,17 @@
 #include "Graph/ASMStartFSMNode.h"
 #include "Graph/ASMStateNode.h"
 #include "Graph/ASMTransition.h"
+#include <Kismet/GameplayStatics.h>
 
 bool UASMStateMachine::ActivateNode(class UAGSGraphNode* node)
 {
     currentState = Cast<UASMStateNode>(node);
+    const int32* stateIndex = CompiledStateIndices.Find(node);
+    currentStateIndex = stateIndex ? *stateIndex : INDEX_NONE;
 
-    return Super::ActivateNode(node);
+    const bool bActivated = Super::ActivateNode(node);
+    OnStateChanged.Broadcast();
+    return bActivated;
 }
 
 void UASMStateMachine::DispatchTick(float DeltaTime)
@@ -24,6 +29,52 @@ void UASMStateMachine::DispatchTick(float DeltaTime)
     }
 }
 
+bool UASMStateMachine::CurrentStateWantsUpdate() const
+{
+    if (currentState) {
+        const UASMBaseFSMState* state = currentState->GetState();
+        return state && state->WantsUpdate();
+    }
+    return false;
+}
+
+void UASMStateMachine::PostLoad()
+{
+    Super::PostLoad();
+    CompileTransitions();
+}
+
+void UASMStateMachine::CompileTransitions()
+{
+    CompiledStates.Reset();
+    CompiledStateIndices.Reset();
+
+    for (UAGSGraphNode* node : AllNodes) {
+        if (UASMStateNode* stateNode = Cast<UASMStateNode>(node)) {
+            CompiledStateIndices.Add(stateNode, CompiledStates.Num());
+            CompiledStates.AddDefaulted_GetRef().Node = stateNode;
+        }
+    }
+
+    for (FCompiledState& compiledState : CompiledStates) {
+        for (const auto& edge : compiledState.Node->Edges) {
+            UASMTransition* edgeTransition = Cast<UASMTransition>(edge.Value);
+            const int32* targetIndex = CompiledStateIndices.Find(edge.Key);
+            if (!edgeTransition || !targetIndex) {
+                continue;
+            }
+            edgeTransition->CompileConditions();
+
+            FCompiledTransition& compiledTransition = compiledState.Transitions.AddDefaulted_GetRef();
+            compiledTransition.Tag = edgeTransition->GetTransitionTag();
+            compiledTransition.TargetState = *targetIndex;
+            compiledTransition.Transition = edgeTransition;
+        }
+    }
+
+    bTransitionsCompiled = true;
+}
+
 UASMStateMachine::UASMStateMachine()
 {
     NodeType = UASMStateNode::StaticClass();
@@ -42,6 +93,14 @@ void UASMStateMachine::StartFSM(class AActor* inOwner, const bool bPrintDebugInf
     }
 
     bPrintDebug = bPrintDebugInfo;
+
+#if WITH_EDITOR
+    // the graph can be edited after load in the editor
+    bTransitionsCompiled = false;
+#endif
+    if (!bTransitionsCompiled) {
+        CompileTransitions();
+    }
     Internal_Start();
 }
 
@@ -66,26 +125,38 @@ bool UASMStateMachine::TriggerTransition(const FGameplayTag& transition)
         return false;
     }
 
-    for (UAGSGraphNode* node : GetActiveNodes()) {
-        UASMStateNode* fsmNode = Cast<UASMStateNode>(node);
-        if (fsmNode == currentState) {
-
-            for (auto edge : fsmNode->Edges) {
-                UASMTransition* edgeTransition = Cast<UASMTransition>(edge.Value);
-                if (edgeTransition && edgeTransition->GetTransitionTag() == transition && edgeTransition->VerifyTransitionConditions()) {
-                    DeactivateNode(fsmNode);
-                    UASMStateNode* stateNode = Cast<UASMStateNode>(edge.Key);
-                    if (stateNode) {
-                        stateNode->OnTransition(fsmNode->GetState());
-                        if (bPrintDebug) {
-                            GEngine->AddOnScreenDebugMessage(1, 5.0f, FColor::Yellow,
-                                FString::Printf(TEXT("Current State is: %s"), *stateNode->GetStateName().ToString()));
-                        }
-                        return ActivateNode(stateNode);
-                    }
-                }
+    if (!CompiledStates.IsValidIndex(currentStateIndex) || !IsNodeActive(currentState)) {
+        return false;
+    }
+
+    UASMStateNode* fsmNode = currentState;
+    APlayerController* playerController = nullptr;
+    bool bControllerResolved = false;
+
+    for (const FCompiledTransition& compiledTransition : CompiledStates[currentStateIndex].Transitions) {
+        if (compiledTransition.Tag != transition) {
+            continue;
+        }
+
+        UASMTransition* edgeTransition = compiledTransition.Transition;
+        if (edgeTransition->HasConditions()) {
+            if (!bControllerResolved) {
+                playerController = UGameplayStatics::GetPlayerController(this, 0);
+                bControllerResolved = true;
+            }
+            if (!edgeTransition->VerifyCompiledConditions(playerController)) {
+                continue;
             }
         }
+
+        DeactivateNode(fsmNode);
+        UASMStateNode* stateNode = CompiledStates[compiledTransition.TargetState].Node;
+        stateNode->OnTransition(fsmNode->GetState());
+        if (bPrintDebug) {
+            GEngine->AddOnScreenDebugMessage(1, 5.0f, FColor::Yellow,
+                FString::Printf(TEXT("Current State is: %s"), *stateNode->GetStateName().ToString()));
+        }
+        return ActivateNode(stateNode);
     }
     return false;
 }
@@ -97,6 +168,7 @@ void UASMStateMachine::StopFSM()
             DeactivateNode(node);
         }
         Enabled = EFSMState::NotStarted;
+        OnStateChanged.Broadcast();
     } else {
        // UE_LOG(LogTemp, Error, TEXT("FSM Not Started - UASMStateMachine::StopFSM"));
     }
@@ -18,3 +18,27 @@ bool UASMTransition::VerifyTransitionConditions()  {
   }
   return true;
 }
+
+bool UASMTransition::VerifyCompiledConditions(APlayerController* playerController)
+{
+    for (const FCompiledCondition& compiled : CompiledConditions) {
+        if (!compiled.Condition) {
+            return false;
+        }
+        const bool bVerified = compiled.bNative ? compiled.Condition->VerifyNative(playerController) : compiled.Condition->Verify(playerController);
+        if (!bVerified) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void UASMTransition::CompileConditions()
+{
+    CompiledConditions.Reset(ActivationConditions.Num());
+    for (UAGSCondition* cond : ActivationConditions) {
+        FCompiledCondition& compiled = CompiledConditions.AddDefaulted_GetRef();
+        compiled.Condition = cond;
+        compiled.bNative = cond && cond->IsNativeCondition();
+    }
+}
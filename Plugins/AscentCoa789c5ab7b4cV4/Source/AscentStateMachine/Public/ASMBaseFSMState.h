@@ -37,6 +37,10 @@ public:
         return actorOwner;
     }
 
+    /*Whether OnUpdate does something for this state. When false the owning component does not need to tick.
+    By default true when OnUpdate is implemented in Blueprint or when the state derives from a native state class*/
+    virtual bool WantsUpdate() const;
+
 protected:
     UPROPERTY(BlueprintReadOnly, Category = ASM)
     class APlayerController* LocalController;
@@ -107,6 +107,11 @@ private:
 
 	FGameplayTag pendingTransition;
 
+	/*Enables the component tick only while a transition is pending or the current state has update logic*/
+	void RefreshTickEnabled();
+
+	FDelegateHandle stateChangedHandle;
+
 
 /*	TObjectPtr<UASMStateMachine> FSM;*/
 };
@@ -20,6 +20,8 @@ public:
 	/*Triggers the provided transition in the SubFSM, returns whether the transition is succesful*/
 	UFUNCTION(BlueprintCallable, Category = ASM)
 	bool TriggerSubFSMTransition(const FGameplayTag& transition);
+
+	virtual bool WantsUpdate() const override;
 protected: 
 
 	/*The actual FSM. SubFSMs are currently not replicated*/
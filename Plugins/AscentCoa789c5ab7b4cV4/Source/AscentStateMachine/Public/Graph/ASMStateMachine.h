@@ -19,6 +19,8 @@ enum class EFSMState : uint8
 
 };
 
+DECLARE_MULTICAST_DELEGATE(FOnFSMStateChanged);
+
 UCLASS()
 class ASCENTSTATEMACHINE_API UASMStateMachine : public UAGSGraph
 {
@@ -36,6 +38,25 @@ private:
 
 	bool bPrintDebug = false;
 
+	/*Outgoing transitions of a state, flattened from the graph edges*/
+	struct FCompiledTransition {
+		FGameplayTag Tag;
+		int32 TargetState = INDEX_NONE;
+		class UASMTransition* Transition = nullptr;
+	};
+
+	struct FCompiledState {
+		class UASMStateNode* Node = nullptr;
+		TArray<FCompiledTransition> Transitions;
+	};
+
+	TArray<FCompiledState> CompiledStates;
+	TMap<const class UAGSGraphNode*, int32> CompiledStateIndices;
+	int32 currentStateIndex = INDEX_NONE;
+	bool bTransitionsCompiled = false;
+
+	void CompileTransitions();
+
 protected:
 
 	virtual bool ActivateNode(class UAGSGraphNode* node) override;
@@ -65,6 +86,14 @@ public:
 
 	void DispatchTick(float DeltaTime);
 
+	/*Whether the current state does something in OnUpdate*/
+	bool CurrentStateWantsUpdate() const;
+
+	/*Called whenever the FSM enters a state or stops*/
+	FOnFSMStateChanged OnStateChanged;
+
+	virtual void PostLoad() override;
+
 	UWorld* GetWorld() const override { return fsmOwner ? fsmOwner->GetWorld() : nullptr; }
 
 };
@@ -31,4 +31,22 @@ public:
 
 	bool VerifyTransitionConditions() ;
 
+	/*Same as VerifyTransitionConditions, using the conditions compiled by CompileConditions*/
+	bool VerifyCompiledConditions(class APlayerController* playerController);
+
+	/*Caches which conditions can be verified without going through the Blueprint VM*/
+	void CompileConditions();
+
+	bool HasConditions() const {
+		return ActivationConditions.Num() > 0;
+	}
+
+private:
+
+	struct FCompiledCondition {
+		class UAGSCondition* Condition = nullptr;
+		bool bNative = false;
+	};
+
+	TArray<FCompiledCondition> CompiledConditions;
 };
@@ -33,6 +33,7 @@ void UATSTargetingComponent::BeginPlay()
 {
     Super::BeginPlay();
     SetComponentTickEnabled(false);
+    SetComponentTickInterval(FMath::Max(TargetValidationInterval, 0.f));
     SetOwnerReferences();
 }
 
@@ -69,12 +70,14 @@ void UATSTargetingComponent::AddFilter(TSubclassOf<UATSTargetingFilter> filterCl
 {
     UATSTargetingFilter* newFilter = NewObject<UATSTargetingFilter>(filterClass);
     TargetFilters.AddUnique(newFilter);
+    InvalidateCandidates();
 }
 
 void UATSTargetingComponent::AddObjectType(TEnumAsByte<EObjectTypeQuery> objectTypeToTrace)
 {
     if (!ObjectsToQuery.Contains(objectTypeToTrace)) {
         ObjectsToQuery.Add(objectTypeToTrace);
+        InvalidateCandidates();
     }
 }
 
@@ -82,6 +85,7 @@ void UATSTargetingComponent::RemoveObjectType(TEnumAsByte<EObjectTypeQuery> obje
 {
     if (ObjectsToQuery.Contains(objectTypeToTrace)) {
         ObjectsToQuery.Remove(objectTypeToTrace);
+        InvalidateCandidates();
     }
 }
 
@@ -96,6 +100,7 @@ bool UATSTargetingComponent::RemoveFilter(TSubclassOf<UATSTargetingFilter> filte
     }
     if (TargetFilters.IsValidIndex(index)) {
         TargetFilters.RemoveAt(index);
+        InvalidateCandidates();
         return true;
     }
     return false;
@@ -106,7 +111,8 @@ void UATSTargetingComponent::ActivateTargeting()
     AActor* currentTarget = nullptr;
 
     if (ControlledPawn && cameraManger) {
-        PopulatePotentialTargetsArray();
+        // a new lock always starts from a fresh search
+        PopulatePotentialTargetsArray(true);
         FVector cameraForwardVector = UKismetMathLibrary::GetForwardVector(cameraManger->GetCameraRotation());
 
         cameraForwardVector.Z = 0;
@@ -150,44 +156,72 @@ void UATSTargetingComponent::ActivateTargeting()
 
 TArray<AActor*> UATSTargetingComponent::GetAllTargetsByDirection(ETargetingDirection direction)
 {
+    TArray<FATSTargetCandidate> candidates;
+    BuildCandidatesScreenOffsets(candidates);
+
     TArray<AActor*> actorFilter;
-    for (AActor* target : availableTargets) {
-        if (target != CurrentTarget && IsValidTarget(target)) {
-            FVector PotentialTargetLocation = target->GetActorLocation();
+    actorFilter.Reserve(candidates.Num());
+    for (const FATSTargetCandidate& candidate : candidates) {
+        AActor* target = candidate.Actor.Get();
+        if (!target || !candidate.bInFront) {
+            continue;
+        }
 
-            if (!IsInFrontOfOwner(target)) {
-                continue;
-            }
-            switch (direction) {
-            case ETargetingDirection::ERight:
-                if (IsRightOfCurrentTarget(PotentialTargetLocation)) {
-                    actorFilter.AddUnique(target);
-                }
-                break;
-            case ETargetingDirection::ELeft:
-                if (!IsRightOfCurrentTarget(PotentialTargetLocation)) {
-                    actorFilter.AddUnique(target);
-                }
-                break;
-            case ETargetingDirection::EDown:
-                if (!IsUpOfCurrentTarget(PotentialTargetLocation)) {
-                    actorFilter.AddUnique(target);
-                }
-                break;
-            case ETargetingDirection::EUp:
-                if (IsUpOfCurrentTarget(PotentialTargetLocation)) {
-                    actorFilter.AddUnique(target);
-                }
-                break;
-            default:
-                break;
-            }
+        bool bInDirection = false;
+        switch (direction) {
+        case ETargetingDirection::ERight:
+            bInDirection = candidate.ScreenOffset.X >= 0;
+            break;
+        case ETargetingDirection::ELeft:
+            bInDirection = candidate.ScreenOffset.X < 0;
+            break;
+        case ETargetingDirection::EDown:
+            bInDirection = candidate.ScreenOffset.Y < 0;
+            break;
+        case ETargetingDirection::EUp:
+            bInDirection = candidate.ScreenOffset.Y >= 0;
+            break;
+        default:
+            break;
+        }
+
+        if (bInDirection) {
+            actorFilter.AddUnique(target);
         }
     }
 
     return actorFilter;
 }
 
+void UATSTargetingComponent::BuildCandidatesScreenOffsets(TArray<FATSTargetCandidate>& outCandidates)
+{
+    outCandidates.Reset(availableTargets.Num());
+
+    APlayerController* playerController = UGameplayStatics::GetPlayerController(this, 0);
+    if (!playerController) {
+        return;
+    }
+
+    // project the current target once instead of once per candidate and direction check
+    FVector2D currentTargetLocationOnScreen;
+    playerController->ProjectWorldLocationToScreen(GetCurrentTargetPointLocation(), currentTargetLocationOnScreen);
+
+    for (AActor* target : availableTargets) {
+        if (target == CurrentTarget || !IsValidTarget(target)) {
+            continue;
+        }
+
+        FATSTargetCandidate& candidate = outCandidates.AddDefaulted_GetRef();
+        candidate.Actor = target;
+        candidate.bInFront = IsInFrontOfOwner(target);
+        if (candidate.bInFront) {
+            FVector2D potentialTargetLocationOnScreen;
+            playerController->ProjectWorldLocationToScreen(target->GetActorLocation(), potentialTargetLocationOnScreen);
+            candidate.ScreenOffset = potentialTargetLocationOnScreen - currentTargetLocationOnScreen;
+        }
+    }
+}
+
 bool UATSTargetingComponent::TrySwitchPointOnCurrentTarget(ETargetingDirection direction)
 {
     UATSTargetPointComponent* bestpoint = nullptr;
@@ -280,11 +314,13 @@ AActor* UATSTargetingComponent::GetNearestTarget(TArray<AActor*>& actorFilter)
     if (actorFilter.Num() > 0) {
         float distanceFromCurrentTarget = 999999.f;
 
+        const FVector pawnLocation = ControlledPawn->GetActorLocation();
+        distanceFromCurrentTarget = FMath::Square(distanceFromCurrentTarget);
         for (int32 i = 0; i < actorFilter.Num(); ++i) {
             if (!actorFilter[i]) {
                 continue;
             }
-            float distance = actorFilter[i]->GetDistanceTo(ControlledPawn);
+            const float distance = FVector::DistSquared(actorFilter[i]->GetActorLocation(), pawnLocation);
             if (distance < distanceFromCurrentTarget) {
                 distanceFromCurrentTarget = distance;
                 localTarget = actorFilter[i];
@@ -318,6 +354,7 @@ UATSTargetPointComponent* UATSTargetingComponent::GetNearestTargetPoint(TArray<U
 void UATSTargetingComponent::HandlePawnChanged(class APawn* newPawn)
 {
     ControlledPawn = newPawn;
+    InvalidateCandidates();
 }
 
 bool UATSTargetingComponent::IsValidTarget(AActor* target)
@@ -325,12 +362,24 @@ bool UATSTargetingComponent::IsValidTarget(AActor* target)
     if (target && ControlledPawn && target != ControlledPawn) {
         bool bImplements = target->GetClass()->ImplementsInterface(UATSTargetableInterface::StaticClass());
         if (bImplements) {
+            if (FilterResultsCacheFrame != GFrameCounter) {
+                FilterResultsCache.Reset();
+                FilterResultsCacheFrame = GFrameCounter;
+            }
+
+            if (const bool* cachedResult = FilterResultsCache.Find(target)) {
+                return *cachedResult;
+            }
+
+            bool bTargetable = true;
             for (UATSTargetingFilter* filter : TargetFilters) {
                 if (filter && !filter->IsActorTargetable(GetOwner(), target)) {
-                    return false;
+                    bTargetable = false;
+                    break;
                 }
             }
-            return true;
+            FilterResultsCache.Add(target, bTargetable);
+            return bTargetable;
         }
     }
     return false;
@@ -489,9 +538,16 @@ ELockType UATSTargetingComponent::GetLockTypeByTargetingType(ETargetingType targ
     return ELockType::EAllAxis;
 }
 
-void UATSTargetingComponent::PopulatePotentialTargetsArray()
+void UATSTargetingComponent::PopulatePotentialTargetsArray(bool bForceRefresh)
 {
     if (ControlledPawn) {
+        const float currentTime = GetWorld()->GetTimeSeconds();
+        if (!bForceRefresh && LastCandidatesRefreshTime >= 0.f && currentTime - LastCandidatesRefreshTime < CandidatesRefreshInterval) {
+            // drop candidates destroyed since the last search, the rest is still close enough to be relevant
+            availableTargets.RemoveAll([](const AActor* target) { return !IsValid(target); });
+            return;
+        }
+        LastCandidatesRefreshTime = currentTime;
 
         availableTargets.Empty();
         TArray<AActor*> ignoredActors;
@@ -514,6 +570,12 @@ void UATSTargetingComponent::PopulatePotentialTargetsArray()
     }
 }
 
+void UATSTargetingComponent::InvalidateCandidates()
+{
+    LastCandidatesRefreshTime = -1.f;
+    FilterResultsCache.Reset();
+}
+
 void UATSTargetingComponent::SwitchTargetByDirection(ETargetingDirection direction)
 {
     if (TrySwitchPointOnCurrentTarget(direction)) {
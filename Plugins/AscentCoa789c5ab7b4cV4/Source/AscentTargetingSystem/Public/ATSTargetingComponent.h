@@ -99,6 +99,15 @@ protected:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = ATS)
     bool bStopTargetingIfOutOfSight = true;
 
+    /*Seconds before the potential targets found with the sphere overlap are searched again.
+    Switching targets within this time only sorts the cached candidates. 0 searches every time*/
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "ATS|Performance")
+    float CandidatesRefreshInterval = .25f;
+
+    /*Seconds between checks that the locked target is still valid (distance, sight, alive). 0 checks every frame*/
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "ATS|Performance")
+    float TargetValidationInterval = .1f;
+
 public:
     // Called every frame
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
@@ -178,9 +187,20 @@ public:
     FOnTargetChanged OnTargetChanged;
 
 private:
+    /*Potential target with its screen position computed once per switch request*/
+    struct FATSTargetCandidate {
+        TWeakObjectPtr<AActor> Actor;
+        FVector2D ScreenOffset = FVector2D::ZeroVector;
+        bool bInFront = false;
+    };
+
     ELockType GetLockTypeByTargetingType(ETargetingType targetType);
 
-    void PopulatePotentialTargetsArray();
+    void PopulatePotentialTargetsArray(bool bForceRefresh = false);
+
+    void InvalidateCandidates();
+
+    void BuildCandidatesScreenOffsets(TArray<FATSTargetCandidate>& outCandidates);
 
     void SwitchTargetByDirection(ETargetingDirection direction);
 
@@ -228,6 +248,12 @@ private:
     UPROPERTY()
     TArray<AActor*> availableTargets;
 
+    float LastCandidatesRefreshTime = -1.f;
+
+    /*IsValidTarget runs every filter, results are reused for the rest of the frame*/
+    TMap<TObjectKey<AActor>, bool> FilterResultsCache;
+    uint64 FilterResultsCacheFrame = 0;
+
     TObjectPtr<APawn> ControlledPawn;
 
     bool bCanTarget = true;
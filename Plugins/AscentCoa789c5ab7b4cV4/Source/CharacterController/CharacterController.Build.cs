@@ -50,6 +50,7 @@ public class CharacterController : ModuleRules
 				"GameplayTags",
 				"AnimGraphRuntime",
 				"AIModule",
+				"PhysicsCore",
 				"AscentTargetingSystem"
 			}
 			);
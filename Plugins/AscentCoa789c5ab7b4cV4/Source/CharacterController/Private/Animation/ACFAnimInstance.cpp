@@ -3,6 +3,7 @@
 #include "Animation/ACFAnimInstance.h"
 #include "ACFCCFunctionLibrary.h"
 #include "Animation/ACFAnimTypes.h"
+#include "Animation/ACFAnimationBudgetSubsystem.h"
 #include "Animation/ACFIKLayer.h"
 #include "Animation/ACFMovesetLayer.h"
 #include "Animation/ACFOverlayLayer.h"
@@ -43,6 +44,25 @@ void UACFAnimInstance::NativeBeginPlay()
 	if (IKLayer && IKLayer != UACFIKLayer::StaticClass()) {
 		LinkAnimClassLayers(IKLayer);
 	}
+
+	if (bUseAnimationBudget && CharacterOwner) {
+		if (UACFAnimationBudgetSubsystem* budgetSubsystem = UWorld::GetSubsystem<UACFAnimationBudgetSubsystem>(GetWorld())) {
+			budgetSubsystem->RegisterAnimInstance(this);
+			bRegisteredToBudget = true;
+		}
+	}
+}
+
+void UACFAnimInstance::NativeUninitializeAnimation()
+{
+	if (bRegisteredToBudget) {
+		if (UACFAnimationBudgetSubsystem* budgetSubsystem = UWorld::GetSubsystem<UACFAnimationBudgetSubsystem>(GetWorld())) {
+			budgetSubsystem->UnregisterAnimInstance(this);
+		}
+		bRegisteredToBudget = false;
+	}
+
+	Super::NativeUninitializeAnimation();
 }
 
 void UACFAnimInstance::SetMoveset(const FGameplayTag& MovesetTag)
@@ -167,7 +187,11 @@ void UACFAnimInstance::SetReferences()
 void UACFAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
 {
 	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_ACFAnimInstance_ThreadSafeUpdate);
+	const uint64 startCycles = FPlatformTime::Cycles64();
+
 	if (CharacterOwner && MovementComp) {
+		const bool bIdleAI = bSkipIdleAISubUpdates && !CharacterOwner->IsPlayerControlled() && !MovementComp->GetIsAiming();
 		if (bUpdateMovementData) {
 			UpdateStateData(DeltaSeconds);
 		}
@@ -184,15 +208,29 @@ void UACFAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
 			UpdateAcceleration(DeltaSeconds);
 		}
 		if (bUpdateAimData) {
-			UpdateAimData(DeltaSeconds);
+			if (bIdleAI) {
+				AimOffset = FMath::Vector2DInterpTo(AimOffset, FVector2D::ZeroVector, DeltaSeconds, AimOffsetInterpSpeed);
+			}
+			else {
+				UpdateAimData(DeltaSeconds);
+			}
 		}
 		if (bUpdateJumpData) {
 			UpdateJump(DeltaSeconds);
 		}
 		if (bUpdateLeaningData) {
-			UpdateLeaning(DeltaSeconds);
+			if (bIdleAI && BudgetUpdateInterval > 1) {
+				LeanAngle = 0.f;
+			}
+			else {
+				UpdateLeaning(DeltaSeconds);
+			}
 		}
 	}
+
+	const float updateCostMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - startCycles);
+	LastUpdateCostMs.store(updateCostMs, std::memory_order_relaxed);
+	AverageUpdateCostMs.store(FMath::Lerp(AverageUpdateCostMs.load(std::memory_order_relaxed), updateCostMs, 0.1f), std::memory_order_relaxed);
 }
 void UACFAnimInstance::UpdateLocation(float deltatime)
 {
@@ -248,7 +286,7 @@ void UACFAnimInstance::UpdateVelocity(float deltatime)
 
 bool UACFAnimInstance::IsLocalPlayer() const
 {
-	return CharacterOwner->IsLocallyControlled() && CharacterOwner->IsPlayerControlled();
+	return CharacterOwner && CharacterOwner->IsLocallyControlled() && CharacterOwner->IsPlayerControlled();
 }
 
 FRotator UACFAnimInstance::GetOwnerControllerRotation() const
@@ -376,6 +414,9 @@ void UACFAnimInstance::UpdateJump(float deltatime)
 
 	const FCharacterGroundInfo& GroundInfo = MovementComp->GetGroundInfo();
 	GroundDistance = GroundInfo.GroundDistance;
+	GroundNormal = GroundInfo.GroundNormal;
+	GroundSlopePitch = GroundInfo.SlopePitch;
+	GroundSlopeRoll = GroundInfo.SlopeRoll;
 
 	if (bIsJumping) {
 		TimeToApex = UKismetMathLibrary::SafeDivide(-WorldSpeed.Z, MovementComp->GetGravityZ());
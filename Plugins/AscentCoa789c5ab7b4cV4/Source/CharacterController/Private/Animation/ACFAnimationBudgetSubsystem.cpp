@@ -0,0 +1,183 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "Animation/ACFAnimationBudgetSubsystem.h"
+#include "Animation/ACFAnimInstance.h"
+#include <Camera/PlayerCameraManager.h>
+#include <Components/SkeletalMeshComponent.h>
+#include <Engine/World.h>
+#include <GameFramework/Pawn.h>
+#include <GameFramework/PlayerController.h>
+
+bool UACFAnimationBudgetSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UACFAnimationBudgetSubsystem::Deinitialize()
+{
+    for (const FBudgetedInstance& instance : Instances) {
+        RestoreMesh(instance);
+    }
+    Instances.Empty();
+    ViewLocations.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UACFAnimationBudgetSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UACFAnimationBudgetSubsystem, STATGROUP_Tickables);
+}
+
+void UACFAnimationBudgetSubsystem::RegisterAnimInstance(UACFAnimInstance* animInstance)
+{
+    if (!animInstance || Instances.ContainsByPredicate([animInstance](const FBudgetedInstance& instance) { return instance.AnimInstance == animInstance; })) {
+        return;
+    }
+
+    FBudgetedInstance& instance = Instances.AddDefaulted_GetRef();
+    instance.AnimInstance = animInstance;
+
+    if (USkeletalMeshComponent* mesh = animInstance->GetSkelMeshComponent()) {
+        instance.bMeshUpdateRateOptimizations = mesh->bEnableUpdateRateOptimizations;
+        mesh->bEnableUpdateRateOptimizations = true;
+        mesh->EnableExternalTickRateControl(true);
+        mesh->SetExternalTickRate(1);
+    }
+    animInstance->SetBudgetUpdateInterval(1);
+}
+
+void UACFAnimationBudgetSubsystem::UnregisterAnimInstance(UACFAnimInstance* animInstance)
+{
+    const int32 index = Instances.IndexOfByPredicate([animInstance](const FBudgetedInstance& instance) { return instance.AnimInstance == animInstance; });
+    if (index == INDEX_NONE) {
+        return;
+    }
+
+    RestoreMesh(Instances[index]);
+    Instances.RemoveAtSwap(index);
+}
+
+void UACFAnimationBudgetSubsystem::RestoreMesh(const FBudgetedInstance& instance) const
+{
+    const UACFAnimInstance* animInstance = instance.AnimInstance.Get();
+    if (USkeletalMeshComponent* mesh = animInstance ? animInstance->GetSkelMeshComponent() : nullptr) {
+        mesh->EnableExternalTickRateControl(false);
+        mesh->EnableExternalInterpolation(false);
+        mesh->bEnableUpdateRateOptimizations = instance.bMeshUpdateRateOptimizations;
+    }
+}
+
+void UACFAnimationBudgetSubsystem::Tick(float DeltaTime)
+{
+    if (Instances.Num() == 0) {
+        EstimatedCostMs = 0.f;
+        NumThrottled = 0;
+        return;
+    }
+
+    // nothing is rendered on a dedicated server, only the distance to the remote players counts there
+    const bool bCheckRendered = !IsRunningDedicatedServer();
+
+    ViewLocations.Reset();
+    for (FConstPlayerControllerIterator iterator = GetWorld()->GetPlayerControllerIterator(); iterator; ++iterator) {
+        const APlayerController* playerController = iterator->Get();
+        if (!playerController) {
+            continue;
+        }
+        if (playerController->IsLocalController() && playerController->PlayerCameraManager) {
+            ViewLocations.Add(playerController->PlayerCameraManager->GetCameraLocation());
+        } else if (playerController->IsLocalController() || !bCheckRendered) {
+            if (const APawn* pawn = playerController->GetPawn()) {
+                ViewLocations.Add(pawn->GetActorLocation());
+            }
+        }
+    }
+
+    const float distanceRange = FMath::Max(MaxRateDistance - FullRateDistance, 1.f);
+
+    for (int32 index = Instances.Num() - 1; index >= 0; index--) {
+        FBudgetedInstance& instance = Instances[index];
+        const UACFAnimInstance* animInstance = instance.AnimInstance.Get();
+        const USkeletalMeshComponent* mesh = animInstance ? animInstance->GetSkelMeshComponent() : nullptr;
+        if (!mesh) {
+            Instances.RemoveAtSwap(index);
+            continue;
+        }
+
+        instance.CostMs = animInstance->GetAverageUpdateCostMs() + EstimatedGraphCostMs;
+
+        if (animInstance->IsLocalPlayer()) {
+            instance.Significance = TNumericLimits<float>::Max();
+            instance.MinInterval = 1;
+            instance.Interval = 1;
+            continue;
+        }
+
+        float distance = 0.f;
+        if (ViewLocations.Num() > 0) {
+            float minDistSquared = TNumericLimits<float>::Max();
+            for (const FVector& viewLocation : ViewLocations) {
+                minDistSquared = FMath::Min(minDistSquared, FVector::DistSquared(viewLocation, mesh->GetComponentLocation()));
+            }
+            distance = FMath::Sqrt(minDistSquared);
+        }
+
+        const bool bRendered = !bCheckRendered || mesh->WasRecentlyRendered(0.2f);
+        const float distanceAlpha = FMath::Clamp((distance - FullRateDistance) / distanceRange, 0.f, 1.f);
+        instance.MinInterval = 1 + FMath::FloorToInt(distanceAlpha * (MaxUpdateInterval - 1));
+        if (!bRendered) {
+            instance.MinInterval = FMath::Max(instance.MinInterval, OccludedUpdateInterval);
+        }
+        instance.MinInterval = FMath::Min(instance.MinInterval, MaxUpdateInterval);
+        instance.Interval = instance.MinInterval;
+        instance.Significance = (bRendered ? 1.f : 0.25f) / (1.f + distance);
+    }
+
+    Instances.Sort([](const FBudgetedInstance& first, const FBudgetedInstance& second) {
+        return first.Significance > second.Significance;
+    });
+
+    float totalCost = 0.f;
+    for (const FBudgetedInstance& instance : Instances) {
+        totalCost += instance.CostMs / instance.Interval;
+    }
+
+    // halves the update rate of the least significant instances first until the estimate fits the budget
+    bool bChanged = true;
+    while (totalCost > BudgetMs && bChanged) {
+        bChanged = false;
+        for (int32 index = Instances.Num() - 1; index >= 0 && totalCost > BudgetMs; index--) {
+            FBudgetedInstance& instance = Instances[index];
+            if (instance.Significance == TNumericLimits<float>::Max() || instance.Interval >= MaxUpdateInterval) {
+                continue;
+            }
+            const int32 newInterval = FMath::Min(instance.Interval * 2, MaxUpdateInterval);
+            totalCost -= instance.CostMs / instance.Interval - instance.CostMs / newInterval;
+            instance.Interval = newInterval;
+            bChanged = true;
+        }
+    }
+
+    EstimatedCostMs = totalCost;
+    NumThrottled = 0;
+    for (const FBudgetedInstance& instance : Instances) {
+        if (instance.Interval > 1) {
+            NumThrottled++;
+        }
+        ApplyInterval(instance.AnimInstance.Get(), instance.Interval);
+    }
+}
+
+void UACFAnimationBudgetSubsystem::ApplyInterval(UACFAnimInstance* animInstance, int32 interval) const
+{
+    if (animInstance->GetBudgetUpdateInterval() == interval) {
+        return;
+    }
+
+    if (USkeletalMeshComponent* mesh = animInstance->GetSkelMeshComponent()) {
+        mesh->SetExternalTickRate(static_cast<uint8>(interval));
+        mesh->EnableExternalInterpolation(bInterpolateSkippedFrames && interval > 1);
+    }
+    animInstance->SetBudgetUpdateInterval(interval);
+}
@@ -19,6 +19,11 @@
 #include "ACFCCFunctionLibrary.h"
 #include "ACFActionTypes.h"
 #include "Actions/ACFActionAbility.h"
+#include <PhysicalMaterials/PhysicalMaterial.h>
+
+DECLARE_STATS_GROUP(TEXT("ACF Ground"), STATGROUP_ACFGround, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ground Traces Performed"), STAT_ACFGroundTracesPerformed, STATGROUP_ACFGround);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ground Traces Saved"), STAT_ACFGroundTracesSaved, STATGROUP_ACFGround);
 
 UACFCharacterMovementComponent::UACFCharacterMovementComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -183,11 +188,17 @@ void UACFCharacterMovementComponent::UpdateLocomotion()
 
 const FCharacterGroundInfo& UACFCharacterMovementComponent::GetGroundInfo()
 {
-	if (!CharacterOwner || (GFrameCounter == CachedGroundInfo.LastUpdateFrame)) {
-		return CachedGroundInfo;
+	if (CharacterOwner && (GFrameCounter != CachedGroundInfo.LastUpdateFrame)) {
+		UpdateGroundInfo();
 	}
+	return CachedGroundInfo;
+}
 
-	if (MovementMode == MOVE_Walking) {
+bool UACFCharacterMovementComponent::UpdateGroundInfo()
+{
+	const bool bTraceGround = MovementMode != MOVE_Walking;
+	if (!bTraceGround) {
+		// the floor sweep of the movement already found the ground
 		CachedGroundInfo.GroundHitResult = CurrentFloor.HitResult;
 		CachedGroundInfo.GroundDistance = 0.0f;
 	}
@@ -203,7 +214,9 @@ const FCharacterGroundInfo& UACFCharacterMovementComponent::GetGroundInfo()
 		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ACFCharacterMovementComponent_GetGroundInfo), false, CharacterOwner);
 		FCollisionResponseParams ResponseParam;
 		InitCollisionParams(QueryParams, ResponseParam);
+		QueryParams.bReturnPhysicalMaterial = true;
 
+		INC_DWORD_STAT(STAT_ACFGroundTracesPerformed);
 		FHitResult HitResult;
 		GetWorld()->LineTraceSingleByChannel(HitResult, TraceStart, TraceEnd, CollisionChannel, QueryParams, ResponseParam);
 
@@ -216,18 +229,20 @@ const FCharacterGroundInfo& UACFCharacterMovementComponent::GetGroundInfo()
 		else if (HitResult.bBlockingHit) {
 			CachedGroundInfo.GroundDistance = FMath::Max((HitResult.Distance - CapsuleHalfHeight), 0.0f);
 		}
-
-		const FVector normal = HitResult.ImpactNormal;
-		const FRotator actorRot = CharacterOwner->GetActorRotation();
-		const FVector upVector = UKismetMathLibrary::GetUpVector(actorRot);
-		const FVector rightVector = UKismetMathLibrary::GetUpVector(FRotator(0.f, actorRot.Yaw, 0.f));
-		UKismetMathLibrary::GetSlopeDegreeAngles(rightVector, normal, upVector,
-			CachedGroundInfo.SlopePitch, CachedGroundInfo.SlopeRoll);
 	}
 
+	const FHitResult& groundHit = CachedGroundInfo.GroundHitResult;
+	CachedGroundInfo.GroundNormal = groundHit.bBlockingHit ? FVector(groundHit.ImpactNormal) : FVector::UpVector;
+
+	const FRotator actorRot = CharacterOwner->GetActorRotation();
+	const FVector upVector = UKismetMathLibrary::GetUpVector(actorRot);
+	const FVector rightVector = UKismetMathLibrary::GetUpVector(FRotator(0.f, actorRot.Yaw, 0.f));
+	UKismetMathLibrary::GetSlopeDegreeAngles(rightVector, CachedGroundInfo.GroundNormal, upVector,
+		CachedGroundInfo.SlopePitch, CachedGroundInfo.SlopeRoll);
+
 	CachedGroundInfo.LastUpdateFrame = GFrameCounter;
 
-	return CachedGroundInfo;
+	return bTraceGround;
 }
 
 const float UACFCharacterMovementComponent::GetGroundDistance()
@@ -235,6 +250,62 @@ const float UACFCharacterMovementComponent::GetGroundDistance()
 	return GetGroundInfo().GroundDistance;
 }
 
+TEnumAsByte<EPhysicalSurface> UACFCharacterMovementComponent::GetGroundSurfaceType()
+{
+	if (!CharacterOwner || GFrameCounter == CachedGroundInfo.SurfaceUpdateFrame) {
+		return CachedGroundInfo.SurfaceType;
+	}
+
+	// footstep effects used to trace the surface on every lookup, a lookup saves that trace when it is answered without tracing
+	bool bTraced = false;
+	if (GFrameCounter != CachedGroundInfo.LastUpdateFrame) {
+		bTraced = UpdateGroundInfo();
+	}
+	const FCharacterGroundInfo& groundInfo = CachedGroundInfo;
+	CachedGroundInfo.SurfaceUpdateFrame = GFrameCounter;
+
+	const FHitResult& groundHit = groundInfo.GroundHitResult;
+	const UPrimitiveComponent* groundComp = groundHit.GetComponent();
+	if (!groundHit.bBlockingHit || !groundComp || groundInfo.GroundDistance > SurfaceTraceDistance) {
+		SurfaceCacheComponent.Reset();
+		CachedGroundInfo.PhysicalMaterial.Reset();
+		CachedGroundInfo.SurfaceType = EPhysicalSurface::SurfaceType_Max;
+		return CachedGroundInfo.SurfaceType;
+	}
+
+	UPhysicalMaterial* physMaterial = groundHit.PhysMaterial.Get();
+	if (!physMaterial && groundComp == SurfaceCacheComponent.Get() && FVector::DistSquared2D(groundHit.ImpactPoint, SurfaceCacheLocation) < FMath::Square(SurfaceCacheDistance)) {
+		if (!bTraced) {
+			INC_DWORD_STAT(STAT_ACFGroundTracesSaved);
+		}
+		return CachedGroundInfo.SurfaceType;
+	}
+
+	if (physMaterial) {
+		if (!bTraced) {
+			INC_DWORD_STAT(STAT_ACFGroundTracesSaved);
+		}
+	} else {
+		// the floor sweep does not return materials, trace only the component we are standing on
+		INC_DWORD_STAT(STAT_ACFGroundTracesPerformed);
+		FCollisionQueryParams queryParams(SCENE_QUERY_STAT(ACFCharacterMovementComponent_GetGroundSurface), true, CharacterOwner);
+		queryParams.bReturnPhysicalMaterial = true;
+
+		const FVector traceStart = groundHit.ImpactPoint + FVector(0.f, 0.f, 10.f);
+		const FVector traceEnd = groundHit.ImpactPoint - FVector(0.f, 0.f, 10.f);
+		FHitResult surfaceHit;
+		if (groundComp->LineTraceComponent(surfaceHit, traceStart, traceEnd, queryParams)) {
+			physMaterial = surfaceHit.PhysMaterial.Get();
+		}
+	}
+
+	SurfaceCacheComponent = groundComp;
+	SurfaceCacheLocation = groundHit.ImpactPoint;
+	CachedGroundInfo.PhysicalMaterial = physMaterial;
+	CachedGroundInfo.SurfaceType = physMaterial ? physMaterial->SurfaceType.GetValue() : EPhysicalSurface::SurfaceType_Default;
+	return CachedGroundInfo.SurfaceType;
+}
+
 
 void UACFCharacterMovementComponent::SetLocomotionState_Implementation(ELocomotionState State)
 {
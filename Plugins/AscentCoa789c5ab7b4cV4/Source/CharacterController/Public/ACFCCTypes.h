@@ -4,6 +4,7 @@
 
 #include "ARSTypes.h"
 #include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
 #include "Engine/HitResult.h"
 #include <Engine/DataTable.h>
 #include <GameplayTagContainer.h>
@@ -11,6 +12,8 @@
 
 #include "ACFCCTypes.generated.h"
 
+class UPhysicalMaterial;
+
 /**
  *
  */
@@ -70,25 +73,42 @@ struct FCharacterGroundInfo {
 
     FCharacterGroundInfo()
         : LastUpdateFrame(0)
+        , SurfaceUpdateFrame(0)
         , GroundDistance(0.0f)
+        , GroundNormal(FVector::UpVector)
         , SlopePitch(0.0f)
         , SlopeRoll(0.0f)
+        , SurfaceType(EPhysicalSurface::SurfaceType_Max)
     {
     }
 
     uint64 LastUpdateFrame;
 
+    uint64 SurfaceUpdateFrame;
+
     UPROPERTY(BlueprintReadOnly, Category = ACF)
     FHitResult GroundHitResult;
 
     UPROPERTY(BlueprintReadOnly, Category = ACF)
     float GroundDistance;
 
+    UPROPERTY(BlueprintReadOnly, Category = ACF)
+    FVector GroundNormal;
+
     UPROPERTY(BlueprintReadOnly, Category = ACF)
     float SlopePitch;
 
     UPROPERTY(BlueprintReadOnly, Category = ACF)
     float SlopeRoll;
+
+    /**
+     * Surface under the character, only up to date after GetGroundSurfaceType has been called in the frame.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = ACF)
+    TEnumAsByte<EPhysicalSurface> SurfaceType;
+
+    UPROPERTY(BlueprintReadOnly, Category = ACF)
+    TWeakObjectPtr<UPhysicalMaterial> PhysicalMaterial;
 };
 
 USTRUCT(BlueprintType)
@@ -8,6 +8,7 @@
 #include "Animation/AnimInstance.h"
 #include "CoreMinimal.h"
 #include <GameplayTagContainer.h>
+#include <atomic>
 
 #include "ACFAnimInstance.generated.h"
 
@@ -171,6 +172,28 @@ public:
 
     virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
 
+    virtual void NativeUninitializeAnimation() override;
+
+    /**
+     * * Average milliseconds spent in the native update of this instance.
+     */
+    UFUNCTION(BlueprintPure, Category = "ACF|Animation Budget")
+    float GetAverageUpdateCostMs() const { return AverageUpdateCostMs.load(std::memory_order_relaxed); }
+
+    /**
+     * * Milliseconds spent in the last native update of this instance.
+     */
+    UFUNCTION(BlueprintPure, Category = "ACF|Animation Budget")
+    float GetLastUpdateCostMs() const { return LastUpdateCostMs.load(std::memory_order_relaxed); }
+
+    /**
+     * * Number of frames between two updates of this instance, assigned by the animation budget.
+     */
+    UFUNCTION(BlueprintPure, Category = "ACF|Animation Budget")
+    int32 GetBudgetUpdateInterval() const { return BudgetUpdateInterval; }
+
+    void SetBudgetUpdateInterval(int32 interval) { BudgetUpdateInterval = interval; }
+
 protected:
     // ----- CONFIG ---- //
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ACF|Config")
@@ -247,6 +270,20 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ACF|Updates")
     bool bUpdateLeaningData = true;
 
+    /**
+     * * Registers this instance to the shared animation budget: distant or occluded characters
+     * * update less often and their skipped frames are interpolated.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ACF|Animation Budget")
+    bool bUseAnimationBudget = true;
+
+    /**
+     * * AI characters that are not aiming skip the aim offset update, their aim offset is blended back to zero.
+     * * Throttled AI characters also skip the leaning update.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ACF|Animation Budget")
+    bool bSkipIdleAISubUpdates = true;
+
     UPROPERTY(BlueprintReadOnly, Category = ACF)
     bool bCanUseAdditive = false;
 
@@ -373,6 +410,15 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "ACF|Jump")
     float GroundDistance = -1.0f;
 
+    UPROPERTY(BlueprintReadOnly, Category = "ACF|Ground")
+    FVector GroundNormal = FVector::UpVector;
+
+    UPROPERTY(BlueprintReadOnly, Category = "ACF|Ground")
+    float GroundSlopePitch = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "ACF|Ground")
+    float GroundSlopeRoll = 0.f;
+
     UPROPERTY(BlueprintReadOnly, Category = "ACF|Jump")
     float TimeToApex = 0.f;
 
@@ -430,6 +476,12 @@ protected:
 private:
     void SetReferences();
 
+    // written by the anim worker thread, read by the animation budget on the game thread
+    std::atomic<float> AverageUpdateCostMs { 0.f };
+    std::atomic<float> LastUpdateCostMs { 0.f };
+    int32 BudgetUpdateInterval = 1;
+    bool bRegisteredToBudget = false;
+
     void UpdateLeaning(float deltatime);
     void UpdateLocation(float deltatime);
     void UpdateRotation(float deltatime);
@@ -0,0 +1,110 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "ACFAnimationBudgetSubsystem.generated.h"
+
+class UACFAnimInstance;
+
+/**
+ * * Shared animation budget of ACF characters.
+ *
+ * Every frame the registered anim instances are sorted by significance (distance to the closest view,
+ * whether they were rendered recently) and given an update interval so that the estimated cost of all
+ * of them stays under BudgetMs. Intervals are applied to the skeletal mesh through the external tick
+ * rate of the engine update rate optimizations, so skipped frames are interpolated and linked layers
+ * (movesets, overlays, riders) are throttled together with their main instance.
+ * Local players always update every frame. On a dedicated server only the distance to the players is used.
+ */
+UCLASS(config = Game)
+class CHARACTERCONTROLLER_API UACFAnimationBudgetSubsystem : public UTickableWorldSubsystem {
+    GENERATED_BODY()
+
+public:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    void RegisterAnimInstance(UACFAnimInstance* animInstance);
+    void UnregisterAnimInstance(UACFAnimInstance* animInstance);
+
+    /**
+     * * Estimated milliseconds spent by the registered anim instances during the last frame.
+     */
+    UFUNCTION(BlueprintPure, Category = "ACF|Animation Budget")
+    float GetEstimatedCostMs() const { return EstimatedCostMs; }
+
+    UFUNCTION(BlueprintPure, Category = "ACF|Animation Budget")
+    int32 GetNumRegisteredInstances() const { return Instances.Num(); }
+
+    /**
+     * * Number of registered anim instances currently updating less than every frame.
+     */
+    UFUNCTION(BlueprintPure, Category = "ACF|Animation Budget")
+    int32 GetNumThrottledInstances() const { return NumThrottled; }
+
+protected:
+    /**
+     * * Milliseconds per frame the registered anim instances should cost in total.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "ACF|Animation Budget")
+    float BudgetMs = 1.5f;
+
+    /**
+     * * Estimated cost of the anim graph of an instance on top of its measured native update.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "ACF|Animation Budget")
+    float EstimatedGraphCostMs = 0.05f;
+
+    /**
+     * * Characters closer than this to a view always update every frame while rendered.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "ACF|Animation Budget")
+    float FullRateDistance = 1500.f;
+
+    /**
+     * * Beyond this distance characters update at most every MaxUpdateInterval frames.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "ACF|Animation Budget")
+    float MaxRateDistance = 8000.f;
+
+    /**
+     * * Update interval of characters that were not rendered recently.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "ACF|Animation Budget", meta = (ClampMin = 1))
+    int32 OccludedUpdateInterval = 4;
+
+    UPROPERTY(config, EditAnywhere, Category = "ACF|Animation Budget", meta = (ClampMin = 1, ClampMax = 32))
+    int32 MaxUpdateInterval = 8;
+
+    /**
+     * * Whether skipped frames are interpolated instead of holding the last pose.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "ACF|Animation Budget")
+    bool bInterpolateSkippedFrames = true;
+
+private:
+    struct FBudgetedInstance {
+        TWeakObjectPtr<UACFAnimInstance> AnimInstance;
+        float Significance = 0.f;
+        float CostMs = 0.f;
+        int32 MinInterval = 1;
+        int32 Interval = 1;
+        // value of the mesh before registration, restored when the instance leaves the budget
+        bool bMeshUpdateRateOptimizations = false;
+    };
+
+    void ApplyInterval(UACFAnimInstance* animInstance, int32 interval) const;
+
+    void RestoreMesh(const FBudgetedInstance& instance) const;
+
+    TArray<FBudgetedInstance> Instances;
+    TArray<FVector> ViewLocations;
+
+    float EstimatedCostMs = 0.f;
+    int32 NumThrottled = 0;
+};
@@ -228,6 +228,15 @@ public:
 	UFUNCTION(BlueprintPure, Category = ACF)
 	const float GetGroundDistance();
 
+	/**
+	 * Returns the physical surface under the character, the only surface cache shared by animations and effects.
+	 * Reuses the floor found by the movement and, while standing on the same component, the surface found
+	 * on previous frames. Otherwise only the ground component is traced.
+	 * @return The surface type, or SurfaceType_Max if there is no ground within SurfaceTraceDistance.
+	 */
+	UFUNCTION(BlueprintPure, Category = ACF)
+	TEnumAsByte<EPhysicalSurface> GetGroundSurfaceType();
+
 	/**
 	 * Returns the current yaw rotation rate.
 	 * @return Character's yaw rotation speed.
@@ -384,6 +393,14 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "ACF|Movement")
 	float GroundTraceDistance = 3000.f;
 
+	/*Maximum ground distance at which a surface is returned by GetGroundSurfaceType*/
+	UPROPERTY(EditDefaultsOnly, Category = "ACF|Movement")
+	float SurfaceTraceDistance = 120.f;
+
+	/*While standing on the same component, the surface is only looked up again after moving this distance*/
+	UPROPERTY(EditDefaultsOnly, Category = "ACF|Movement")
+	float SurfaceCacheDistance = 150.f;
+
 	UPROPERTY(Replicated)
 	float CharacterMaxSpeed;
 
@@ -453,6 +470,12 @@ protected:
 
 	FCharacterGroundInfo CachedGroundInfo;
 
+	/*Refreshes CachedGroundInfo, returns true if the ground had to be traced*/
+	bool UpdateGroundInfo();
+
+	TWeakObjectPtr<const UPrimitiveComponent> SurfaceCacheComponent;
+	FVector SurfaceCacheLocation = FVector::ZeroVector;
+
 	UPROPERTY(Transient)
 	bool bHasReplicatedAcceleration = false;
 
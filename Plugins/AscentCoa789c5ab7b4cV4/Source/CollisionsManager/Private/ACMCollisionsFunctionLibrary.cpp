@@ -81,17 +81,25 @@ FAttachedComponents UACMCollisionsFunctionLibrary::SpawnSoundAndParticleAttached
 
 void UACMCollisionsFunctionLibrary::SpawnSoundAndParticleAtLocation(const AActor* Target, const FImpactFX& effect)
 {
+    // Impacts and footsteps are fired in bursts, cull the ones nobody can see or hear
+    const AGameStateBase* gameState = UGameplayStatics::GetGameState(Target);
+    UACMEffectsDispatcherComponent* effectDips = gameState ? gameState->FindComponentByClass<UACMEffectsDispatcherComponent>() : nullptr;
+    if (effectDips && !effectDips->TryConsumeFXBudget(effect.SpawnLocation.GetLocation())) {
+        return;
+    }
+
+    // Components are taken from the world pools and one-shot sounds don't need one at all
     if (effect.ActionParticle) {
         UGameplayStatics::SpawnEmitterAtLocation(Target, effect.ActionParticle, effect.SpawnLocation.GetLocation(),
-            effect.SpawnLocation.GetRotation().Rotator(), effect.SpawnLocation.GetScale3D());
+            effect.SpawnLocation.GetRotation().Rotator(), effect.SpawnLocation.GetScale3D(), true, EPSCPoolMethod::AutoRelease);
     }
 
     if (effect.ActionSound) {
-        UGameplayStatics::SpawnSoundAtLocation(Target, effect.ActionSound, effect.SpawnLocation.GetLocation());
+        UGameplayStatics::PlaySoundAtLocation(Target, effect.ActionSound, effect.SpawnLocation.GetLocation());
     }
 
     if (effect.NiagaraParticle) {
         UNiagaraFunctionLibrary::SpawnSystemAtLocation(Target, effect.NiagaraParticle, effect.SpawnLocation.GetLocation(),
-            effect.SpawnLocation.GetRotation().Rotator(), effect.SpawnLocation.GetScale3D());
+            effect.SpawnLocation.GetRotation().Rotator(), effect.SpawnLocation.GetScale3D(), true, true, ENCPoolMethod::AutoRelease);
     }
 }
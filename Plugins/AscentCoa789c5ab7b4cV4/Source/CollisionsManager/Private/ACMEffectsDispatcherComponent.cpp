@@ -16,6 +16,8 @@
 #include <AbilitySystemComponent.h>
 #include <Logging.h>
 #include "ACMCollisionsFunctionLibrary.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
 
 
 // Sets default values for this component's properties
@@ -84,6 +86,69 @@ bool UACMEffectsDispatcherComponent::TryGetImpactFX(const TSubclassOf<class UDam
     return false;
 }
 
+bool UACMEffectsDispatcherComponent::IsInFXRelevancyRange(const FVector& location)
+{
+    if (MaxFXDistance <= 0.f) {
+        return true;
+    }
+
+    UpdateViewLocations();
+    const float maxDistanceSquared = FMath::Square(MaxFXDistance);
+    for (const FVector& viewLocation : ViewLocations) {
+        if (FVector::DistSquared(viewLocation, location) <= maxDistanceSquared) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool UACMEffectsDispatcherComponent::TryConsumeFXBudget(const FVector& location)
+{
+    if (GetNetMode() == NM_DedicatedServer) {
+        return false;
+    }
+
+    if (BudgetFrame != GFrameCounter) {
+        BudgetFrame = GFrameCounter;
+        FXSpawnedThisFrame = 0;
+    }
+
+    if (MaxFXPerFrame > 0 && FXSpawnedThisFrame >= MaxFXPerFrame) {
+        return false;
+    }
+
+    if (!IsInFXRelevancyRange(location)) {
+        return false;
+    }
+
+    FXSpawnedThisFrame++;
+    return true;
+}
+
+void UACMEffectsDispatcherComponent::UpdateViewLocations()
+{
+    if (ViewLocationsFrame == GFrameCounter) {
+        return;
+    }
+    ViewLocationsFrame = GFrameCounter;
+    ViewLocations.Reset();
+
+    const UWorld* world = GetWorld();
+    if (!world) {
+        return;
+    }
+
+    for (FConstPlayerControllerIterator it = world->GetPlayerControllerIterator(); it; ++it) {
+        const APlayerController* controller = it->Get();
+        if (controller && controller->IsLocalController()) {
+            FVector viewLocation;
+            FRotator viewRotation;
+            controller->GetPlayerViewPoint(viewLocation, viewRotation);
+            ViewLocations.Add(viewLocation);
+        }
+    }
+}
+
 void UACMEffectsDispatcherComponent::Internal_PlayEffect(class ACharacter* instigator, const FActionEffect& effect)
 {
     if (instigator) {
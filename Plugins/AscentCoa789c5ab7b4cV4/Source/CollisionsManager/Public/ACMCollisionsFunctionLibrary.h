@@ -71,6 +71,8 @@ public:
 
     /**
      * Spawns a sound and particle system at the target actor's location.
+     * Particle components are taken from the world pools. The FX is dropped if it is out of the
+     * relevancy range or over the frame budget of the effects dispatcher.
      *
      * @param Target The actor whose location will be used.
      * @param effect The effect to spawn.
@@ -32,6 +32,24 @@ public:
     UFUNCTION(BlueprintCallable, Category = ACM)
     bool TryGetImpactFX(const TSubclassOf<class UDamageType>& damageImpacting, class UPhysicalMaterial* materialImpacted, FBaseFX& outFXtoPlay) const;
 
+    /**
+     * Returns true if a local FX at the provided location is close enough to a local viewer to be worth spawning.
+     * Does not consume the FX budget, useful to skip any work needed to select the FX.
+     *
+     * @param location The world-space location of the FX.
+     */
+    UFUNCTION(BlueprintCallable, Category = ACM)
+    bool IsInFXRelevancyRange(const FVector& location);
+
+    /**
+     * Returns true if a local FX at the provided location should be spawned, consuming one slot
+     * of the per frame budget. FXs are never spawned on dedicated servers.
+     *
+     * @param location The world-space location of the FX.
+     */
+    UFUNCTION(BlueprintCallable, Category = ACM)
+    bool TryConsumeFXBudget(const FVector& location);
+
 protected:
     // Called when the game starts
     virtual void BeginPlay() override;
@@ -42,10 +60,25 @@ protected:
     UPROPERTY(EditDefaultsOnly, Category = ACM)
     FGameplayTag DefaultImpactCue;
 
+    /*Local impact and footstep FXs farther than this from every local viewer are not spawned. 0 disables the culling*/
+    UPROPERTY(EditDefaultsOnly, Category = "ACM|Budget")
+    float MaxFXDistance = 6000.f;
+
+    /*Max number of local impact and footstep FXs spawned in a single frame, the exceeding ones are dropped. 0 means no limit*/
+    UPROPERTY(EditDefaultsOnly, Category = "ACM|Budget")
+    int32 MaxFXPerFrame = 24;
+
 private:
+    void UpdateViewLocations();
+
     void Internal_PlayEffect(class ACharacter* instigator, const FActionEffect& effect);
 
     UFUNCTION(NetMulticast, Reliable, Category = ACM)
     void ClientsPlayEffect(const FActionEffect& effect, class ACharacter* instigator);
 
+    TArray<FVector> ViewLocations;
+    uint64 ViewLocationsFrame = MAX_uint64;
+    uint64 BudgetFrame = MAX_uint64;
+    int32 FXSpawnedThisFrame = 0;
+
 };
@@ -8,8 +8,9 @@
 #include "Components/ACFCurrencyComponent.h"
 #include "Components/ACFEquipmentComponent.h"
 #include "Components/ACFInventoryComponent.h"
+#include "Engine/AssetManager.h"
 #include "Engine/DataTable.h"
-#include "GameplayTagsManager.h"
+#include "Engine/StreamableManager.h"
 #include "Items/ACFItem.h"
 #include "Kismet/KismetMathLibrary.h"
 #include <GameFramework/Pawn.h>
@@ -28,6 +29,68 @@ UACFItemsManagerComponent::UACFItemsManagerComponent()
 void UACFItemsManagerComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	RefreshItemsIndex();
+}
+
+void UACFItemsManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	for (const TSharedPtr<FStreamableHandle>& handle : PreloadHandles) {
+		if (handle.IsValid()) {
+			handle->ReleaseHandle();
+		}
+	}
+	PreloadHandles.Empty();
+	LootTable.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UACFItemsManagerComponent::RefreshItemsIndex()
+{
+	LootTable.Build(GetItemsDB());
+}
+
+FACFLootTable& UACFItemsManagerComponent::GetLootTable()
+{
+	if (!LootTable.IsBuiltFor(GetItemsDB())) {
+		RefreshItemsIndex();
+	}
+	return LootTable;
+}
+
+void UACFItemsManagerComponent::PreloadItemsForRules(const TArray<FACFItemGenerationRule>& generationRules)
+{
+	if (!GetItemsDB()) {
+		return;
+	}
+
+	FACFLootTable& lootTable = GetLootTable();
+	for (const FACFItemGenerationRule& genRule : generationRules) {
+		PreloadRuleEntries(lootTable.FindOrAddRule(genRule));
+	}
+}
+
+void UACFItemsManagerComponent::PreloadRuleEntries(FACFLootTable::FRuleEntries& entries)
+{
+	if (entries.bPreloadRequested) {
+		return;
+	}
+	entries.bPreloadRequested = true;
+
+	// entries are sorted by weight, so the first ones are the most likely drops
+	const int32 maxItems = MaxPreloadedItemsPerRule > 0 ? FMath::Min(MaxPreloadedItemsPerRule, entries.Num()) : entries.Num();
+	TArray<FSoftObjectPath> assetsToLoad;
+	for (int32 index = 0; index < maxItems; index++) {
+		const FItemGenerationSlot* itemSlot = LootTable.FindSlot(entries.Slots[index]);
+		if (itemSlot && !itemSlot->ItemClass.IsNull() && !itemSlot->ItemClass.Get()) {
+			assetsToLoad.AddUnique(itemSlot->ItemClass.ToSoftObjectPath());
+		}
+	}
+
+	if (assetsToLoad.Num() > 0) {
+		PreloadHandles.Add(UAssetManager::GetStreamableManager().RequestAsyncLoad(assetsToLoad, FStreamableDelegate(), FStreamableManager::DefaultAsyncLoadPriority));
+	}
 }
 
 bool UACFItemsManagerComponent::GenerateItemsFromRules(const TArray<FACFItemGenerationRule>& generationRules, TArray<FBaseItem>& outItems)
@@ -54,30 +117,26 @@ bool UACFItemsManagerComponent::GenerateItemsFromRules(const TArray<FACFItemGene
 
 bool UACFItemsManagerComponent::GenerateItemFromRule(const FACFItemGenerationRule& generationRules, FBaseItem& outItem)
 {
-	TArray<FItemGenerationSlot> matchingItems;
 	if (GetItemsDB()) {
-		const auto items = GetItemsDB()->GetRowMap();
-		for (const auto itemItr : items) {
-			FItemGenerationSlot* itemSlot = (FItemGenerationSlot*)itemItr.Value;
-			if (itemSlot) {
-				if (DoesSlotMatchesRule(generationRules, *itemSlot)) {
-					matchingItems.Add(*itemSlot);
-				}
-			}
-			else {
-				return false;
-			}
-		}
+		FACFLootTable& lootTable = GetLootTable();
+		FACFLootTable::FRuleEntries& matchingItems = lootTable.FindOrAddRule(generationRules);
 
 		if (matchingItems.Num() == 0) {
 			UE_LOG(LogTemp, Warning, TEXT("No Matching Items in DB! - UACFItemsManagerComponent"));
 			return false;
 		}
 
-		const int32 selectedSlot = FMath::RandRange(0, matchingItems.Num() - 1);
+		if (bPreloadGeneratedItems) {
+			PreloadRuleEntries(matchingItems);
+		}
+
+		const int32 selectedSlot = lootTable.PickSlot(matchingItems);
 		const int32 selectedCount = FMath::RandRange(generationRules.MinItemCount, generationRules.MaxItemCount);
-		if (matchingItems.IsValidIndex(selectedSlot) && selectedCount > 0) {
-			const TSubclassOf<UACFItem> ItemClass = matchingItems[selectedSlot].ItemClass.LoadSynchronous();
+		const FItemGenerationSlot* itemSlot = lootTable.FindSlot(selectedSlot);
+		if (itemSlot && selectedCount > 0) {
+			// only hits the disk if the preload has not completed yet
+			const TSoftClassPtr<UACFItem>& softItemClass = itemSlot->ItemClass;
+			const TSubclassOf<UACFItem> ItemClass = softItemClass.Get() ? softItemClass.Get() : softItemClass.LoadSynchronous();
 			if (ItemClass) {
 				outItem = FBaseItem(ItemClass, selectedCount);
 				return true;
@@ -92,9 +151,7 @@ bool UACFItemsManagerComponent::GenerateItemFromRule(const FACFItemGenerationRul
 
 bool UACFItemsManagerComponent::DoesSlotMatchesRule(const FACFItemGenerationRule& generationRules, const FItemGenerationSlot& item)
 {
-	return (
-		(item.Category == generationRules.Category || UGameplayTagsManager::Get().RequestGameplayTagChildren(generationRules.Category).HasTag(item.Category))
-		&& (item.Rarity == generationRules.Rarity || UGameplayTagsManager::Get().RequestGameplayTagChildren(generationRules.Rarity).HasTag(item.Rarity)));
+	return FACFLootTable::DoesSlotMatchRule(generationRules, item);
 }
 
 
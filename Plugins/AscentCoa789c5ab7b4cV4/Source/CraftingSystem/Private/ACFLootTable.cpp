@@ -0,0 +1,185 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ACFLootTable.h"
+#include "Engine/DataTable.h"
+#include "GameplayTagsManager.h"
+#include "Math/RandomStream.h"
+
+FACFLootTable::~FACFLootTable()
+{
+    Reset();
+}
+
+void FACFLootTable::Build(UDataTable* itemsDB)
+{
+    Reset();
+    if (!itemsDB) {
+        return;
+    }
+
+    SourceTable = itemsDB;
+    SourceNumRows = itemsDB->GetRowMap().Num();
+    TableChangedHandle = itemsDB->OnDataTableChanged().AddRaw(this, &FACFLootTable::HandleTableChanged);
+    SlotRows.Reserve(SourceNumRows);
+    SlotWeights.Reserve(SourceNumRows);
+
+    TMap<TPair<FGameplayTag, FGameplayTag>, int32> bucketIndices;
+    for (const auto& itemItr : itemsDB->GetRowMap()) {
+        const FItemGenerationSlot* itemSlot = reinterpret_cast<const FItemGenerationSlot*>(itemItr.Value);
+        if (!itemSlot) {
+            continue;
+        }
+
+        const int32 slotIndex = SlotRows.Add(itemItr.Key);
+        SlotWeights.Add(itemSlot->DropWeight);
+        const TPair<FGameplayTag, FGameplayTag> key(itemSlot->Category, itemSlot->Rarity);
+        int32* bucketIndex = bucketIndices.Find(key);
+        if (!bucketIndex) {
+            FBucket& bucket = Buckets.AddDefaulted_GetRef();
+            bucket.Category = itemSlot->Category;
+            bucket.Rarity = itemSlot->Rarity;
+            bucketIndex = &bucketIndices.Add(key, Buckets.Num() - 1);
+        }
+        Buckets[*bucketIndex].Slots.Add(slotIndex);
+    }
+}
+
+void FACFLootTable::Reset()
+{
+    if (UDataTable* sourceTable = SourceTable.Get()) {
+        sourceTable->OnDataTableChanged().Remove(TableChangedHandle);
+    }
+    TableChangedHandle.Reset();
+
+    SlotRows.Reset();
+    SlotWeights.Reset();
+    Buckets.Reset();
+    Rules.Reset();
+    SourceTable.Reset();
+    SourceNumRows = 0;
+    bStale = false;
+}
+
+bool FACFLootTable::IsBuiltFor(const UDataTable* itemsDB) const
+{
+    return itemsDB && !bStale && SourceTable.Get() == itemsDB && SourceNumRows == itemsDB->GetRowMap().Num();
+}
+
+void FACFLootTable::HandleTableChanged()
+{
+    // rebuilt by the owner on the next roll, the table may still be in the middle of the change
+    bStale = true;
+}
+
+const FItemGenerationSlot* FACFLootTable::FindSlot(int32 slotIndex) const
+{
+    const UDataTable* sourceTable = SourceTable.Get();
+    if (!sourceTable || !SlotRows.IsValidIndex(slotIndex)) {
+        return nullptr;
+    }
+    return reinterpret_cast<const FItemGenerationSlot*>(sourceTable->FindRowUnchecked(SlotRows[slotIndex]));
+}
+
+FACFLootTable::FRuleEntries& FACFLootTable::FindOrAddRule(const FACFItemGenerationRule& rule)
+{
+    const TPair<FGameplayTag, FGameplayTag> key(rule.Category, rule.Rarity);
+    if (FRuleEntries* found = Rules.Find(key)) {
+        return *found;
+    }
+
+    FRuleEntries& entries = Rules.Add(key);
+
+    // every slot of a bucket shares the same tags, so matching a single slot per bucket is enough
+    for (const FBucket& bucket : Buckets) {
+        if (DoTagsMatchRule(rule, bucket.Category, bucket.Rarity)) {
+            for (const int32 slotIndex : bucket.Slots) {
+                if (SlotWeights[slotIndex] > 0.f) {
+                    entries.Slots.Add(slotIndex);
+                }
+            }
+        }
+    }
+
+    entries.Slots.StableSort([this](const int32 A, const int32 B) {
+        return SlotWeights[A] > SlotWeights[B];
+    });
+    BuildAliasTable(entries);
+    return entries;
+}
+
+int32 FACFLootTable::PickSlot(const FRuleEntries& entries, const FRandomStream* stream) const
+{
+    const int32 num = entries.Num();
+    if (num == 0) {
+        return INDEX_NONE;
+    }
+
+    const int32 column = stream ? stream->RandRange(0, num - 1) : FMath::RandRange(0, num - 1);
+    const float coin = stream ? stream->GetFraction() : FMath::FRand();
+    return coin < entries.Probabilities[column] ? entries.Slots[column] : entries.Slots[entries.Aliases[column]];
+}
+
+bool FACFLootTable::DoesSlotMatchRule(const FACFItemGenerationRule& rule, const FItemGenerationSlot& slot)
+{
+    return DoTagsMatchRule(rule, slot.Category, slot.Rarity);
+}
+
+bool FACFLootTable::DoTagsMatchRule(const FACFItemGenerationRule& rule, const FGameplayTag& category, const FGameplayTag& rarity)
+{
+    return (
+        (category == rule.Category || UGameplayTagsManager::Get().RequestGameplayTagChildren(rule.Category).HasTag(category))
+        && (rarity == rule.Rarity || UGameplayTagsManager::Get().RequestGameplayTagChildren(rule.Rarity).HasTag(rarity)));
+}
+
+void FACFLootTable::BuildAliasTable(FRuleEntries& entries) const
+{
+    const int32 num = entries.Num();
+    entries.Probabilities.Init(1.f, num);
+    entries.Aliases.Init(0, num);
+    if (num == 0) {
+        return;
+    }
+
+    double totalWeight = 0.0;
+    for (const int32 slotIndex : entries.Slots) {
+        totalWeight += SlotWeights[slotIndex];
+    }
+
+    TArray<double> scaled;
+    scaled.SetNumUninitialized(num);
+    TArray<int32> small;
+    TArray<int32> large;
+    for (int32 index = 0; index < num; index++) {
+        scaled[index] = SlotWeights[entries.Slots[index]] * num / totalWeight;
+        if (scaled[index] < 1.0) {
+            small.Add(index);
+        } else {
+            large.Add(index);
+        }
+    }
+
+    while (small.Num() > 0 && large.Num() > 0) {
+        const int32 less = small.Pop();
+        const int32 more = large.Pop();
+
+        entries.Probabilities[less] = scaled[less];
+        entries.Aliases[less] = more;
+
+        scaled[more] = (scaled[more] + scaled[less]) - 1.0;
+        if (scaled[more] < 1.0) {
+            small.Add(more);
+        } else {
+            large.Add(more);
+        }
+    }
+
+    // leftovers are only due to rounding errors and always keep their own column
+    for (const int32 index : large) {
+        entries.Probabilities[index] = 1.f;
+        entries.Aliases[index] = index;
+    }
+    for (const int32 index : small) {
+        entries.Probabilities[index] = 1.f;
+        entries.Aliases[index] = index;
+    }
+}
@@ -4,6 +4,7 @@
 
 #include "ACFCraftRecipeDataAsset.h"
 #include "ACFItemTypes.h"
+#include "ACFLootTable.h"
 #include "Components/ACFEquipmentComponent.h"
 #include "Components/ACFInventoryComponent.h"
 #include "Components/ActorComponent.h"
@@ -14,6 +15,7 @@
 #include "ACFItemsManagerComponent.generated.h"
 
 struct FInventoryItem;
+struct FStreamableHandle;
 class UACFVendorComponent;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnItemCrafted, const FACFCraftingRecipe&, recipe);
@@ -40,9 +42,21 @@ protected:
     // Called when the game starts
     virtual void BeginPlay() override;
 
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, meta = (RowType = "ItemGenerationSlot"), Category = ACF)
     UDataTable* ItemsDB;
 
+    /*If true, the first time a generation rule is used the item classes it is most likely to
+    generate are loaded asynchronously, so that following rolls don't hitch on a synchronous load*/
+    UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = ACF)
+    bool bPreloadGeneratedItems = true;
+
+    /*Max amount of item classes preloaded for every generation rule, picked from the highest
+    DropWeight. 0 preloads every matching item*/
+    UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, meta = (EditCondition = "bPreloadGeneratedItems", ClampMin = 0), Category = ACF)
+    int32 MaxPreloadedItemsPerRule = 16;
+
 public:
     /*------------------- SERVER SIDE -----------------------------------*/
 
@@ -131,6 +145,15 @@ public:
     UFUNCTION(BlueprintCallable, Category = ACF)
     bool DoesSlotMatchesRule(const FACFItemGenerationRule& generationRules, const FItemGenerationSlot& item);
 
+    /* Asynchronously loads the item classes the provided rules are most likely to generate.
+    Call it ahead of a loot roll (ie: when a lootable enemy spawns) to avoid synchronous loads*/
+    UFUNCTION(BlueprintCallable, Category = ACF)
+    void PreloadItemsForRules(const TArray<FACFItemGenerationRule>& generationRules);
+
+    /* Rebuilds the ItemsDB index used by item generation. Call it after modifying the ItemsDB at runtime*/
+    UFUNCTION(BlueprintCallable, Category = ACF)
+    void RefreshItemsIndex();
+
     void BuyItemsFromVendor(UACFVendorComponent* vendorComp, const FInventoryItem& item, UACFEquipmentComponent* equipComp);
 
     /**
@@ -156,4 +179,13 @@ public:
      */
     UPROPERTY(BlueprintAssignable, Category = ACF)
     FOnItemUpgraded OnItemUpgraded;
+
+private:
+    FACFLootTable& GetLootTable();
+
+    void PreloadRuleEntries(FACFLootTable::FRuleEntries& entries);
+
+    FACFLootTable LootTable;
+
+    TArray<TSharedPtr<FStreamableHandle>> PreloadHandles;
 };
@@ -0,0 +1,101 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "ACFItemTypes.h"
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+class UDataTable;
+struct FRandomStream;
+
+/**
+ * Index over an items generation DataTable used to roll loot without scanning the table.
+ *
+ * Rows are bucketed by their exact (Category, Rarity) pair when the table is built. The first time
+ * a rule is rolled, only the buckets are matched against it and the matching rows are flattened in
+ * a compact index array with an alias table, so every following roll of that rule is O(1)
+ * regardless of the size of the table.
+ *
+ * Only row names and weights are cached: the picked row is resolved from the table on every roll,
+ * and the index is flagged as stale whenever the table broadcasts a change.
+ */
+class CRAFTINGSYSTEM_API FACFLootTable {
+public:
+    struct FRuleEntries {
+        // indices of the matching slots, sorted from the most to the least likely
+        TArray<int32> Slots;
+
+        // Vose alias table over Slots
+        TArray<float> Probabilities;
+        TArray<int32> Aliases;
+
+        bool bPreloadRequested = false;
+
+        int32 Num() const { return Slots.Num(); }
+    };
+
+    FACFLootTable() = default;
+    FACFLootTable(const FACFLootTable&) = delete;
+    FACFLootTable& operator=(const FACFLootTable&) = delete;
+    ~FACFLootTable();
+
+    /**
+     * Indexes every row of the provided table and listens to its changes to know when the index
+     * must be rebuilt.
+     */
+    void Build(UDataTable* itemsDB);
+
+    void Reset();
+
+    /**
+     * Returns false if the index was built for another table, or if the table changed since then.
+     */
+    bool IsBuiltFor(const UDataTable* itemsDB) const;
+
+    /**
+     * Returns the entries matching the provided rule, building them on the first request.
+     */
+    FRuleEntries& FindOrAddRule(const FACFItemGenerationRule& rule);
+
+    /**
+     * Picks a weighted random slot among the rule entries.
+     * @param stream Random stream to use, FMath random functions are used if null.
+     * @return The picked slot index, or INDEX_NONE if no slot matches.
+     */
+    int32 PickSlot(const FRuleEntries& entries, const FRandomStream* stream = nullptr) const;
+
+    /**
+     * Resolves the row of the provided slot from the table.
+     * @return The row, or null if the table or the row do not exist anymore.
+     */
+    const FItemGenerationSlot* FindSlot(int32 slotIndex) const;
+
+    int32 NumSlots() const { return SlotRows.Num(); }
+    int32 NumBuckets() const { return Buckets.Num(); }
+
+    static bool DoesSlotMatchRule(const FACFItemGenerationRule& rule, const FItemGenerationSlot& slot);
+    static bool DoTagsMatchRule(const FACFItemGenerationRule& rule, const FGameplayTag& category, const FGameplayTag& rarity);
+
+private:
+    struct FBucket {
+        FGameplayTag Category;
+        FGameplayTag Rarity;
+        TArray<int32> Slots;
+    };
+
+    void BuildAliasTable(FRuleEntries& entries) const;
+
+    void HandleTableChanged();
+
+    // row names and drop weights are copied, row memory is owned by the table and moves when it changes
+    TArray<FName> SlotRows;
+    TArray<float> SlotWeights;
+    TArray<FBucket> Buckets;
+    TMap<TPair<FGameplayTag, FGameplayTag>, FRuleEntries> Rules;
+
+    TWeakObjectPtr<UDataTable> SourceTable;
+    int32 SourceNumRows = 0;
+    FDelegateHandle TableChangedHandle;
+    bool bStale = false;
+};
@@ -0,0 +1,214 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ACFProjectileSubsystem.h"
+#include "ACFInventorySettings.h"
+#include "ACFItemSystemFunctionLibrary.h"
+#include "ACFRPGFunctionLibrary.h"
+#include "ACFTeamManagerSubsystem.h"
+#include "ACMCollisionManagerComponent.h"
+#include "ACMCollisionsFunctionLibrary.h"
+#include "Interfaces/ACFEntityInterface.h"
+#include "ItemActors/ACFProjectileActor.h"
+#include "Items/ACFProjectile.h"
+#include <Components/SphereComponent.h>
+#include <Engine/DamageEvents.h>
+#include <Engine/World.h>
+#include <GameFramework/Character.h>
+#include <GameFramework/Controller.h>
+#include <GameFramework/ProjectileMovementComponent.h>
+
+bool UACFProjectileSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UACFProjectileSubsystem::Deinitialize()
+{
+    Pools.Empty();
+    SimulatedProjectiles.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UACFProjectileSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UACFProjectileSubsystem, STATGROUP_Tickables);
+}
+
+AACFProjectileActor* UACFProjectileSubsystem::AcquireProjectile(TSubclassOf<AACFProjectileActor> projectileClass, const FTransform& spawnTransform, APawn* inOwner, UACFProjectile* definition)
+{
+    if (!projectileClass || !inOwner) {
+        return nullptr;
+    }
+
+    if (FACFProjectilePool* pool = Pools.Find(projectileClass)) {
+        while (pool->FreeProjectiles.Num() > 0) {
+            AACFProjectileActor* projectile = pool->FreeProjectiles.Pop();
+            if (IsValid(projectile)) {
+                projectile->ResetFromPool(inOwner, definition, spawnTransform);
+                return projectile;
+            }
+        }
+    }
+
+    AACFProjectileActor* projectile = GetWorld()->SpawnActorDeferred<AACFProjectileActor>(projectileClass,
+        spawnTransform, inOwner, inOwner, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+    if (!projectile) {
+        return nullptr;
+    }
+
+    projectile->bPooled = true;
+    projectile->InitItemActor(inOwner, definition);
+    projectile->FinishSpawning(spawnTransform);
+    return projectile;
+}
+
+void UACFProjectileSubsystem::ReleaseProjectile(AACFProjectileActor* projectile)
+{
+    if (!IsValid(projectile)) {
+        return;
+    }
+
+    const int32 maxPooled = GetDefault<UACFInventorySettings>()->MaxPooledProjectilesPerClass;
+    FACFProjectilePool& pool = Pools.FindOrAdd(projectile->GetClass());
+    if (pool.FreeProjectiles.Num() >= maxPooled) {
+        projectile->Destroy();
+        return;
+    }
+
+    pool.FreeProjectiles.AddUnique(projectile);
+}
+
+void UACFProjectileSubsystem::LaunchSimulatedProjectile(UACFProjectile* definition, const FVector& location, const FVector& direction, APawn* instigator)
+{
+    if (!definition || !definition->ProjectileClass || !instigator) {
+        return;
+    }
+
+    // the actor class defaults describe the flight, the damage and what happens on impact
+    const AACFProjectileActor* projectileCDO = definition->ProjectileClass->GetDefaultObject<AACFProjectileActor>();
+    const UProjectileMovementComponent* moveComp = projectileCDO->ProjectileMovementComp;
+
+    FACFSimulatedProjectile& projectile = SimulatedProjectiles.AddDefaulted_GetRef();
+    projectile.Definition = definition;
+    projectile.ActorClass = definition->ProjectileClass;
+    projectile.Instigator = instigator;
+    projectile.Location = location;
+    projectile.Velocity = direction.GetSafeNormal() * (moveComp ? moveComp->InitialSpeed : 4000.f);
+    projectile.GravityZ = moveComp ? GetWorld()->GetGravityZ() * moveComp->ProjectileGravityScale : GetWorld()->GetGravityZ();
+    projectile.Radius = projectileCDO->SphereComp ? projectileCDO->SphereComp->GetScaledSphereRadius() : 4.f;
+    projectile.RemainingLifespan = projectileCDO->ProjectileLifespan;
+
+    projectile.ObjectParams.AddObjectTypesToQuery(ECC_WorldStatic);
+    projectile.ObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+    for (const TEnumAsByte<ECollisionChannel>& channel : UACFItemSystemFunctionLibrary::GetDefaultHitTraceChannels()) {
+        projectile.ObjectParams.AddObjectTypesToQuery(channel);
+    }
+
+    if (instigator->GetClass()->ImplementsInterface(UACFEntityInterface::StaticClass())) {
+        const FGameplayTag combatTeam = IACFEntityInterface::Execute_GetEntityCombatTeam(instigator);
+        if (const UACFTeamManagerSubsystem* teamSubsystem = GetWorld()->GetSubsystem<UACFTeamManagerSubsystem>()) {
+            for (const TEnumAsByte<ECollisionChannel>& channel : teamSubsystem->GetHostileCollisionChannels(combatTeam)) {
+                projectile.ObjectParams.AddObjectTypesToQuery(channel);
+            }
+        }
+    }
+}
+
+void UACFProjectileSubsystem::Tick(float DeltaTime)
+{
+    if (SimulatedProjectiles.Num() == 0) {
+        return;
+    }
+
+    UWorld* world = GetWorld();
+
+    for (int32 index = SimulatedProjectiles.Num() - 1; index >= 0; index--) {
+        FACFSimulatedProjectile& projectile = SimulatedProjectiles[index];
+
+        // sweeps are batched by the async trace system, the ones requested last frame are ready now
+        if (projectile.PendingSweep.IsValid()) {
+            FTraceDatum sweepData;
+            FHitResult syncHit;
+            const FHitResult* blockingHit = nullptr;
+            if (world->QueryTraceData(projectile.PendingSweep, sweepData)) {
+                blockingHit = sweepData.OutHits.FindByPredicate([](const FHitResult& hit) { return hit.bBlockingHit; });
+            } else if (SweepSimulatedProjectile(projectile, syncHit)) {
+                // the async result is missing, the step is swept again right away so the projectile never skips what it hits
+                blockingHit = &syncHit;
+            }
+
+            if (blockingHit) {
+                const FACFSimulatedProjectile impacted = projectile;
+                const FHitResult impactHit = *blockingHit;
+                SimulatedProjectiles.RemoveAtSwap(index);
+                HandleSimulatedImpact(impacted, impactHit);
+                continue;
+            }
+            projectile.Location = projectile.SweepEnd;
+        }
+
+        projectile.RemainingLifespan -= DeltaTime;
+        if (projectile.RemainingLifespan <= 0.f || !projectile.Instigator.IsValid()) {
+            SimulatedProjectiles.RemoveAtSwap(index);
+            continue;
+        }
+
+        projectile.Velocity.Z += projectile.GravityZ * DeltaTime;
+        projectile.SweepEnd = projectile.Location + projectile.Velocity * DeltaTime;
+
+        projectile.PendingSweep = world->AsyncSweepByObjectType(EAsyncTraceType::Single, projectile.Location, projectile.SweepEnd,
+            FQuat::Identity, projectile.ObjectParams, FCollisionShape::MakeSphere(projectile.Radius), MakeSweepParams(projectile));
+    }
+}
+
+FCollisionQueryParams UACFProjectileSubsystem::MakeSweepParams(const FACFSimulatedProjectile& projectile) const
+{
+    FCollisionQueryParams queryParams(SCENE_QUERY_STAT(ACFSimulatedProjectile), false, projectile.Instigator.Get());
+    queryParams.bReturnPhysicalMaterial = true;
+    return queryParams;
+}
+
+bool UACFProjectileSubsystem::SweepSimulatedProjectile(const FACFSimulatedProjectile& projectile, FHitResult& outHit) const
+{
+    return GetWorld()->SweepSingleByObjectType(outHit, projectile.Location, projectile.SweepEnd, FQuat::Identity,
+        projectile.ObjectParams, FCollisionShape::MakeSphere(projectile.Radius), MakeSweepParams(projectile));
+}
+
+void UACFProjectileSubsystem::HandleSimulatedImpact(const FACFSimulatedProjectile& projectile, const FHitResult& hit)
+{
+    APawn* instigator = projectile.Instigator.Get();
+    AActor* hitActor = hit.GetActor();
+    const AACFProjectileActor* projectileCDO = projectile.ActorClass->GetDefaultObject<AACFProjectileActor>();
+
+    // same damage the collision manager of the projectile actor would apply with its first trace
+    const UACMCollisionManagerComponent* collisionCDO = projectileCDO->GetCollisionComp();
+    const TMap<FName, FTraceInfo> damageTraces = collisionCDO ? collisionCDO->GetDamageTraces() : TMap<FName, FTraceInfo>();
+    if (instigator && IsValid(hitActor) && damageTraces.Num() > 0) {
+        const FTraceInfo& traceInfo = damageTraces.CreateConstIterator().Value();
+        UACMCollisionsFunctionLibrary::PlayImpactEffect(traceInfo.DamageTypeClass, hit, instigator);
+
+        const UACFTeamManagerSubsystem* teamSubsystem = GetWorld()->GetSubsystem<UACFTeamManagerSubsystem>();
+        const bool bCanDamage = hitActor != instigator && (!teamSubsystem || teamSubsystem->CanActorDamageActor(instigator, hitActor));
+        if (bCanDamage) {
+            if (traceInfo.GameplayEffect.Effect) {
+                UACFRPGFunctionLibrary::AddGameplayEffectToActor(traceInfo.GameplayEffect, hitActor);
+            }
+
+            FPointDamageEvent damageInfo;
+            damageInfo.DamageTypeClass = traceInfo.DamageTypeClass;
+            damageInfo.Damage = traceInfo.BaseDamage;
+            damageInfo.HitInfo = hit;
+            damageInfo.ShotDirection = instigator->GetActorLocation() - hitActor->GetActorLocation();
+            hitActor->TakeDamage(traceInfo.BaseDamage, damageInfo, instigator->GetController(), instigator);
+        }
+    }
+
+    // an actor is only needed if the projectile stays stuck in what it hit
+    if (instigator && projectileCDO->HitPolicy == EProjectileHitPolicy::AttachOnHit) {
+        const FTransform attachTransform(projectile.Velocity.Rotation(), hit.ImpactPoint);
+        if (AACFProjectileActor* projectileActor = AcquireProjectile(projectile.ActorClass, attachTransform, instigator, projectile.Definition)) {
+            projectileActor->AttachToHit(hit, !Cast<ACharacter>(hitActor));
+        }
+    }
+}
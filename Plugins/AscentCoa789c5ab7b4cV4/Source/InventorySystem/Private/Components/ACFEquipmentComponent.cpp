@@ -65,15 +65,69 @@ bool FEquippedItem::IsValid()
 	return Item && ItemActor && ItemActor->IsFullyInit();
 }
 
+void FEquipment::PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize)
+{
+	for (const int32 index : RemovedIndices) {
+		if (ownerComp && EquippedItems.IsValidIndex(index)) {
+			ownerComp->MarkEquipmentSlotDirty(EquippedItems[index].ItemSlot);
+		}
+	}
+	bIndicesDirty = true;
+}
+
+void FEquipment::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize)
+{
+	ValidateChanges(AddedIndices);
+}
+
+void FEquipment::PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize)
+{
+	ValidateChanges(ChangedIndices);
+}
+
 void FEquipment::ValidateChanges(const TArrayView<int32> AddedIndices)
 {
+	bIndicesDirty = true;
 	for (const int32 index : AddedIndices) {
-		if (EquippedItems.IsValidIndex(index) && !EquippedItems[index].IsValid()) {
-			EquippedItems[index].Init(ownerComp);
+		if (EquippedItems.IsValidIndex(index)) {
+			if (!EquippedItems[index].IsValid()) {
+				EquippedItems[index].Init(ownerComp);
+			}
+			if (ownerComp) {
+				ownerComp->MarkEquipmentSlotDirty(EquippedItems[index].ItemSlot);
+			}
 		}
 	}
 }
 
+const FEquippedItem* FEquipment::FindBySlot(const FGameplayTag& itemSlot) const
+{
+	RebuildIndices();
+	const int32* index = SlotIndices.Find(itemSlot);
+	return index ? &EquippedItems[*index] : nullptr;
+}
+
+const FEquippedItem* FEquipment::FindByGuid(const FGuid& itemGuid) const
+{
+	RebuildIndices();
+	const int32* index = GuidIndices.Find(itemGuid);
+	return index ? &EquippedItems[*index] : nullptr;
+}
+
+void FEquipment::RebuildIndices() const
+{
+	if (!bIndicesDirty) {
+		return;
+	}
+	SlotIndices.Reset();
+	GuidIndices.Reset();
+	for (int32 index = 0; index < EquippedItems.Num(); index++) {
+		SlotIndices.Add(EquippedItems[index].ItemSlot, index);
+		GuidIndices.Add(EquippedItems[index].ItemGuid, index);
+	}
+	bIndicesDirty = false;
+}
+
 void UACFEquipmentComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
@@ -202,10 +256,25 @@ FGameplayTag UACFEquipmentComponent::GetCurrentDesiredOverlayTag() const
 
 void UACFEquipmentComponent::OnRep_Equipment()
 {
-	RefreshEquipment();
+	if (DirtyEquipmentSlots.Num() > 0) {
+		// only the slots touched by this update
+		const TArray<FGameplayTag> dirtySlots = MoveTemp(DirtyEquipmentSlots);
+		DirtyEquipmentSlots.Reset();
+		for (const FGameplayTag& slot : dirtySlots) {
+			RefreshEquipmentSlot(slot);
+		}
+	}
+	else {
+		RefreshEquipment();
+	}
 	OnEquipmentChanged.Broadcast(Equipment);
 }
 
+void UACFEquipmentComponent::MarkEquipmentSlotDirty(const FGameplayTag& itemSlot)
+{
+	DirtyEquipmentSlots.AddUnique(itemSlot);
+}
+
 void UACFEquipmentComponent::RefreshEquipment()
 {
 	if (!CharacterOwner) {
@@ -213,25 +282,45 @@ void UACFEquipmentComponent::RefreshEquipment()
 	}
 	FillModularMeshes();
 	for (const auto& item : Equipment.GetEquippedItems()) {
-		check(item.Item) {
-			item.Item->SetItemOwner(CharacterOwner);
-		}
-		UACFEquippableItem* equippable = Cast<UACFEquippableItem>(item.Item);
-		if (equippable) {
-			AACFWeaponActor* WeaponToEquip = Cast<AACFWeaponActor>(item.ItemActor);
-			if (WeaponToEquip) {
-				if (WeaponToEquip == GetCurrentMainWeapon() || WeaponToEquip == GetCurrentOffhandWeapon()) {
-					continue;
-				}
-				else {
-					AttachWeaponOnBody(WeaponToEquip);
-				}
-			}
+		ApplyEquippedItem(item);
+	}
+}
+
+void UACFEquipmentComponent::RefreshEquipmentSlot(const FGameplayTag& itemSlot)
+{
+	if (!CharacterOwner) {
+		CharacterOwner = Cast<ACharacter>(GetOwner());
+	}
 
-			UACFArmor* ArmorToEquip = Cast<UACFArmor>(equippable);
-			if (ArmorToEquip) {
-				AddSkeletalMeshComponent(item);
+	const FEquippedItem* item = Equipment.FindBySlot(itemSlot);
+	if (item) {
+		ApplyEquippedItem(*item);
+	}
+	else if (ModularMeshes.Contains(itemSlot)) {
+		Internal_OnArmorUnequipped(itemSlot);
+	}
+}
+
+void UACFEquipmentComponent::ApplyEquippedItem(const FEquippedItem& item)
+{
+	check(item.Item) {
+		item.Item->SetItemOwner(CharacterOwner);
+	}
+	UACFEquippableItem* equippable = Cast<UACFEquippableItem>(item.Item);
+	if (equippable) {
+		AACFWeaponActor* WeaponToEquip = Cast<AACFWeaponActor>(item.ItemActor);
+		if (WeaponToEquip) {
+			if (WeaponToEquip == GetCurrentMainWeapon() || WeaponToEquip == GetCurrentOffhandWeapon()) {
+				return;
 			}
+			else {
+				AttachWeaponOnBody(WeaponToEquip);
+			}
+		}
+
+		UACFArmor* ArmorToEquip = Cast<UACFArmor>(equippable);
+		if (ArmorToEquip) {
+			AddSkeletalMeshComponent(item);
 		}
 	}
 }
@@ -264,7 +353,7 @@ bool UACFEquipmentComponent::IsSlotAvailable(const FGameplayTag& itemSlot) const
 				"UACFEquipmentComponent::IsSlotAvailable"));
 		return false;
 	}
-	return !Equipment.GetEquippedItems().Contains(itemSlot) && GetAvailableEquipmentSlot().Contains(itemSlot);
+	return !Equipment.ContainsSlot(itemSlot) && GetAvailableEquipmentSlot().Contains(itemSlot);
 }
 
 bool UACFEquipmentComponent::TryFindAvailableItemSlot(const TArray<FGameplayTag>& itemSlots, FGameplayTag& outAvailableSlot)
@@ -295,20 +384,35 @@ void UACFEquipmentComponent::OnRep_SheathedWeap()
 
 void UACFEquipmentComponent::FillModularMeshes()
 {
-	TArray<UACFArmorSlotComponent*> slots;
-	GetOwner()->GetComponents<UACFArmorSlotComponent>(slots, false);
+	GatherArmorSlotComponents();
 	ModularMeshes.Empty();
-	for (const auto& slot : slots) {
-		if (Equipment.GetEquippedItems().Contains(slot->GetSlotTag())) {
-			ModularMeshes.Add(FModularPart(slot));
-			slot->SetLeaderPoseComponent(MainCharacterMesh);
+	for (const auto& slot : ArmorSlotComponents) {
+		if (!slot.Value) {
+			continue;
+		}
+		if (Equipment.ContainsSlot(slot.Key)) {
+			ModularMeshes.Add(FModularPart(slot.Value));
+			slot.Value->SetLeaderPoseComponent(MainCharacterMesh);
 		}
 		else {
-			Internal_OnArmorUnequipped(slot->GetSlotTag());
+			Internal_OnArmorUnequipped(slot.Key);
 		}
 	}
 }
 
+void UACFEquipmentComponent::GatherArmorSlotComponents()
+{
+	if (bArmorSlotComponentsGathered) {
+		return;
+	}
+	TArray<UACFArmorSlotComponent*> slots;
+	GetOwner()->GetComponents<UACFArmorSlotComponent>(slots, false);
+	for (UACFArmorSlotComponent* slot : slots) {
+		ArmorSlotComponents.Add(slot->GetSlotTag(), slot);
+	}
+	bArmorSlotComponentsGathered = true;
+}
+
 void UACFEquipmentComponent::OnEntityOwnerDeath_Implementation()
 {
 	if (CharacterOwner && bDropItemsOnDeath) {
@@ -332,7 +436,12 @@ void UACFEquipmentComponent::OnEntityOwnerDeath_Implementation()
 							projCount.Add(FBaseItem(proj->GetClass(), 1));
 						}
 					}
-					proj->SetLifeSpan(0.2f);
+					if (proj->IsPooled()) {
+						proj->ReleaseProjectile();
+					}
+					else {
+						proj->SetLifeSpan(0.2f);
+					}
 				}
 			}
 		}
@@ -350,6 +459,8 @@ void UACFEquipmentComponent::Internal_OnArmorUnequipped(const FGameplayTag& slot
 
 	if (GetModularMesh(slot, outMesh) && outMesh.meshComp) {
 		outMesh.meshComp->ResetSlotToEmpty();
+		// the component stays in ArmorSlotComponents and is reused by the next armor in this slot
+		ModularMeshes.Remove(outMesh);
 		OnEquippedArmorChanged.Broadcast(slot);
 	}
 }
@@ -384,8 +495,8 @@ void UACFEquipmentComponent::HandleItemRemoved(const FInventoryItem& item, int32
 		}
 	}
 	else {
-		if (item.bIsEquipped && Equipment.GetEquippedItems().Contains(item.EquipmentSlot)) {
-			RefreshEquipment();
+		if (item.bIsEquipped && Equipment.ContainsSlot(item.EquipmentSlot)) {
+			RefreshEquipmentSlot(item.EquipmentSlot);
 			OnEquipmentChanged.Broadcast(Equipment);
 		}
 	}
@@ -396,7 +507,7 @@ void UACFEquipmentComponent::HandleItemAdded(const FInventoryItem& newItem, int3
 	FGameplayTag outTag;
 	FItemDescriptor itemData;
 	UACFItemSystemFunctionLibrary::GetItemData(newItem.ItemClass, itemData);
-	if (newItem.bIsEquipped && Equipment.GetEquippedItems().Contains(newItem.EquipmentSlot)) {
+	if (newItem.bIsEquipped && Equipment.ContainsSlot(newItem.EquipmentSlot)) {
 		OnEquipmentChanged.Broadcast(Equipment);
 	}
 	if (bTryToEquip) {
@@ -459,13 +570,35 @@ void UACFEquipmentComponent::AddSkeletalMeshComponent(const FEquippedItem& equip
 		return;
 	}*/
 
+	GatherArmorSlotComponents();
+	const TObjectPtr<UACFArmorSlotComponent>* pooledComp = ArmorSlotComponents.Find(equipItem.GetItemSlot());
+
 	if (GetModularMesh(equipItem.GetItemSlot(), outMesh) && outMesh.meshComp) {
 		outMesh.meshComp->InitArmor(ArmorToAdd);
 		outMesh.meshComp->AttachToComponent(MainCharacterMesh, FAttachmentTransformRules(EAttachmentRule::SnapToTarget, true));
 		outMesh.meshComp->SetLeaderPoseComponent(MainCharacterMesh);
 
 	}
+	else if (pooledComp && *pooledComp && (*pooledComp)->GetClass() == ArmorToAdd->GetArmorComponentClass()) {
+		// reuse the component left empty by the previous armor in this slot
+		UACFArmorSlotComponent* slotComp = *pooledComp;
+		slotComp->AttachToComponent(MainCharacterMesh, FAttachmentTransformRules(EAttachmentRule::SnapToTarget, true));
+		slotComp->InitArmor(ArmorToAdd);
+		slotComp->SetLeaderPoseComponent(MainCharacterMesh);
+		slotComp->bUseBoundsFromLeaderPoseComponent = true;
+
+		ModularMeshes.Add(FModularPart(slotComp));
+	}
 	else {
+		if (pooledComp && *pooledComp) {
+			// the pooled component is of another class than the one this armor needs
+			UACFArmorSlotComponent* pooledSlotComp = *pooledComp;
+			ArmorSlotComponents.Remove(equipItem.GetItemSlot());
+			pooledSlotComp->DestroyComponent();
+			// frees the slot name for the new component
+			pooledSlotComp->Rename(nullptr, nullptr, REN_DontCreateRedirectors | REN_NonTransactional);
+		}
+
 		UACFArmorSlotComponent* NewComp = NewObject<UACFArmorSlotComponent>(CharacterOwner, ArmorToAdd->GetArmorComponentClass(), equipItem.GetItemSlot().GetTagName());
 
 		NewComp->RegisterComponent();
@@ -478,6 +611,7 @@ void UACFEquipmentComponent::AddSkeletalMeshComponent(const FEquippedItem& equip
 		NewComp->bUseBoundsFromLeaderPoseComponent = true;
 
 		ModularMeshes.Add(FModularPart(NewComp));
+		ArmorSlotComponents.Add(equipItem.GetItemSlot(), NewComp);
 	}
 	OnEquippedArmorChanged.Broadcast(equipItem.GetItemSlot());
 }
@@ -656,7 +790,7 @@ void UACFEquipmentComponent::EquipItemFromInventoryInSlot_Implementation(const F
 	Equipment.AddEntry(FEquippedItem(item, selectedSlot, itemInstance, itemActor, item.ItemClass));
 	MarkItemOnInventoryAsEquipped(item.GetItemGuid(), true, selectedSlot);
 
-	RefreshEquipment();
+	RefreshEquipmentSlot(selectedSlot);
 	OnEquipmentChanged.Broadcast(Equipment);
 }
 
@@ -688,7 +822,7 @@ void UACFEquipmentComponent::RemoveItemFromEquipment(const FEquippedItem& equipp
 	FEquippedItem copy = Equipment.GetEquippedItems()[index];
 
 	Equipment.RemoveEntry(copy);
-	RefreshEquipment();
+	RefreshEquipmentSlot(copy.GetItemSlot());
 	OnEquipmentChanged.Broadcast(Equipment);
 }
 
@@ -709,9 +843,9 @@ FVector UACFEquipmentComponent::GetMainWeaponSocketLocation() const
 
 bool UACFEquipmentComponent::GetEquippedItemSlot(const FGameplayTag& itemSlot, FEquippedItem& outSlot) const
 {
-	if (Equipment.GetEquippedItems().Contains(itemSlot)) {
-		const int32 index = Equipment.GetEquippedItems().IndexOfByKey(itemSlot);
-		outSlot = Equipment.GetEquippedItems()[index];
+	const FEquippedItem* equippedItem = Equipment.FindBySlot(itemSlot);
+	if (equippedItem) {
+		outSlot = *equippedItem;
 		return true;
 	}
 	return false;
@@ -719,9 +853,9 @@ bool UACFEquipmentComponent::GetEquippedItemSlot(const FGameplayTag& itemSlot, F
 
 bool UACFEquipmentComponent::GetEquippedItem(const FGuid& itemGuid, FEquippedItem& outSlot) const
 {
-	if (Equipment.GetEquippedItems().Contains(itemGuid)) {
-		const int32 index = Equipment.GetEquippedItems().IndexOfByKey(itemGuid);
-		outSlot = Equipment.GetEquippedItems()[index];
+	const FEquippedItem* equippedItem = Equipment.FindByGuid(itemGuid);
+	if (equippedItem) {
+		outSlot = *equippedItem;
 		return true;
 	}
 	return false;
@@ -739,7 +873,7 @@ bool UACFEquipmentComponent::GetModularMesh(FGameplayTag itemSlot, FModularPart&
 
 bool UACFEquipmentComponent::HasAnyItemInEquipmentSlot(FGameplayTag itemSlot) const
 {
-	return Equipment.GetEquippedItems().Contains(itemSlot);
+	return Equipment.ContainsSlot(itemSlot);
 }
 
 void UACFEquipmentComponent::UseConsumableOnActorBySlot_Implementation(FGameplayTag itemSlot, ACharacter* target)
@@ -2,6 +2,7 @@
 
 #include "Components/ACFShootingComponent.h"
 #include "ACFItemSystemFunctionLibrary.h"
+#include "ACFProjectileSubsystem.h"
 #include "ACMCollisionManagerComponent.h"
 #include "ACMCollisionsFunctionLibrary.h"
 #include "ACMTypes.h"
@@ -357,15 +358,29 @@ void UACFShootingComponent::Internal_Shoot(const FTransform& spawnTransform, con
     }
 
     UWorld* world = GetWorld();
+    UACFProjectileSubsystem* projectileSubsystem = world->GetSubsystem<UACFProjectileSubsystem>();
 
-    AACFProjectileActor* projectile = world->SpawnActorDeferred<AACFProjectileActor>(projDefinition->ProjectileClass,
-        spawnTransform, characterOwner, characterOwner, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+    if (bSimulateProjectilesWithoutActor && projectileSubsystem) {
+        projectileSubsystem->LaunchSimulatedProjectile(projDefinition, spawnTransform.GetLocation(), ShotDirection, characterOwner);
+        RemoveAmmo();
+        OnProjectileShoot.Broadcast();
+        return;
+    }
 
-    projectile->InitItemActor(characterOwner, projDefinition);
-    projectile->FinishSpawning(spawnTransform);
-    projectile->ActivateDamage();
+    AACFProjectileActor* projectile = nullptr;
+    if (bPoolProjectiles && projectileSubsystem) {
+        projectile = projectileSubsystem->AcquireProjectile(projDefinition->ProjectileClass, spawnTransform, characterOwner, projDefinition);
+    } else {
+        projectile = world->SpawnActorDeferred<AACFProjectileActor>(projDefinition->ProjectileClass,
+            spawnTransform, characterOwner, characterOwner, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+        if (projectile) {
+            projectile->InitItemActor(characterOwner, projDefinition);
+            projectile->FinishSpawning(spawnTransform);
+        }
+    }
 
     if (projectile) {
+        projectile->ActivateDamage();
         UProjectileMovementComponent* moveComp = projectile->GetProjectileMovementComp();
         const float speed = moveComp->Velocity.Size();
         moveComp->Velocity = ShotDirection.GetSafeNormal() * speed;
@@ -22,6 +22,8 @@
 #include <Net/UnrealNetwork.h>
 #include <Particles/ParticleSystemComponent.h>
 #include "ACFItemSystemFunctionLibrary.h"
+#include "ACFProjectileSubsystem.h"
+#include <TimerManager.h>
 
 AACFProjectileActor::AACFProjectileActor()
 {
@@ -90,7 +92,9 @@ void AACFProjectileActor::ActivateDamage()
         }
         bImpacted = false;
         CollisionComp->StartAllTraces();
-        CollisionComp->OnCollisionDetected.AddDynamic(this, &AACFProjectileActor::HandleAttackHit);
+        if (!CollisionComp->OnCollisionDetected.IsAlreadyBound(this, &AACFProjectileActor::HandleAttackHit)) {
+            CollisionComp->OnCollisionDetected.AddDynamic(this, &AACFProjectileActor::HandleAttackHit);
+        }
     }
 }
 
@@ -116,7 +120,7 @@ void AACFProjectileActor::OnInteractedByPawn_Implementation(class APawn* Pawn, c
         TObjectPtr<UACFEquipmentComponent> equipComp = Pawn->GetComponentByClass<UACFEquipmentComponent>();
         if (equipComp) {
             equipComp->AddItemToInventoryByClass(GetProjectileDefinition()->GetClass(), 1);
-            Destroy();
+            ReleaseProjectile();
         }
     }
 }
@@ -146,7 +150,7 @@ void AACFProjectileActor::SetupProjectile(class APawn* inOwner)
     if (inOwner) {
         bIsFlying = true;
         ItemOwner = inOwner;
-        SetLifeSpan(ProjectileLifespan);
+        ExpireAfter(ProjectileLifespan);
        // ActivateDamage();
 
     } else {
@@ -184,7 +188,7 @@ void AACFProjectileActor::HandleAttackHit(const FHitResult& HitResult)
     if (HasAuthority()) {
         switch (HitPolicy) {
         case EProjectileHitPolicy::DestroyOnHit:
-            SetLifeSpan(.1f);
+            ExpireAfter(.1f);
             break;
         case EProjectileHitPolicy::AttachOnHit:
             AttachToHit(HitResult, false);
@@ -201,7 +205,7 @@ void AACFProjectileActor::HandleProjectileHit(UPrimitiveComponent* HitComponent,
 {
     switch (HitPolicy) {
     case EProjectileHitPolicy::DestroyOnHit:
-        SetLifeSpan(.1f);
+        ExpireAfter(.1f);
         break;
     case EProjectileHitPolicy::AttachOnHit:
         AttachToHit(Hit, true);
@@ -226,13 +230,104 @@ void AACFProjectileActor::AttachToHit(const FHitResult& HitResult, bool inPickab
         AttachToComponent(HitResult.Component.Get(), FAttachmentTransformRules::KeepWorldTransform);
     }
     SetActorRotation(GetActorRotation());
-    SetLifeSpan(AttachedLifespan);
+    ExpireAfter(AttachedLifespan);
     CollisionComp->StopAllTraces();
 }
 
+void AACFProjectileActor::ReleaseProjectile()
+{
+    if (!bPooled) {
+        Destroy();
+        return;
+    }
+
+    DeactivateInPool();
+    bInPool = true;
+
+    if (UACFProjectileSubsystem* projectileSubsystem = GetWorld()->GetSubsystem<UACFProjectileSubsystem>()) {
+        projectileSubsystem->ReleaseProjectile(this);
+    } else {
+        Destroy();
+    }
+}
+
+void AACFProjectileActor::ExpireAfter(float seconds)
+{
+    if (!bPooled) {
+        SetLifeSpan(seconds);
+        return;
+    }
+
+    if (HasAuthority()) {
+        GetWorldTimerManager().SetTimer(ExpireTimer, this, &AACFProjectileActor::ReleaseProjectile, seconds, false);
+    }
+}
+
+void AACFProjectileActor::ResetFromPool(APawn* inOwner, UACFProjectile* definition, const FTransform& spawnTransform)
+{
+    SetActorTransform(spawnTransform, false, nullptr, ETeleportType::ResetPhysics);
+    SetOwner(inOwner);
+    SetInstigator(inOwner);
+
+    bInPool = false;
+    LaunchId++;
+    InitItemActor(inOwner, definition);
+    ActivateFromPool();
+}
+
+void AACFProjectileActor::ActivateFromPool()
+{
+    SetActorHiddenInGame(false);
+    SetActorEnableCollision(true);
+    bImpacted = false;
+
+    // the movement component releases its updated component when it stops on a hit
+    ProjectileMovementComp->SetUpdatedComponent(SphereComp);
+    ProjectileMovementComp->Velocity = GetActorForwardVector() * ProjectileMovementComp->InitialSpeed;
+    ProjectileMovementComp->SetActive(true, true);
+}
+
+void AACFProjectileActor::DeactivateInPool()
+{
+    GetWorldTimerManager().ClearTimer(ExpireTimer);
+    DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+    MakeStatic();
+    if (CollisionComp) {
+        CollisionComp->OnCollisionDetected.RemoveDynamic(this, &AACFProjectileActor::HandleAttackHit);
+    }
+    SetActorHiddenInGame(true);
+    SetActorEnableCollision(false);
+    bPickable = false;
+    bIsFlying = false;
+    bImpacted = false;
+}
+
+void AACFProjectileActor::OnRep_LaunchId()
+{
+    // also received when the projectile was released and fired again within the same net update
+    if (bInPool) {
+        return;
+    }
+
+    DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+    ActivateFromPool();
+    if (ItemOwner) {
+        ActivateDamage();
+    }
+}
+
+void AACFProjectileActor::OnRep_InPool()
+{
+    if (bInPool) {
+        DeactivateInPool();
+    }
+}
+
 void AACFProjectileActor::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
     DOREPLIFETIME(AACFProjectileActor, bPickable);
     DOREPLIFETIME(AACFProjectileActor, projDefinitionClass);
+    DOREPLIFETIME(AACFProjectileActor, LaunchId);
+    DOREPLIFETIME(AACFProjectileActor, bInPool);
 }
\ No newline at end of file
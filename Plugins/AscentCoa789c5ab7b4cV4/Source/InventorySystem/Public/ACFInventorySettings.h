@@ -25,4 +25,8 @@ public:
 
     UPROPERTY(EditAnywhere, config, Category = "ACF| Defaults")
     TArray<TEnumAsByte<ECollisionChannel>> DefaultDamageTraceChannel;
+
+    /*Max number of hidden projectiles kept for reuse for each projectile class, the exceeding ones are destroyed*/
+    UPROPERTY(EditAnywhere, config, Category = "ACF| Projectiles", meta = (ClampMin = 0))
+    int32 MaxPooledProjectilesPerClass = 32;
 };
@@ -129,6 +129,11 @@ public:
 
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = ACF)
     TSoftClassPtr<class UACFItem> ItemClass;
+
+    /*Relative chance of this slot to be picked among the slots matching a generation rule.
+    Slots with 0 weight are never generated*/
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (ClampMin = 0.f), Category = ACF)
+    float DropWeight = 1.f;
 };
 
 USTRUCT(BlueprintType)
@@ -0,0 +1,115 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+
+#include "ACFProjectileSubsystem.generated.h"
+
+class AACFProjectileActor;
+class APawn;
+class UACFProjectile;
+
+USTRUCT()
+struct FACFProjectilePool {
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<TObjectPtr<AACFProjectileActor>> FreeProjectiles;
+};
+
+/**
+ * A projectile simulated by the projectile subsystem without any actor.
+ */
+USTRUCT()
+struct FACFSimulatedProjectile {
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TObjectPtr<UACFProjectile> Definition;
+
+    UPROPERTY()
+    TSubclassOf<AACFProjectileActor> ActorClass;
+
+    TWeakObjectPtr<APawn> Instigator;
+
+    FVector Location = FVector::ZeroVector;
+    FVector Velocity = FVector::ZeroVector;
+    float GravityZ = 0.f;
+    float Radius = 4.f;
+    float RemainingLifespan = 5.f;
+
+    FCollisionObjectQueryParams ObjectParams;
+
+    // sweep of the last step, its result is available on the next frame
+    FTraceHandle PendingSweep;
+    FVector SweepEnd = FVector::ZeroVector;
+};
+
+/**
+ * * World subsystem reducing the cost of ranged attacks.
+ *
+ * Projectile actors are pooled per class: instead of being destroyed, expired projectiles are hidden
+ * and reused by the next shot of the same class.
+ * Projectiles can also be simulated without any actor: they are integrated as plain structs and swept
+ * with batched async traces every frame, an actor is spawned only when the projectile has to stay
+ * attached to what it hit.
+ */
+UCLASS()
+class INVENTORYSYSTEM_API UACFProjectileSubsystem : public UTickableWorldSubsystem {
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /**
+     * * Returns a projectile of the provided class ready to be fired, reusing a pooled one if available.
+     *
+     * @param projectileClass The class of the projectile actor.
+     * @param spawnTransform Where the projectile starts.
+     * @param inOwner The pawn firing the projectile.
+     * @param definition The item definition of the projectile.
+     */
+    UFUNCTION(BlueprintCallable, Category = ACF)
+    AACFProjectileActor* AcquireProjectile(TSubclassOf<AACFProjectileActor> projectileClass, const FTransform& spawnTransform, APawn* inOwner, UACFProjectile* definition);
+
+    /**
+     * * Returns a projectile to its pool, it is destroyed if the pool is full.
+     */
+    void ReleaseProjectile(AACFProjectileActor* projectile);
+
+    /**
+     * * Fires a projectile simulated without actor. Hits are resolved on the server.
+     *
+     * @param definition The item definition of the projectile, its actor class provides speed, gravity, radius and damage.
+     * @param location Where the projectile starts.
+     * @param direction The direction of the shot.
+     * @param instigator The pawn firing the projectile.
+     */
+    void LaunchSimulatedProjectile(UACFProjectile* definition, const FVector& location, const FVector& direction, APawn* instigator);
+
+    UFUNCTION(BlueprintPure, Category = ACF)
+    int32 GetNumSimulatedProjectiles() const { return SimulatedProjectiles.Num(); }
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    void HandleSimulatedImpact(const FACFSimulatedProjectile& projectile, const FHitResult& hit);
+
+    FCollisionQueryParams MakeSweepParams(const FACFSimulatedProjectile& projectile) const;
+
+    /* Synchronous sweep of the last step, used when its async result is not available*/
+    bool SweepSimulatedProjectile(const FACFSimulatedProjectile& projectile, FHitResult& outHit) const;
+
+    UPROPERTY()
+    TMap<TSubclassOf<AACFProjectileActor>, FACFProjectilePool> Pools;
+
+    UPROPERTY()
+    TArray<FACFSimulatedProjectile> SimulatedProjectiles;
+};
@@ -19,6 +19,7 @@
 class USkeletalMeshComponent;
 class UACFConsumable;
 class UACFStorageComponent;
+class UACFArmorSlotComponent;
 class AACFWeaponActor;
 
 USTRUCT(BlueprintType)
@@ -107,16 +108,9 @@ public:
 	}
 
 	//~FFastArraySerializer contract
-	void PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize) {};
-	void PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize)
-	{
-		ValidateChanges(AddedIndices);
-	}
-
-	void PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize)
-	{
-		ValidateChanges(ChangedIndices);
-	}
+	void PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize);
+	void PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize);
+	void PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize);
 	//~End of FFastArraySerializer contract
 
 	void ValidateChanges(const TArrayView<int32> AddedIndices);
@@ -129,6 +123,7 @@ public:
 	{
 		EquippedItems.Empty();
 		MarkArrayDirty();
+		bIndicesDirty = true;
 	}
 	int32 Num() { return EquippedItems.Num(); }
 
@@ -138,6 +133,7 @@ public:
 			Instance.Init(ownerComp);
 			EquippedItems.Add(Instance);
 			MarkItemDirty(Instance);
+			bIndicesDirty = true;
 		}
 	}
 
@@ -145,6 +141,7 @@ public:
 	{
 		EquippedItems.Remove(Instance);
 		MarkItemDirty(Instance);
+		bIndicesDirty = true;
 	}
 
 	void RemoveAt(int32 index)
@@ -155,6 +152,7 @@ public:
 		FEquippedItem Instance = EquippedItems[index];
 		EquippedItems.Remove(Instance);
 		MarkItemDirty(Instance);
+		bIndicesDirty = true;
 	}
 
 	void ChangeEntry(const FEquippedItem& Instance)
@@ -163,10 +161,19 @@ public:
 		if (itemPtr) {
 			*itemPtr = Instance;
 			MarkItemDirty(*itemPtr);
+			bIndicesDirty = true;
 		}
 	}
 
-	const TArray<FEquippedItem> GetEquippedItems() const { return EquippedItems; }
+	const TArray<FEquippedItem>& GetEquippedItems() const { return EquippedItems; }
+
+	/** Returns the item equipped in the provided slot, or nullptr if the slot is empty. */
+	const FEquippedItem* FindBySlot(const FGameplayTag& itemSlot) const;
+
+	/** Returns the equipped item with the provided GUID, or nullptr if it is not equipped. */
+	const FEquippedItem* FindByGuid(const FGuid& itemGuid) const;
+
+	bool ContainsSlot(const FGameplayTag& itemSlot) const { return FindBySlot(itemSlot) != nullptr; }
 
 	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
 	{
@@ -179,6 +186,14 @@ protected:
 
 	UPROPERTY(NotReplicated)
 	TObjectPtr<UACFEquipmentComponent> ownerComp;
+
+private:
+	void RebuildIndices() const;
+
+	/* Lookups by slot and guid, rebuilt lazily after the array changes */
+	mutable TMap<FGameplayTag, int32> SlotIndices;
+	mutable TMap<FGuid, int32> GuidIndices;
+	mutable bool bIndicesDirty = true;
 };
 
 template <>
@@ -355,6 +370,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ACF|Equipment")
 	void RefreshEquipment();
 
+	/**
+	* Refresh the appearence of the owner only for the provided slot, equipping or
+	* removing whatever is currently in it.
+	*
+	* @param itemSlot The slot to refresh.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "ACF|Equipment")
+	void RefreshEquipmentSlot(const FGameplayTag& itemSlot);
+
 
 	/**
 	* Returns whether left-hand IK should be used.
@@ -543,6 +567,9 @@ public:
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = ACF)
 	void OnEntityOwnerDeath();
 
+	/* Called by the replicated equipment for every slot added, changed or removed */
+	void MarkEquipmentSlotDirty(const FGameplayTag& itemSlot);
+
 protected:
 	/* Slots available to the character*/
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = ACF)
@@ -604,6 +631,15 @@ private:
 
 	TArray<FModularPart> ModularMeshes;
 
+	/* Every armor slot component of the owner, empty ones are kept to be reused by the next armor in the same slot*/
+	UPROPERTY()
+	TMap<FGameplayTag, TObjectPtr<UACFArmorSlotComponent>> ArmorSlotComponents;
+
+	bool bArmorSlotComponentsGathered = false;
+
+	/* Slots changed by replication, refreshed on the next OnRep_Equipment */
+	TArray<FGameplayTag> DirtyEquipmentSlots;
+
 	UFUNCTION()
 	void OnRep_Equipment();
 
@@ -612,6 +648,10 @@ private:
 
 	void FillModularMeshes();
 
+	void GatherArmorSlotComponents();
+
+	void ApplyEquippedItem(const FEquippedItem& item);
+
 	void Internal_DestroyEquipment();
 
 	UPROPERTY()
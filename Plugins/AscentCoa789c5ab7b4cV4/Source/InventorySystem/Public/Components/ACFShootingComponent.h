@@ -383,6 +383,16 @@ protected:
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ACF|SwipeTrace Shoot Config")
     float ShootRange = 3500.f;
 
+    /*Expired projectiles are hidden and reused by the next shots instead of being destroyed*/
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ACF|Projectile")
+    bool bPoolProjectiles = true;
+
+    /*Projectiles are simulated by the projectile subsystem without spawning any actor, that is
+    spawned only on impact when the projectile has to stay attached. Meant for fast projectiles
+    fired in large numbers, as no projectile is visible while flying*/
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ACF|Projectile")
+    bool bSimulateProjectilesWithoutActor = false;
+
 private:
     UPROPERTY()
     TObjectPtr<UMeshComponent> shootingMesh;
@@ -22,6 +22,8 @@ UCLASS()
 class INVENTORYSYSTEM_API AACFProjectileActor : public AACFEquippableActor, public IACFInteractableInterface {
     GENERATED_BODY()
 
+    friend class UACFProjectileSubsystem;
+
 public:
     AACFProjectileActor();
     /**
@@ -103,6 +105,19 @@ public:
 
     virtual void InitItemActor(APawn* inOwner, UACFItem* inItemDefinition) override;
 
+    /**
+     * Whether this projectile is managed by the projectile subsystem pool.
+     * @return True if the projectile is returned to the pool instead of being destroyed
+     */
+    UFUNCTION(BlueprintPure, Category = ACF)
+    FORCEINLINE bool IsPooled() const { return bPooled; }
+
+    /**
+     * Destroys the projectile, or hides it and gives it back to its pool if pooled.
+     */
+    UFUNCTION(BlueprintCallable, Category = ACF)
+    void ReleaseProjectile();
+
 protected:
     // Called when the game starts or when spawned
     virtual void BeginPlay() override;
@@ -169,6 +184,31 @@ private:
     UFUNCTION()
     void OnRep_ProjDefinitionClass();
 
+    /* Incremented every time the projectile is fired from the pool, never reset so clients see every launch*/
+    UPROPERTY(ReplicatedUsing = OnRep_LaunchId)
+    uint32 LaunchId = 0;
+
+    UFUNCTION()
+    void OnRep_LaunchId();
+
+    /* True while the projectile waits in the pool*/
+    UPROPERTY(ReplicatedUsing = OnRep_InPool)
+    bool bInPool = false;
+
+    UFUNCTION()
+    void OnRep_InPool();
+
+    bool bPooled = false;
+
+    FTimerHandle ExpireTimer;
+
+    /* Same as SetLifeSpan, but pooled projectiles are released instead of destroyed*/
+    void ExpireAfter(float seconds);
+
+    void ResetFromPool(APawn* inOwner, UACFProjectile* definition, const FTransform& spawnTransform);
+    void ActivateFromPool();
+    void DeactivateInPool();
+
     UFUNCTION()
     void HandleAttackHit(const FHitResult& HitResult);
 
@@ -216,6 +216,45 @@ FBAGraphData& FBACache::GetGraphData(UEdGraph* Graph)
 	return GraphData;
 }
 
+const FBANodeSizeTemplate* FBACache::FindNodeSizeTemplate(UEdGraph* Graph, const FString& TemplateKey)
+{
+	check(Graph);
+
+	if (FBAPackageData* PackageData = CacheData.PackageData.Find(Graph->GetOutermost()->GetFName()))
+	{
+		return PackageData->SizeTemplates.Find(TemplateKey);
+	}
+
+	return nullptr;
+}
+
+void FBACache::SetNodeSizeTemplate(UEdGraph* Graph, const FString& TemplateKey, const FBANodeSizeTemplate& SizeTemplate)
+{
+	check(Graph);
+	FBAPackageData& PackageData = CacheData.PackageData.FindOrAdd(Graph->GetOutermost()->GetFName());
+	PackageData.SizeTemplates.Add(TemplateKey, SizeTemplate);
+}
+
+void FBACache::RemoveNodeSizeTemplate(UEdGraph* Graph, const FString& TemplateKey)
+{
+	check(Graph);
+
+	if (FBAPackageData* PackageData = CacheData.PackageData.Find(Graph->GetOutermost()->GetFName()))
+	{
+		PackageData->SizeTemplates.Remove(TemplateKey);
+	}
+}
+
+void FBACache::ClearNodeSizeTemplates(UEdGraph* Graph)
+{
+	check(Graph);
+
+	if (FBAPackageData* PackageData = CacheData.PackageData.Find(Graph->GetOutermost()->GetFName()))
+	{
+		PackageData->SizeTemplates.Empty();
+	}
+}
+
 FString FBACache::GetProjectSavedCachePath(bool bFullPath)
 {
 	return FPaths::ProjectDir() / TEXT("Saved") / TEXT("BlueprintAssist") / TEXT("BlueprintAssistCache.json");
@@ -0,0 +1,216 @@
+// Copyright fpwong. All Rights Reserved.
+
+#include "BlueprintAssistFormatters/BANodeSpatialGrid.h"
+
+#include "BlueprintAssistGraphHandler.h"
+#include "BlueprintAssistStats.h"
+#include "BlueprintAssistUtils.h"
+
+FBANodeSpatialGrid::FBANodeSpatialGrid(float InCellSize)
+	: CellSize(FMath::Max(InCellSize, 1.0f))
+{
+}
+
+void FBANodeSpatialGrid::Build(TSharedPtr<FBAGraphHandler> InGraphHandler, const TSet<UEdGraphNode*>& Nodes)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FBANodeSpatialGrid::Build"), STAT_BANodeSpatialGrid_Build, STATGROUP_BA_EdGraphFormatter);
+
+	Reset();
+	GraphHandler = InGraphHandler;
+
+	Entries.Reserve(Nodes.Num());
+	EntryIndices.Reserve(Nodes.Num());
+
+	for (UEdGraphNode* Node : Nodes)
+	{
+		if (Node)
+		{
+			UpdateNode(Node, FBAUtils::GetCachedNodeBounds(GraphHandler, Node));
+		}
+	}
+}
+
+void FBANodeSpatialGrid::Reset()
+{
+	GraphHandler.Reset();
+	Entries.Reset();
+	EntryIndices.Reset();
+	Cells.Reset();
+	QueryId = 0;
+}
+
+void FBANodeSpatialGrid::UpdateNode(UEdGraphNode* Node, const FSlateRect& Bounds)
+{
+	if (const int32* FoundIndex = EntryIndices.Find(Node))
+	{
+		FEntry& Entry = Entries[*FoundIndex];
+		if (Entry.Bounds == Bounds)
+		{
+			return;
+		}
+
+		const FIntRect NewCells = GetCellRange(Bounds);
+		Entry.Bounds = Bounds;
+		if (NewCells != Entry.Cells)
+		{
+			RemoveFromCells(*FoundIndex);
+			Entry.Cells = NewCells;
+			AddToCells(*FoundIndex);
+		}
+
+		return;
+	}
+
+	const int32 NewIndex = Entries.AddDefaulted();
+	FEntry& Entry = Entries[NewIndex];
+	Entry.Node = Node;
+	Entry.Bounds = Bounds;
+	Entry.Cells = GetCellRange(Bounds);
+	EntryIndices.Add(Node, NewIndex);
+	AddToCells(NewIndex);
+}
+
+void FBANodeSpatialGrid::UpdateMovedNodes()
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FBANodeSpatialGrid::UpdateMovedNodes"), STAT_BANodeSpatialGrid_UpdateMovedNodes, STATGROUP_BA_EdGraphFormatter);
+
+	if (!GraphHandler.IsValid())
+	{
+		return;
+	}
+
+	for (int32 i = 0; i < Entries.Num(); ++i)
+	{
+		UEdGraphNode* Node = Entries[i].Node;
+		UpdateNode(Node, FBAUtils::GetCachedNodeBounds(GraphHandler, Node));
+	}
+}
+
+bool FBANodeSpatialGrid::AnyNodeIntersectsLine(
+	const FVector2D& Start,
+	const FVector2D& End,
+	const FMargin& Extend,
+	const UEdGraphNode* IgnoredA,
+	const UEdGraphNode* IgnoredB) const
+{
+	FSlateRect QueryBounds(
+		FMath::Min(Start.X, End.X) - Extend.Right,
+		FMath::Min(Start.Y, End.Y) - Extend.Bottom,
+		FMath::Max(Start.X, End.X) + Extend.Left,
+		FMath::Max(Start.Y, End.Y) + Extend.Top);
+
+	return ForEachEntryInBounds(QueryBounds, [&](const FEntry& Entry)
+	{
+		if (Entry.Node == IgnoredA || Entry.Node == IgnoredB)
+		{
+			return false;
+		}
+
+		return FBAUtils::LineRectIntersection(Entry.Bounds.ExtendBy(Extend), Start, End);
+	});
+}
+
+void FBANodeSpatialGrid::GatherNodesInBounds(const FSlateRect& QueryBounds, TArray<UEdGraphNode*>& OutNodes) const
+{
+	ForEachEntryInBounds(QueryBounds, [&OutNodes](const FEntry& Entry)
+	{
+		OutNodes.Add(Entry.Node);
+		return false;
+	});
+}
+
+FIntRect FBANodeSpatialGrid::GetCellRange(const FSlateRect& Bounds) const
+{
+	return FIntRect(
+		FMath::FloorToInt(Bounds.Left / CellSize),
+		FMath::FloorToInt(Bounds.Top / CellSize),
+		FMath::FloorToInt(Bounds.Right / CellSize),
+		FMath::FloorToInt(Bounds.Bottom / CellSize));
+}
+
+void FBANodeSpatialGrid::AddToCells(int32 EntryIndex)
+{
+	const FIntRect& Range = Entries[EntryIndex].Cells;
+	for (int32 X = Range.Min.X; X <= Range.Max.X; ++X)
+	{
+		for (int32 Y = Range.Min.Y; Y <= Range.Max.Y; ++Y)
+		{
+			Cells.FindOrAdd(FIntPoint(X, Y)).Add(EntryIndex);
+		}
+	}
+}
+
+void FBANodeSpatialGrid::RemoveFromCells(int32 EntryIndex)
+{
+	const FIntRect& Range = Entries[EntryIndex].Cells;
+	for (int32 X = Range.Min.X; X <= Range.Max.X; ++X)
+	{
+		for (int32 Y = Range.Min.Y; Y <= Range.Max.Y; ++Y)
+		{
+			if (TArray<int32>* Cell = Cells.Find(FIntPoint(X, Y)))
+			{
+				Cell->RemoveSingleSwap(EntryIndex);
+			}
+		}
+	}
+}
+
+bool FBANodeSpatialGrid::ForEachEntryInBounds(const FSlateRect& QueryBounds, TFunctionRef<bool(const FEntry&)> Callback) const
+{
+	// the query id lets us skip nodes spanning multiple cells without allocating a visited set
+	++QueryId;
+	if (QueryId == 0)
+	{
+		for (const FEntry& Entry : Entries)
+		{
+			Entry.LastQueryId = 0;
+		}
+		QueryId = 1;
+	}
+
+	const FIntRect Range = GetCellRange(QueryBounds);
+
+	// for queries covering more cells than there are nodes, testing every node is cheaper
+	const int64 NumCells = int64(Range.Max.X - Range.Min.X + 1) * int64(Range.Max.Y - Range.Min.Y + 1);
+	if (NumCells > Entries.Num())
+	{
+		for (const FEntry& Entry : Entries)
+		{
+			if (FSlateRect::DoRectanglesIntersect(Entry.Bounds, QueryBounds) && Callback(Entry))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	for (int32 X = Range.Min.X; X <= Range.Max.X; ++X)
+	{
+		for (int32 Y = Range.Min.Y; Y <= Range.Max.Y; ++Y)
+		{
+			const TArray<int32>* Cell = Cells.Find(FIntPoint(X, Y));
+			if (!Cell)
+			{
+				continue;
+			}
+
+			for (const int32 EntryIndex : *Cell)
+			{
+				const FEntry& Entry = Entries[EntryIndex];
+				if (Entry.LastQueryId == QueryId)
+				{
+					continue;
+				}
+
+				Entry.LastQueryId = QueryId;
+				if (Callback(Entry))
+				{
+					return true;
+				}
+			}
+		}
+	}
+
+	return false;
+}
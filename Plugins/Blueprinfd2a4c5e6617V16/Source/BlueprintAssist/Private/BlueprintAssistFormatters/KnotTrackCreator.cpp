@@ -45,6 +45,8 @@ void FKnotTrackCreator::FormatKnotNodes()
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FKnotTrackCreator::FormatKnotNodes"), STAT_KnotTrackCreator_FormatNode, STATGROUP_BA_EdGraphFormatter);
 	//UE_LOG(LogKnotTrackCreator, Warning, TEXT("### Format Knot Nodes"));
 
+	NodeGrid.Build(GraphHandler, Formatter->GetFormattedNodes());
+
 	MakeKnotTrack();
 
 	MergeNearbyKnotTracks();
@@ -61,6 +63,9 @@ void FKnotTrackCreator::FormatKnotNodes()
 
 	ExpandKnotTracks();
 
+	// expanding may have moved nodes
+	NodeGrid.UpdateMovedNodes();
+
 	if (!UBASettings_Advanced::HasDebugSetting("post-align"))
 	{
 		// after expanding it is possible that some tracks might be able to be have a new pin-aligned solution, check this again
@@ -72,7 +77,7 @@ void FKnotTrackCreator::FormatKnotNodes()
 				const TSharedPtr<FKnotNodeTrack> Track = TrackGroup->Tracks[0];
 				if (!Track->bIsLoopingTrack && !Track->HasPinToAlignTo())
 				{
-					if (TryAlignTrackToEndPins(Track, Formatter->GetFormattedNodes().Array()))
+					if (TryAlignTrackToEndPins(Track))
 					{
 						// UE_LOG(LogTemp, Warning, TEXT("Successully aligned %s"), *Track->ToString());
 						// GraphHandler->GetGraphOverlay()->DrawBounds(Track->GetTrackBounds(), FLinearColor::Red);
@@ -1191,7 +1196,7 @@ UK2Node_Knot* FKnotTrackCreator::GetKnotNodeFromPool(FKnotNodeCreation* Creation
 	return nullptr;
 }
 
-bool FKnotTrackCreator::TryAlignTrackToEndPins(TSharedPtr<FKnotNodeTrack> Track, const TArray<UEdGraphNode*>& AllNodes)
+bool FKnotTrackCreator::TryAlignTrackToEndPins(TSharedPtr<FKnotNodeTrack> Track)
 {
 	const float ParentPinY = GraphHandler->GetPinY(Track->GetParentPin());
 	const float LastPinY = GraphHandler->GetPinY(Track->GetLastPin());
@@ -1238,27 +1243,12 @@ bool FKnotTrackCreator::TryAlignTrackToEndPins(TSharedPtr<FKnotNodeTrack> Track,
 
 		// UE_LOG(LogKnotTrackCreator, Error, TEXT("Checking Point %s | %s"), *Point.ToString(), *FBAUtils::GetNodeName(SourcePin->GetOwningNode()));
 
-		bool bAnyCollision = false;
-
-		for (UEdGraphNode* NodeToCollisionCheck : AllNodes)
-		{
-			FSlateRect CollisionBounds = FBAUtils::GetCachedNodeBounds(GraphHandler, NodeToCollisionCheck).ExtendBy(FMargin(0, TrackSpacing - 1));
-
-			// UE_LOG(LogKnotTrackCreator, Warning, TEXT("Collision check against %s | %s | %s"), *FBAUtils::GetNodeName(NodeToCollisionCheck), *CollisionBounds.ToString(), *Point.ToString());
-
-			if (NodeToCollisionCheck == SourcePin->GetOwningNode() || NodeToCollisionCheck == OtherPin->GetOwningNode())
-			{
-				// UE_LOG(LogKnotTrackCreator, Warning, TEXT("\tSkipping node"));
-				continue;
-			}
-
-			if (FBAUtils::LineRectIntersection(CollisionBounds, SourcePinPos, Point))
-			{
-				// UE_LOG(LogKnotTrackCreator, Warning, TEXT("\tFound collision"));
-				bAnyCollision = true;
-				break;
-			}
-		}
+		bool bAnyCollision = NodeGrid.AnyNodeIntersectsLine(
+			SourcePinPos,
+			Point,
+			FMargin(0, TrackSpacing - 1),
+			SourcePin->GetOwningNode(),
+			OtherPin->GetOwningNode());
 
 		for (TSharedPtr<FKnotNodeTrack> OtherTrack : KnotTracks)
 		{
@@ -1314,40 +1304,22 @@ bool FKnotTrackCreator::DoesPinNeedTrack(UEdGraphPin* Pin, const TArray<UEdGraph
 
 bool FKnotTrackCreator::AnyCollisionBetweenPins(UEdGraphPin* Pin, UEdGraphPin* OtherPin)
 {
-	TSet<UEdGraphNode*> FormattedNodes = Formatter->GetFormattedNodes();
-
 	const FVector2D PinPos = FBAUtils::GetPinPos(GraphHandler, Pin);
 	const FVector2D OtherPinPos = FBAUtils::GetPinPos(GraphHandler, OtherPin);
 
 	// UE_LOG(LogTemp, Warning, TEXT("Checking pins %s %s"), *FBAUtils::GetPinName(Pin), *FBAUtils::GetPinName(OtherPin));
 
-	return NodeCollisionBetweenLocation(PinPos, OtherPinPos, { Pin->GetOwningNode(), OtherPin->GetOwningNode() });
+	return NodeCollisionBetweenLocation(PinPos, OtherPinPos, Pin->GetOwningNode(), OtherPin->GetOwningNode());
 }
 
-bool FKnotTrackCreator::NodeCollisionBetweenLocation(FVector2D Start, FVector2D End, TSet<UEdGraphNode*> IgnoredNodes)
+bool FKnotTrackCreator::NodeCollisionBetweenLocation(const FVector2D& Start, const FVector2D& End, const UEdGraphNode* IgnoredA, const UEdGraphNode* IgnoredB) const
 {
-	TSet<UEdGraphNode*> FormattedNodes = Formatter->GetFormattedNodes();
-
-	for (UEdGraphNode* NodeToCollisionCheck : FormattedNodes)
-	{
-		if (IgnoredNodes.Contains(NodeToCollisionCheck))
-		{
-			continue;
-		}
-
-		FSlateRect NodeBounds = FBAUtils::GetCachedNodeBounds(GraphHandler, NodeToCollisionCheck);//.ExtendBy(FMargin(0, TrackSpacing - 1));
-		if (FBAUtils::LineRectIntersection(NodeBounds, Start, End))
-		{
-			// UE_LOG(LogKnotTrackCreator, Warning, TEXT("\tNode collision! %s"), *FBAUtils::GetNodeName(NodeToCollisionCheck));
-			return true;
-		}
-	}
-
-	return false;
+	return NodeGrid.AnyNodeIntersectsLine(Start, End, FMargin(0), IgnoredA, IgnoredB);
 }
 
 void FKnotTrackCreator::Reset()
 {
+	NodeGrid.Reset();
 	KnotNodesSet.Reset();
 	KnotTracks.Reset();
 	KnotNodeOwners.Reset();
@@ -1591,7 +1563,7 @@ TSharedPtr<FKnotNodeTrack> FKnotTrackCreator::MakeKnotTracksForLinkedExecPins(UE
 
 	TSharedPtr<FKnotNodeTrack> KnotTrack = MakeShared<FKnotNodeTrack>(Formatter, GraphHandler, ParentPin, LinkedPins, false);
 
-	TryAlignTrackToEndPins(KnotTrack, Formatter->GetFormattedNodes().Array());
+	TryAlignTrackToEndPins(KnotTrack);
 
 	// remove the first linked pins which has the same height and no collision
 	const bool bSameHeightAsParentPin = FMath::Abs(KnotTrack->GetTrackHeight() - ParentPinPos.Y) < 5.f;
@@ -1783,7 +1755,7 @@ TSharedPtr<FKnotNodeTrack> FKnotTrackCreator::MakeKnotTracksForParameterPins(UEd
 	TSharedPtr<FKnotNodeTrack> KnotTrack = MakeShared<FKnotNodeTrack>(Formatter, GraphHandler, ParentPin, LinkedPins, false);
 
 	// check if the track height can simply be set to one of it's pin's height
-	if (TryAlignTrackToEndPins(KnotTrack, Formatter->GetFormattedNodes().Array()))
+	if (TryAlignTrackToEndPins(KnotTrack))
 	{
 		// UE_LOG(LogKnotTrackCreator, Warning, TEXT("Found a pin to align to for %s"), *FBAUtils::GetPinName(KnotTrack->GetParentPin()));
 	}
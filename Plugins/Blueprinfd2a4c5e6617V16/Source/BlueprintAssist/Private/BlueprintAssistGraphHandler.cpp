@@ -1134,7 +1134,7 @@ void FBAGraphHandler::CacheNodeSizes(const TArray<UEdGraphNode*>& Nodes)
 		}
 
 		// if the node size hasn't been cached, add the node to be calculated
-		if (!PendingSize.Contains(Node) && !GetNodeData(Node).HasSize())
+		if (!PendingSize.Contains(Node) && !GetNodeData(Node).HasSize() && !TryApplyNodeSizeTemplate(Node))
 		{
 			PendingSize.Emplace(Node);
 		}
@@ -1456,9 +1456,10 @@ bool FBAGraphHandler::UpdateNodeSizesChanges(const TArray<UEdGraphNode*>& Nodes)
 		// refresh node sizes for nodes which have changed in size 
 		if (FBANodeSizeChangeData* ChangeData = NodeSizeChangeDataMap.Find(Node->NodeGuid))
 		{
-			if (ChangeData->HasNodeChanged(Node))
+			// only re-measure if no identical node has been measured already
+			if (ChangeData->HasNodeChanged(Node) && !TryApplyNodeSizeTemplate(Node))
 			{
-				PendingSize.Add(Node);
+				PendingSize.AddUnique(Node);
 				bAddedSize = true;
 			}
 
@@ -1471,7 +1472,7 @@ bool FBAGraphHandler::UpdateNodeSizesChanges(const TArray<UEdGraphNode*>& Nodes)
 
 		// calculate size for all connected nodes which don't have a valid size
 		const bool bHasValidSize = GetNodeData(Node).HasSize();
-		if (!bHasValidSize && !PendingSize.Contains(Node))
+		if (!bHasValidSize && !PendingSize.Contains(Node) && !TryApplyNodeSizeTemplate(Node))
 		{
 			PendingSize.Add(Node);
 			bAddedSize = true;
@@ -2658,6 +2659,7 @@ void FBAGraphHandler::UpdateCachedNodeSize(float DeltaTime)
 		if (bSuccessfullyCachedNodeSize)
 		{
 			NodesCalculated.Add(Node);
+			StoreNodeSizeTemplate(Node);
 
 			// Complete the size timeout notification
 			if (SizeTimeoutNotification.IsValid())
@@ -2669,6 +2671,20 @@ void FBAGraphHandler::UpdateCachedNodeSize(float DeltaTime)
 		}
 	}
 
+	// any pending nodes identical to one we just measured can reuse its size instead of being focused one at a time
+	if (NodesCalculated.Num() > 0 && UBASettings_Advanced::Get().bShareNodeSizesBetweenIdenticalNodes)
+	{
+		const TSet<UEdGraphNode*> MeasuredNodes(NodesCalculated);
+		for (TWeakObjectPtr<UEdGraphNode> WeakPtr : PendingSize)
+		{
+			UEdGraphNode* Node = WeakPtr.Get();
+			if (Node && !MeasuredNodes.Contains(Node) && TryApplyNodeSizeTemplate(Node))
+			{
+				NodesCalculated.Add(Node);
+			}
+		}
+	}
+
 	// remove any nodes that we calculated the size for
 	for (UEdGraphNode* Node : NodesCalculated)
 	{
@@ -3255,6 +3271,13 @@ void FBAGraphHandler::RefreshNodeSize(UEdGraphNode* Node)
 	{
 		GetNodeData(Node).ResetSize();
 		PendingSize.Add(Node);
+
+		// the shared size may be the one that is out of date, so measure this node again
+		const FString TemplateKey = FBANodeSizeChangeData::GetSizeTemplateKey(Node);
+		if (!TemplateKey.IsEmpty())
+		{
+			FBACache::Get().RemoveNodeSizeTemplate(GetFocusedEdGraph(), TemplateKey);
+		}
 	}
 	else if (FBAUtils::IsCommentNode(Node))
 	{
@@ -3264,6 +3287,8 @@ void FBAGraphHandler::RefreshNodeSize(UEdGraphNode* Node)
 
 void FBAGraphHandler::RefreshAllNodeSizes()
 {
+	FBACache::Get().ClearNodeSizeTemplates(GetFocusedEdGraph());
+
 	for (UEdGraphNode* Node : GetFocusedEdGraph()->Nodes)
 	{
 		RefreshNodeSize(Node);
@@ -3703,4 +3728,70 @@ bool FBAGraphHandler::CacheNodeSize(UEdGraphNode* Node)
 	}
 
 	return false;
-}
\ No newline at end of file
+}
+
+bool FBAGraphHandler::TryApplyNodeSizeTemplate(UEdGraphNode* Node)
+{
+	if (!UBASettings_Advanced::Get().bShareNodeSizesBetweenIdenticalNodes)
+	{
+		return false;
+	}
+
+	const FString TemplateKey = FBANodeSizeChangeData::GetSizeTemplateKey(Node);
+	if (TemplateKey.IsEmpty())
+	{
+		return false;
+	}
+
+	const FBANodeSizeTemplate* SizeTemplate = FBACache::Get().FindNodeSizeTemplate(GetFocusedEdGraph(), TemplateKey);
+	if (!SizeTemplate || !SizeTemplate->IsValid())
+	{
+		return false;
+	}
+
+	FBANodeData& NodeData = GetNodeData(Node);
+	NodeData.ResetSize();
+
+	for (const TPair<int32, float>& Pin : SizeTemplate->Pins)
+	{
+		if (Node->Pins.IsValidIndex(Pin.Key))
+		{
+			NodeData.CachedPins.Add(Node->Pins[Pin.Key]->PinId, Pin.Value);
+		}
+	}
+
+	NodeData.SetSize(FVector2D(SizeTemplate->Size.X, SizeTemplate->Size.Y));
+	return true;
+}
+
+void FBAGraphHandler::StoreNodeSizeTemplate(UEdGraphNode* Node)
+{
+	if (!UBASettings_Advanced::Get().bShareNodeSizesBetweenIdenticalNodes)
+	{
+		return;
+	}
+
+	const FString TemplateKey = FBANodeSizeChangeData::GetSizeTemplateKey(Node);
+	if (TemplateKey.IsEmpty())
+	{
+		return;
+	}
+
+	const FBANodeData& NodeData = GetNodeData(Node);
+	if (!NodeData.HasSize())
+	{
+		return;
+	}
+
+	FBANodeSizeTemplate SizeTemplate;
+	SizeTemplate.Size = NodeData.GetNodeSize();
+	for (int32 PinIndex = 0; PinIndex < Node->Pins.Num(); ++PinIndex)
+	{
+		if (const float* PinOffset = NodeData.CachedPins.Find(Node->Pins[PinIndex]->PinId))
+		{
+			SizeTemplate.Pins.Add(PinIndex, *PinOffset);
+		}
+	}
+
+	FBACache::Get().SetNodeSizeTemplate(GetFocusedEdGraph(), TemplateKey, SizeTemplate);
+}
@@ -202,7 +202,7 @@ bool FBANodeSizeChangeData::HasNodeChanged(UEdGraphNode* Node) const
 	return false;
 }
 
-FString FBANodeSizeChangeData::GetPropertyAccessTextPath(UEdGraphNode* Node) const
+FString FBANodeSizeChangeData::GetPropertyAccessTextPath(UEdGraphNode* Node)
 {
 	// have to read the property directly because K2Node_PropertyAccess is not exposed
 	if (const FTextProperty* TextPathProperty = CastField<FTextProperty>(Node->GetClass()->FindPropertyByName("TextPath")))
@@ -234,6 +234,50 @@ TSet<FGuid> FBANodeSizeChangeData::GetParentComments(UEdGraphNode* Node)
 	return Out;
 }
 
+FString FBANodeSizeChangeData::GetSizeTemplateKey(UEdGraphNode* Node)
+{
+	if (!Node || FBAUtils::IsCommentNode(Node) || FBAUtils::IsKnotNode(Node) || Node->bCommentBubbleVisible)
+	{
+		return FString();
+	}
+
+	// the key is saved to the cache file, so only hash strings and plain values (FName and pointer hashes change between sessions)
+	uint32 Hash = GetTypeHash(FBAUtils::GetNodeTitle(Node).ToString());
+	Hash = HashCombine(Hash, GetTypeHash(Node->AdvancedPinDisplay == ENodeAdvancedPins::Shown));
+	Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Node->GetDesiredEnabledState())));
+
+	if (UK2Node_CreateDelegate* Delegate = Cast<UK2Node_CreateDelegate>(Node))
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Delegate->GetFunctionName().ToString()));
+	}
+
+	Hash = HashCombine(Hash, GetTypeHash(GetPropertyAccessTextPath(Node)));
+
+	for (UEdGraphPin* Pin : Node->GetAllPins())
+	{
+		FBAPinChangeData PinData;
+		PinData.UpdatePin(Pin);
+
+		// exec pins do not change size when linked, see FBAPinChangeData::HasPinChanged
+		const bool bLinkedAffectsSize = Pin->PinType.PinSubCategory != UEdGraphSchema_K2::PC_Exec && PinData.bPinLinked;
+
+		Hash = HashCombine(Hash, GetTypeHash(Pin->PinName.ToString()));
+		Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Pin->Direction)));
+		Hash = HashCombine(Hash, GetTypeHash(Pin->PinType.PinCategory.ToString()));
+		Hash = HashCombine(Hash, GetTypeHash(Pin->PinType.PinSubCategory.ToString()));
+		Hash = HashCombine(Hash, GetTypeHash(Pin->PinType.PinSubCategoryObject.IsValid() ? Pin->PinType.PinSubCategoryObject->GetPathName() : FString()));
+		Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Pin->PinType.ContainerType)));
+		Hash = HashCombine(Hash, GetTypeHash(PinData.bPinHidden));
+		Hash = HashCombine(Hash, GetTypeHash(bLinkedAffectsSize));
+		Hash = HashCombine(Hash, GetTypeHash(PinData.PinValue));
+		Hash = HashCombine(Hash, GetTypeHash(PinData.PinTextValue.ToString()));
+		Hash = HashCombine(Hash, GetTypeHash(PinData.PinLabel.ToString()));
+		Hash = HashCombine(Hash, GetTypeHash(PinData.PinObject));
+	}
+
+	return FString::Printf(TEXT("%s_%d_%08X"), *Node->GetClass()->GetName(), Node->GetAllPins().Num(), Hash);
+}
+
 FBAFormattingChangeData::FBAFormattingChangeData(UEdGraphNode* Node): FBANodeSizeChangeData(Node)
 {
 	FBAFormattingChangeData::UpdateNode(Node);
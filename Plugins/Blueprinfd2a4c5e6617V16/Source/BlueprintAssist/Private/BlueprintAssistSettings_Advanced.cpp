@@ -14,6 +14,7 @@ UBASettings_Advanced::UBASettings_Advanced(const FObjectInitializer& ObjectIniti
 {
 	//~~~ Cache
 	bSlowButAccurateSizeCaching = false;
+	bShareNodeSizesBetweenIdenticalNodes = true;
 	CacheSaveLocation = EBACacheSaveLocation::Project;
 	bSaveBlueprintAssistCacheToFile = true;
 
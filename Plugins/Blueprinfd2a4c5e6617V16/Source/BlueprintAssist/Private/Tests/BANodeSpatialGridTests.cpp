@@ -0,0 +1,231 @@
+// Copyright fpwong. All Rights Reserved.
+
+#include "BlueprintAssistFormatters/BANodeSpatialGrid.h"
+#include "BlueprintAssistUtils.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraphNode_Comment.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace BANodeSpatialGridTests
+{
+	struct FTestGraph
+	{
+		UEdGraph* Graph = nullptr;
+		TArray<UEdGraphNode*> Nodes;
+		TArray<FSlateRect> Bounds;
+
+		FTestGraph()
+		{
+			Graph = NewObject<UEdGraph>(GetTransientPackage());
+		}
+
+		int32 AddNode(const FSlateRect& NodeBounds)
+		{
+			UEdGraphNode* Node = NewObject<UEdGraphNode_Comment>(Graph);
+			Node->NodePosX = FMath::RoundToInt(NodeBounds.Left);
+			Node->NodePosY = FMath::RoundToInt(NodeBounds.Top);
+			Bounds.Add(NodeBounds);
+			return Nodes.Add(Node);
+		}
+
+		/** Lay out nodes in columns, roughly how the formatter lays out exec chains */
+		void AddColumns(int32 NumNodes, FRandomStream& Random)
+		{
+			const int32 NodesPerColumn = GetNodesPerColumn(NumNodes);
+			float ColumnX = 0.0f;
+			float ColumnWidth = 0.0f;
+			float NextY = 0.0f;
+			for (int32 i = 0; i < NumNodes; ++i)
+			{
+				if (i % NodesPerColumn == 0)
+				{
+					ColumnX += ColumnWidth + 80.0f;
+					ColumnWidth = 0.0f;
+					NextY = 0.0f;
+				}
+
+				const FVector2D Size(Random.FRandRange(120.0f, 450.0f), Random.FRandRange(60.0f, 320.0f));
+				AddNode(FSlateRect(ColumnX, NextY, ColumnX + Size.X, NextY + Size.Y));
+
+				ColumnWidth = FMath::Max(ColumnWidth, Size.X);
+				NextY += Size.Y + 30.0f;
+			}
+		}
+
+		void BuildGrid(FBANodeSpatialGrid& Grid) const
+		{
+			for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+			{
+				Grid.UpdateNode(Nodes[NodeIndex], Bounds[NodeIndex]);
+			}
+		}
+
+		/** Expected result, every node is tested */
+		bool AnyNodeIntersectsLine(const FVector2D& Start, const FVector2D& End, const FMargin& Extend, int32 IgnoredA, int32 IgnoredB) const
+		{
+			for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+			{
+				if (NodeIndex != IgnoredA && NodeIndex != IgnoredB && FBAUtils::LineRectIntersection(Bounds[NodeIndex].ExtendBy(Extend), Start, End))
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		static int32 GetNodesPerColumn(int32 NumNodes)
+		{
+			return FMath::Max(1, FMath::RoundToInt(FMath::Sqrt(static_cast<float>(NumNodes))));
+		}
+	};
+
+	struct FLineQuery
+	{
+		FVector2D Start;
+		FVector2D End;
+		int32 NodeA;
+		int32 NodeB;
+	};
+
+	/** Segments between pins of nodes a few columns apart, mostly horizontal like knot tracks */
+	static void MakeQueries(const FTestGraph& TestGraph, int32 NumQueries, FRandomStream& Random, TArray<FLineQuery>& OutQueries)
+	{
+		const int32 NumNodes = TestGraph.Nodes.Num();
+		const int32 NodesPerColumn = FTestGraph::GetNodesPerColumn(NumNodes);
+
+		OutQueries.Reserve(NumQueries);
+		for (int32 i = 0; i < NumQueries; ++i)
+		{
+			const int32 NodeA = Random.RandRange(0, NumNodes - 1);
+			const int32 NodeB = FMath::Clamp(NodeA + Random.RandRange(1, 3) * NodesPerColumn + Random.RandRange(-5, 5), 0, NumNodes - 1);
+			const FSlateRect& A = TestGraph.Bounds[NodeA];
+			const FSlateRect& B = TestGraph.Bounds[NodeB];
+			const float StartY = Random.FRandRange(A.Top, A.Bottom);
+			const float EndY = Random.FRand() < 0.5f ? StartY : Random.FRandRange(B.Top, B.Bottom);
+			OutQueries.Add({ FVector2D(A.Right, StartY), FVector2D(B.Left, EndY), NodeA, NodeB });
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBANodeSpatialGridQueryTest, "BlueprintAssist.SpatialGrid.Queries",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FBANodeSpatialGridQueryTest::RunTest(const FString& Parameters)
+{
+	using namespace BANodeSpatialGridTests;
+
+	FTestGraph TestGraph;
+	const int32 Left = TestGraph.AddNode(FSlateRect(0.0f, 0.0f, 200.0f, 100.0f));
+	const int32 Middle = TestGraph.AddNode(FSlateRect(600.0f, 0.0f, 800.0f, 100.0f));
+	const int32 Right = TestGraph.AddNode(FSlateRect(1200.0f, 0.0f, 1400.0f, 100.0f));
+
+	FBANodeSpatialGrid Grid;
+	TestGraph.BuildGrid(Grid);
+	TestEqual("All nodes are added", Grid.Num(), 3);
+
+	UEdGraphNode* LeftNode = TestGraph.Nodes[Left];
+	UEdGraphNode* MiddleNode = TestGraph.Nodes[Middle];
+	UEdGraphNode* RightNode = TestGraph.Nodes[Right];
+	const FMargin Extend(0, 7);
+
+	TestTrue("Line through a node hits it", Grid.AnyNodeIntersectsLine(FVector2D(200.0f, 50.0f), FVector2D(1200.0f, 50.0f), Extend, LeftNode, RightNode));
+	TestFalse("Line through ignored nodes only misses", Grid.AnyNodeIntersectsLine(FVector2D(100.0f, 50.0f), FVector2D(700.0f, 50.0f), Extend, LeftNode, MiddleNode));
+	TestFalse("Line above every node misses", Grid.AnyNodeIntersectsLine(FVector2D(200.0f, -20.0f), FVector2D(1200.0f, -20.0f), Extend, LeftNode, RightNode));
+	TestTrue("Line within the margin hits", Grid.AnyNodeIntersectsLine(FVector2D(200.0f, -5.0f), FVector2D(1200.0f, -5.0f), Extend, LeftNode, RightNode));
+
+	// moving the middle node out of the way must re-bin it
+	Grid.UpdateNode(MiddleNode, FSlateRect(600.0f, 500.0f, 800.0f, 600.0f));
+	TestEqual("Moved node is not added twice", Grid.Num(), 3);
+	TestFalse("Moved node no longer hits", Grid.AnyNodeIntersectsLine(FVector2D(200.0f, 50.0f), FVector2D(1200.0f, 50.0f), Extend, LeftNode, RightNode));
+	TestTrue("Moved node hits at its new bounds", Grid.AnyNodeIntersectsLine(FVector2D(200.0f, 550.0f), FVector2D(1200.0f, 550.0f), Extend, LeftNode, RightNode));
+
+	TArray<UEdGraphNode*> NodesInBounds;
+	Grid.GatherNodesInBounds(FSlateRect(-1000.0f, -1000.0f, 3000.0f, 3000.0f), NodesInBounds);
+	TestEqual("Every node is gathered once", NodesInBounds.Num(), 3);
+
+	Grid.Reset();
+	TestEqual("Reset removes every node", Grid.Num(), 0);
+	TestFalse("Reset grid never hits", Grid.AnyNodeIntersectsLine(FVector2D(200.0f, 50.0f), FVector2D(1200.0f, 50.0f), Extend));
+	return true;
+}
+
+/**
+ * Random knot track queries over a large graph, checked against testing every node.
+ * Reports the time spent by the grid, run it from the session frontend with the stress filter.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBANodeSpatialGridStressTest, "BlueprintAssist.SpatialGrid.Stress",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter)
+
+bool FBANodeSpatialGridStressTest::RunTest(const FString& Parameters)
+{
+	using namespace BANodeSpatialGridTests;
+
+	constexpr int32 NumNodes = 2000;
+	constexpr int32 NumQueries = 50000;
+
+	FRandomStream Random(1);
+	FTestGraph TestGraph;
+	TestGraph.AddColumns(NumNodes, Random);
+
+	TArray<FLineQuery> Queries;
+	MakeQueries(TestGraph, NumQueries, Random, Queries);
+
+	const FMargin Extend(0, 7);
+
+	const double BuildStart = FPlatformTime::Seconds();
+	FBANodeSpatialGrid Grid;
+	TestGraph.BuildGrid(Grid);
+	const double BuildTime = FPlatformTime::Seconds() - BuildStart;
+
+	TArray<bool> GridHits;
+	GridHits.SetNumUninitialized(NumQueries);
+	const double QueryStart = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumQueries; ++i)
+	{
+		const FLineQuery& Query = Queries[i];
+		GridHits[i] = Grid.AnyNodeIntersectsLine(Query.Start, Query.End, Extend, TestGraph.Nodes[Query.NodeA], TestGraph.Nodes[Query.NodeB]);
+	}
+	const double QueryTime = FPlatformTime::Seconds() - QueryStart;
+
+	int32 NumMismatches = 0;
+	for (int32 i = 0; i < NumQueries; ++i)
+	{
+		const FLineQuery& Query = Queries[i];
+		if (GridHits[i] != TestGraph.AnyNodeIntersectsLine(Query.Start, Query.End, Extend, Query.NodeA, Query.NodeB))
+		{
+			++NumMismatches;
+		}
+	}
+	TestEqual("Grid matches testing every node", NumMismatches, 0);
+
+	// move a tenth of the nodes down, as expanding knot tracks does
+	const double UpdateStart = FPlatformTime::Seconds();
+	for (int32 NodeIndex = 0; NodeIndex < NumNodes; NodeIndex += 10)
+	{
+		TestGraph.Bounds[NodeIndex] = TestGraph.Bounds[NodeIndex].OffsetBy(FVector2D(0.0f, 64.0f));
+		Grid.UpdateNode(TestGraph.Nodes[NodeIndex], TestGraph.Bounds[NodeIndex]);
+	}
+	const double UpdateTime = FPlatformTime::Seconds() - UpdateStart;
+
+	NumMismatches = 0;
+	for (const FLineQuery& Query : Queries)
+	{
+		const bool bGridHit = Grid.AnyNodeIntersectsLine(Query.Start, Query.End, Extend, TestGraph.Nodes[Query.NodeA], TestGraph.Nodes[Query.NodeB]);
+		if (bGridHit != TestGraph.AnyNodeIntersectsLine(Query.Start, Query.End, Extend, Query.NodeA, Query.NodeB))
+		{
+			++NumMismatches;
+		}
+	}
+	TestEqual("Grid matches testing every node after moving nodes", NumMismatches, 0);
+
+	AddInfo(FString::Printf(TEXT("Nodes %d | Queries %d | Queries %.2f ms | Build %.2f ms | Update %d nodes %.2f ms"),
+		NumNodes, NumQueries, QueryTime * 1000.0, BuildTime * 1000.0, FMath::DivideAndRoundUp(NumNodes, 10), UpdateTime * 1000.0));
+	return true;
+}
+
+#endif
@@ -90,6 +90,27 @@ struct BLUEPRINTASSIST_API FBAGraphData
 	bool bTriedLoadingMetaData = false;
 };
 
+/**
+ * Measured size of a node, shared by every node in the package with the same class and size signature.
+ * Pins are stored by index since pin guids are unique to each node.
+ */
+USTRUCT()
+struct BLUEPRINTASSIST_API FBANodeSizeTemplate
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY()
+	FIntPoint Size = FIntPoint(0, 0); // node size
+
+	UPROPERTY()
+	TMap<int32, float> Pins; // pin index -> pin offset
+
+	bool IsValid() const
+	{
+		return Size.X != 0 && Size.Y != 0;
+	}
+};
+
 USTRUCT()
 struct BLUEPRINTASSIST_API FBAPackageData
 {
@@ -97,6 +118,9 @@ struct BLUEPRINTASSIST_API FBAPackageData
 
 	UPROPERTY()
 	TMap<FGuid, FBAGraphData> GraphData; // graph guid -> graph data
+
+	UPROPERTY()
+	TMap<FString, FBANodeSizeTemplate> SizeTemplates; // size template key -> measured size
 };
 
 USTRUCT()
@@ -136,6 +160,11 @@ public:
 
 	FBAGraphData& GetGraphData(UEdGraph* Graph);
 
+	const FBANodeSizeTemplate* FindNodeSizeTemplate(UEdGraph* Graph, const FString& TemplateKey);
+	void SetNodeSizeTemplate(UEdGraph* Graph, const FString& TemplateKey, const FBANodeSizeTemplate& SizeTemplate);
+	void RemoveNodeSizeTemplate(UEdGraph* Graph, const FString& TemplateKey);
+	void ClearNodeSizeTemplates(UEdGraph* Graph);
+
 	FString GetProjectSavedCachePath(bool bFullPath = false);
 	FString GetPluginCachePath(bool bFullPath = false);
 	FString GetCachePath(bool bFullPath = false);
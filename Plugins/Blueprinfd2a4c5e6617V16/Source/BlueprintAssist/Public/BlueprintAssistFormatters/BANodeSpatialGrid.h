@@ -0,0 +1,62 @@
+// Copyright fpwong. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FBAGraphHandler;
+class UEdGraphNode;
+
+/**
+ * Uniform grid over node bounds, used to avoid testing every formatted node when checking for collisions.
+ * Built once per format pass, nodes which have moved since they were added can be re-binned with UpdateMovedNodes.
+ */
+class BLUEPRINTASSIST_API FBANodeSpatialGrid
+{
+public:
+	explicit FBANodeSpatialGrid(float InCellSize = 256.0f);
+
+	/** Clear the grid and add all nodes using their cached bounds */
+	void Build(TSharedPtr<FBAGraphHandler> InGraphHandler, const TSet<UEdGraphNode*>& Nodes);
+
+	void Reset();
+
+	/** Add or re-bin a node with the given bounds */
+	void UpdateNode(UEdGraphNode* Node, const FSlateRect& Bounds);
+
+	/** Re-bin any node whose cached bounds changed since it was last added. Requires the grid to be built with a graph handler. */
+	void UpdateMovedNodes();
+
+	/** Returns true if the line intersects any node (with bounds extended by the margin) that is not ignored */
+	bool AnyNodeIntersectsLine(const FVector2D& Start, const FVector2D& End, const FMargin& Extend, const UEdGraphNode* IgnoredA = nullptr, const UEdGraphNode* IgnoredB = nullptr) const;
+
+	/** Collect all nodes whose cells overlap the query bounds, each node is returned at most once */
+	void GatherNodesInBounds(const FSlateRect& QueryBounds, TArray<UEdGraphNode*>& OutNodes) const;
+
+	int32 Num() const { return Entries.Num(); }
+
+private:
+	struct FEntry
+	{
+		UEdGraphNode* Node = nullptr;
+		FSlateRect Bounds;
+		FIntRect Cells;
+		mutable uint32 LastQueryId = 0;
+	};
+
+	FIntRect GetCellRange(const FSlateRect& Bounds) const;
+	void AddToCells(int32 EntryIndex);
+	void RemoveFromCells(int32 EntryIndex);
+
+	/** Iterate every unique entry overlapping the bounds, stopping early if the callback returns true */
+	bool ForEachEntryInBounds(const FSlateRect& QueryBounds, TFunctionRef<bool(const FEntry&)> Callback) const;
+
+	TSharedPtr<FBAGraphHandler> GraphHandler;
+
+	float CellSize;
+	TArray<FEntry> Entries;
+	TMap<UEdGraphNode*, int32> EntryIndices;
+	TMap<FIntPoint, TArray<int32>> Cells;
+
+	mutable uint32 QueryId = 0;
+};
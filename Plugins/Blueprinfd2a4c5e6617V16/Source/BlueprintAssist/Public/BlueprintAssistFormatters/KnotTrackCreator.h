@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 
+#include "BANodeSpatialGrid.h"
 #include "KnotTrack.h"
 
 struct FCommentHandler;
@@ -35,6 +36,9 @@ class FKnotTrackCreator final
 	TMap<UK2Node_Knot*, TSharedPtr<FKnotNodeCreation>> KnotCreationMap; 
 	TArray<TSharedPtr<FGroupedTracks>> TrackGroups;
 
+	/** Spatial index over the formatted nodes, rebuilt each time we format knot nodes */
+	FBANodeSpatialGrid NodeGrid;
+
 	FIntPoint PinPadding;
 	FIntPoint NodePadding;
 	int TrackSpacing;
@@ -74,13 +78,13 @@ private:
 
 	void CreateKnotTracks();
 
-	bool TryAlignTrackToEndPins(TSharedPtr<FKnotNodeTrack> Track, const TArray<UEdGraphNode*>& AllNodes);
+	bool TryAlignTrackToEndPins(TSharedPtr<FKnotNodeTrack> Track);
 
 	bool DoesPinNeedTrack(UEdGraphPin* Pin, const TArray<UEdGraphPin*>& LinkedTo);
 
 	bool AnyCollisionBetweenPins(UEdGraphPin* Pin, UEdGraphPin* OtherPin);
 
-	bool NodeCollisionBetweenLocation(FVector2D Start, FVector2D End, TSet<UEdGraphNode*> IgnoredNodes);
+	bool NodeCollisionBetweenLocation(const FVector2D& Start, const FVector2D& End, const UEdGraphNode* IgnoredA, const UEdGraphNode* IgnoredB) const;
 
 	UK2Node_Knot* CreateKnotNode(FKnotNodeCreation* Creation, const FVector2D& Position, UEdGraphPin* ParentPin);
 
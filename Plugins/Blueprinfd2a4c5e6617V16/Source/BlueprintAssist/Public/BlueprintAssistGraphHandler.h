@@ -293,6 +293,12 @@ private:
 
 	bool CacheNodeSize(UEdGraphNode* Node);
 
+	/** Apply the size measured for an identical node in this asset, returns false if the node still needs to be measured */
+	bool TryApplyNodeSizeTemplate(UEdGraphNode* Node);
+
+	/** Share the cached size of a node with other identical nodes in this asset */
+	void StoreNodeSizeTemplate(UEdGraphNode* Node);
+
 	bool UpdateNodeSizesChanges(const TArray<UEdGraphNode*>& Nodes);
 
 	void AutoLerpToNewlyCreatedNode(UEdGraphNode* Node);
@@ -69,9 +69,15 @@ public:
 
 	virtual bool HasNodeChanged(UEdGraphNode* Node) const;
 
-	FString GetPropertyAccessTextPath(UEdGraphNode* Node) const;
+	static FString GetPropertyAccessTextPath(UEdGraphNode* Node);
 
 	static TSet<FGuid> GetParentComments(UEdGraphNode* Node);
+
+	/**
+	 * Key for sharing a measured size between nodes, made from the node class and a hash of everything listed above.
+	 * Returns an empty string for nodes whose size can't be shared (comments, or nodes showing a comment bubble).
+	 */
+	static FString GetSizeTemplateKey(UEdGraphNode* Node);
 };
 
 class FBAFormattingChangeData : public FBANodeSizeChangeData
@@ -50,6 +50,10 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Cache")
 	bool bSlowButAccurateSizeCaching;
 
+	/* Reuse the measured size of a node for other nodes in the same asset with the same class, title and pins, instead of zooming to each one */
+	UPROPERTY(EditAnywhere, config, Category = "Cache")
+	bool bShareNodeSizesBetweenIdenticalNodes;
+
 	/* If swapping produced any looping wires, remove them */
 	UPROPERTY(EditAnywhere, config, Category = "Commands|Swap Nodes")
 	bool bRemoveLoopingCausedBySwapping;
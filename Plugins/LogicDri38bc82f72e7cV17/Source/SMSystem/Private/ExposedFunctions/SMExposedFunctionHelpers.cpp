@@ -4,6 +4,11 @@
 
 #include "SMInstance.h"
 #include "SMNodeInstance.h"
+#include "SMConduitInstance.h"
+#include "SMStateInstance.h"
+#include "SMTransitionInstance.h"
+
+#include "Misc/ScopeRWLock.h"
 
 namespace LD
 {
@@ -27,6 +32,29 @@ namespace LD
 		{
 			return FunctionHandler->ExecutionType == ESMExposedFunctionExecutionType::SM_NodeInstance ? NodeInstanceClass : InstanceClass;
 		}
+
+		static TMap<const UFunction*, FSMNativeExposedFunction>& GetNativeFunctions()
+		{
+			static TMap<const UFunction*, FSMNativeExposedFunction> NativeFunctions;
+			return NativeFunctions;
+		}
+
+		/** Handlers may initialize during async state machine initialization. */
+		static FRWLock& GetNativeFunctionsLock()
+		{
+			static FRWLock NativeFunctionsLock;
+			return NativeFunctionsLock;
+		}
+
+		/** The node instance runtime functions graphs can bind to directly. */
+		static void RegisterNodeInstanceNativeFunctions()
+		{
+			USMNodeInstance::RegisterNativeExposedFunctions();
+			USMStateInstance_Base::RegisterNativeExposedFunctions();
+			USMStateInstance::RegisterNativeExposedFunctions();
+			USMTransitionInstance::RegisterNativeExposedFunctions();
+			USMConduitInstance::RegisterNativeExposedFunctions();
+		}
 	}
 }
 
@@ -74,4 +102,28 @@ void LD::ExposedFunctions::ExecuteGraphFunctions(const TArray<FSMExposedFunction
 	}
 }
 
+void LD::ExposedFunctions::RegisterNativeFunction(const UClass* InClass, FName InFunctionName, FSMNativeExposedFunction InNativeFunction)
+{
+	check(InClass && InNativeFunction);
+	const UFunction* Function = InClass->FindFunctionByName(InFunctionName);
+	if (ensureMsgf(Function && Function->HasAnyFunctionFlags(FUNC_Native), TEXT("%s is not a native function of %s."), *InFunctionName.ToString(), *InClass->GetName()))
+	{
+		FWriteScopeLock WriteLock(GetNativeFunctionsLock());
+		GetNativeFunctions().Add(Function, InNativeFunction);
+	}
+}
+
+FSMNativeExposedFunction LD::ExposedFunctions::FindNativeFunction(const UFunction* InFunction)
+{
+	static const bool bNodeInstanceFunctionsRegistered = (RegisterNodeInstanceNativeFunctions(), true);
+	(void)bNodeInstanceFunctionsRegistered;
 
+	if (!InFunction || !InFunction->HasAnyFunctionFlags(FUNC_Native))
+	{
+		return nullptr;
+	}
+
+	FReadScopeLock ReadLock(GetNativeFunctionsLock());
+	const FSMNativeExposedFunction* NativeFunction = GetNativeFunctions().Find(InFunction);
+	return NativeFunction ? *NativeFunction : nullptr;
+}
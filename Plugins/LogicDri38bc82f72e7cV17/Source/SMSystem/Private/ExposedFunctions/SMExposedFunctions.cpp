@@ -1,6 +1,7 @@
 // Copyright Recursoft LLC. All Rights Reserved.
 
 #include "ExposedFunctions/SMExposedFunctions.h"
+#include "ExposedFunctions/SMExposedFunctionHelpers.h"
 
 #include "SMConduit.h"
 #include "SMLogging.h"
@@ -8,6 +9,9 @@
 
 #include "Algo/Transform.h"
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Exposed Function Native Calls"), STAT_SMExposedFunction_NativeCalls, STATGROUP_LogicDriver);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Exposed Function ProcessEvent Calls"), STAT_SMExposedFunction_ProcessEventCalls, STATGROUP_LogicDriver);
+
 void FSMExposedFunctionHandler::Initialize(const UClass* InClass)
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("SMExposedFunctionHandler::Initialize"), STAT_SMExposedFunctionHandler_Initialize, STATGROUP_LogicDriver);
@@ -30,6 +34,8 @@ void FSMExposedFunctionHandler::Initialize(const UClass* InClass)
 			Function = nullptr;
 		}
 	}
+
+	NativeFunction = Function ? LD::ExposedFunctions::FindNativeFunction(Function) : nullptr;
 }
 
 void FSMExposedFunctionHandler::Execute(UObject* InObject, void* InParams) const
@@ -41,6 +47,14 @@ void FSMExposedFunctionHandler::Execute(UObject* InObject, void* InParams) const
 		return;
 	}
 
+	if (NativeFunction)
+	{
+		INC_DWORD_STAT(STAT_SMExposedFunction_NativeCalls);
+		NativeFunction(InObject, InParams);
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_SMExposedFunction_ProcessEventCalls);
 	InObject->ProcessEvent(Function, InParams);
 }
 
@@ -1,6 +1,7 @@
 // Copyright Recursoft LLC. All Rights Reserved.
 
 #include "SMNodeInstance.h"
+#include "ExposedFunctions/SMExposedFunctionHelpers.h"
 #include "ISMEditorGraphNodeInterface.h"
 #include "SMCustomVersion.h"
 #include "SMInstance.h"
@@ -35,7 +36,8 @@ void USMCompilerLog::LogProperty(FName PropertyName, const USMNodeInstance* Node
 }
 
 USMNodeInstance::USMNodeInstance() : Super(), bEvalDefaultProperties(true), bAutoEvalExposedProperties(true),
-                                     bResetVariablesOnInitialize(false), bBlockInput(false), RunInitializedFrame(0), bIsInitialized(false), OwningNode(nullptr)
+                                     bEvalGraphPropertiesOnSourceChange(false), bResetVariablesOnInitialize(false), bBlockInput(false),
+                                     RunInitializedFrame(0), bIsInitialized(false), NumSkippedGraphPropertyEvaluations(0), OwningNode(nullptr)
 {
 	INC_DWORD_STAT(STAT_NodeInstances)
 
@@ -59,6 +61,14 @@ USMNodeInstance::USMNodeInstance() : Super(), bEvalDefaultProperties(true), bAut
 #endif
 }
 
+void USMNodeInstance::RegisterNativeExposedFunctions()
+{
+	LD::ExposedFunctions::RegisterNativeFunction(StaticClass(), GET_FUNCTION_NAME_CHECKED(USMNodeInstance, OnRootStateMachineStart),
+		[](UObject* InObject, void* InParams) { static_cast<USMNodeInstance*>(InObject)->OnRootStateMachineStart_Implementation(); });
+	LD::ExposedFunctions::RegisterNativeFunction(StaticClass(), GET_FUNCTION_NAME_CHECKED(USMNodeInstance, OnRootStateMachineStop),
+		[](UObject* InObject, void* InParams) { static_cast<USMNodeInstance*>(InObject)->OnRootStateMachineStop_Implementation(); });
+}
+
 void USMNodeInstance::Serialize(FArchive& Ar)
 {
 	UObject::Serialize(Ar);
@@ -17,6 +17,9 @@
 
 #define LOGICDRIVER_FUNCTION_HANDLER_TYPE FSMNode_FunctionHandlers
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Default Graph Properties Skipped"), STAT_SMNode_Base_DefaultPropertiesSkipped, STATGROUP_LogicDriver);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Unchanged Graph Properties Skipped"), STAT_SMNode_Base_UnchangedPropertiesSkipped, STATGROUP_LogicDriver);
+
 #if WITH_EDITORONLY_DATA
 bool FSMNode_Base::bValidateGuids = false;
 #endif
@@ -521,14 +524,29 @@ void FSMNode_Base::ExecuteGraphProperties(USMNodeInstance* ForNodeInstance, cons
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("SMNode_Base::ExecuteGraphProperties"), STAT_SMNode_Base_ExecuteGraphProperties, STATGROUP_LogicDriver);
 	
 	bool bCanEvalDefaultProperties = ForNodeInstance ? ForNodeInstance->bEvalDefaultProperties : true;
+	const bool bEvalOnSourceChange = ForNodeInstance ? ForNodeInstance->bEvalGraphPropertiesOnSourceChange : false;
 	
-	auto EvaluateProperties = [bCanEvalDefaultProperties](FSMGraphPropertyTemplateOwner* TemplateOwner)
+	auto EvaluateProperties = [ForNodeInstance, bCanEvalDefaultProperties, bEvalOnSourceChange](FSMGraphPropertyTemplateOwner* TemplateOwner)
 	{
 		for (FSMGraphProperty_Base_Runtime& GraphProperty : TemplateOwner->VariableGraphProperties)
 		{
-			if (bCanEvalDefaultProperties || !GraphProperty.GetIsDefaultValueOnly())
+			if (!bCanEvalDefaultProperties && GraphProperty.GetIsDefaultValueOnly())
+			{
+				INC_DWORD_STAT(STAT_SMNode_Base_DefaultPropertiesSkipped);
+			}
+			else if (!bEvalOnSourceChange)
+			{
+				GraphProperty.Execute();
+			}
+			else if (GraphProperty.HaveSourcesChanged())
 			{
 				GraphProperty.Execute();
+				GraphProperty.RecordEvaluatedSources();
+			}
+			else
+			{
+				INC_DWORD_STAT(STAT_SMNode_Base_UnchangedPropertiesSkipped);
+				ForNodeInstance->NumSkippedGraphPropertyEvaluations++;
 			}
 		}
 	};
@@ -551,9 +569,11 @@ void FSMNode_Base::ExecuteGraphProperties(USMNodeInstance* ForNodeInstance, cons
 
 void FSMNode_Base::TryResetVariables()
 {
+	bool bReset = false;
 	if (NodeInstance && NodeInstance->GetResetVariablesOnInitialize())
 	{
 		NodeInstance->ResetVariables();
+		bReset = true;
 	}
 	
 	for (USMNodeInstance* StackInstance : StackNodeInstances)
@@ -561,6 +581,19 @@ void FSMNode_Base::TryResetVariables()
 		if (StackInstance->GetResetVariablesOnInitialize())
 		{
 			StackInstance->ResetVariables();
+			bReset = true;
+		}
+	}
+
+	if (bReset)
+	{
+		// Reset values need to be evaluated again even if their sources haven't changed.
+		for (TTuple<FGuid, FSMGraphPropertyTemplateOwner>& TemplateGraphProperty : TemplateVariableGraphProperties)
+		{
+			for (FSMGraphProperty_Base_Runtime& GraphProperty : TemplateGraphProperty.Value.VariableGraphProperties)
+			{
+				GraphProperty.ResetEvaluatedSources();
+			}
 		}
 	}
 }
@@ -2,11 +2,15 @@
 
 #include "SMConduit.h"
 #include "SMConduitInstance.h"
+#include "SMLogging.h"
 #include "SMUtils.h"
 #include "ExposedFunctions/SMExposedFunctionDefines.h"
+#include "ExposedFunctions/SMExposedFunctionHelpers.h"
 
 #define LOGICDRIVER_FUNCTION_HANDLER_TYPE FSMConduit_FunctionHandlers
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Conduit Constant Conditions Skipped"), STAT_SMConduit_ConstantConditions, STATGROUP_LogicDriver);
+
 FSMConduit::FSMConduit() : Super(), bCanEnterTransition(false), bCanEvaluate(true), bEvalWithTransitions(false),
                            ConditionalEvaluationType(),
                            bIsEvaluating(false), bCheckedForTransitions(false)
@@ -29,6 +33,10 @@ void FSMConduit::InitializeGraphFunctions()
 
 	INITIALIZE_EXPOSED_FUNCTIONS(CanEnterConduitGraphEvaluator);
 	INITIALIZE_EXPOSED_FUNCTIONS(ConduitEnteredGraphEvaluator);
+
+	const UClass* InstanceClass = GetNodeInstanceClass();
+	NativeCanEnterTransition = ConditionalEvaluationType == ESMConditionalEvaluationType::SM_NodeInstance && InstanceClass ?
+		LD::ExposedFunctions::FindNativeFunction(InstanceClass->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(USMConduitInstance, CanEnterTransition))) : nullptr;
 }
 
 void FSMConduit::Reset()
@@ -161,11 +169,22 @@ bool FSMConduit::GetValidTransition(TArray<TArray<FSMTransition*>>& Transitions)
 	if (ConditionalEvaluationType == ESMConditionalEvaluationType::SM_AlwaysTrue)
 	{
 		// Skip BP graph eval if not needed.
+		INC_DWORD_STAT(STAT_SMConduit_ConstantConditions);
 		bCanEnterTransition = true;
 	}
 	else if (ConditionalEvaluationType == ESMConditionalEvaluationType::SM_NodeInstance)
 	{
-		bCanEnterTransition = CastChecked<USMConduitInstance>(GetOrCreateNodeInstance())->CanEnterTransition();
+		USMConduitInstance* ConduitInstance = CastChecked<USMConduitInstance>(GetOrCreateNodeInstance());
+		if (NativeCanEnterTransition)
+		{
+			bool bResult = false;
+			NativeCanEnterTransition(ConduitInstance, &bResult);
+			bCanEnterTransition = bResult;
+		}
+		else
+		{
+			bCanEnterTransition = ConduitInstance->CanEnterTransition();
+		}
 	}
 	else
 	{
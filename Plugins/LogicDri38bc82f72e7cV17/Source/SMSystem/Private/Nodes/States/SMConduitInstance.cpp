@@ -2,6 +2,7 @@
 
 #include "SMConduitInstance.h"
 
+#include "ExposedFunctions/SMExposedFunctionHelpers.h"
 #include "SMConduit.h"
 
 USMConduitInstance::USMConduitInstance() : Super(), bEvalGraphsOnInitialize(true), bEvalGraphsOnTransitionEval(true),
@@ -9,6 +10,25 @@ USMConduitInstance::USMConduitInstance() : Super(), bEvalGraphsOnInitialize(true
 {
 }
 
+void USMConduitInstance::RegisterNativeExposedFunctions()
+{
+	LD::ExposedFunctions::RegisterNativeFunction(StaticClass(), GET_FUNCTION_NAME_CHECKED(USMConduitInstance, CanEnterTransition),
+		[](UObject* InObject, void* InParams)
+		{
+			const bool bResult = static_cast<USMConduitInstance*>(InObject)->CanEnterTransition_Implementation();
+			if (InParams)
+			{
+				*static_cast<bool*>(InParams) = bResult;
+			}
+		});
+	LD::ExposedFunctions::RegisterNativeFunction(StaticClass(), GET_FUNCTION_NAME_CHECKED(USMConduitInstance, OnConduitEntered),
+		[](UObject* InObject, void* InParams) { static_cast<USMConduitInstance*>(InObject)->OnConduitEntered_Implementation(); });
+	LD::ExposedFunctions::RegisterNativeFunction(StaticClass(), GET_FUNCTION_NAME_CHECKED(USMConduitInstance, OnConduitInitialized),
+		[](UObject* InObject, void* InParams) { static_cast<USMConduitInstance*>(InObject)->OnConduitInitialized_Implementation(); });
+	LD::ExposedFunctions::RegisterNativeFunction(StaticClass(), GET_FUNCTION_NAME_CHECKED(USMConduitInstance, OnConduitShutdown),
+		[](UObject* InObject, void* InParams) { static_cast<USMConduitInstance*>(InObject)->OnConduitShutdown_Implementation(); });
+}
+
 void USMConduitInstance::SetCanEvaluate(const bool bValue)
 {
 	SET_NODE_DEFAULT_VALUE(FSMConduit, bCanEvaluate, bValue);
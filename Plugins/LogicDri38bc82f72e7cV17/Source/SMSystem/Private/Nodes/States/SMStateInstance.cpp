@@ -2,6 +2,7 @@
 
 #include "SMStateInstance.h"
 
+#include "ExposedFunctions/SMExposedFunctionHelpers.h"
 #include "ISMEditorGraphNodeInterface.h"
 #include "SMInstance.h"
 #include "SMLogging.h"
@@ -33,6 +34,19 @@ USMStateInstance_Base::USMStateInstance_Base() : Super(),
 #endif
 }
 
+void USMStateInstance_Base::RegisterNativeExposedFunctions()
+{
+	LD::ExposedFunctions::RegisterNativeFunction(StaticClass(), GET_FUNCTION_NAME_CHECKED(USMStateInstance_Base, OnStateBegin),
+		[](UObject* InObject, void* InParams) { static_cast<USMStateInstance_Base*>(InObject)->OnStateBegin_Implementation(); });
+	LD::ExposedFunctions::RegisterNativeFunction(StaticClass(), GET_FUNCTION_NAME_CHECKED(USMStateInstance_Base, OnStateUpdate),
+		[](UObject* InObject, void* InParams)
+		{
+			static_cast<USMStateInstance_Base*>(InObject)->OnStateUpdate_Implementation(InParams ? *static_cast<float*>(InParams) : 0.f);
+		});
+	LD::ExposedFunctions::RegisterNativeFunction(StaticClass(), GET_FUNCTION_NAME_CHECKED(USMStateInstance_Base, OnStateEnd),
+		[](UObject* InObject, void* InParams) { static_cast<USMStateInstance_Base*>(InObject)->OnStateEnd_Implementation(); });
+}
+
 bool USMStateInstance_Base::IsInEndState() const
 {
 	if (const FSMState_Base* State = (FSMState_Base*)GetOwningNode())
@@ -619,6 +633,14 @@ USMStateInstance::USMStateInstance() : Super()
 {
 }
 
+void USMStateInstance::RegisterNativeExposedFunctions()
+{
+	LD::ExposedFunctions::RegisterNativeFunction(StaticClass(), GET_FUNCTION_NAME_CHECKED(USMStateInstance, OnStateInitialized),
+		[](UObject* InObject, void* InParams) { static_cast<USMStateInstance*>(InObject)->OnStateInitialized_Implementation(); });
+	LD::ExposedFunctions::RegisterNativeFunction(StaticClass(), GET_FUNCTION_NAME_CHECKED(USMStateInstance, OnStateShutdown),
+		[](UObject* InObject, void* InParams) { static_cast<USMStateInstance*>(InObject)->OnStateShutdown_Implementation(); });
+}
+
 void USMStateInstance::GetAllStateStackInstances(TArray<USMStateInstance_Base*>& StateStackInstances) const
 {
 	StateStackInstances.Reset();
@@ -7,9 +7,12 @@
 #include "SMLogging.h"
 #include "SMUtils.h"
 #include "ExposedFunctions/SMExposedFunctionDefines.h"
+#include "ExposedFunctions/SMExposedFunctionHelpers.h"
 
 #define LOGICDRIVER_FUNCTION_HANDLER_TYPE FSMTransition_FunctionHandlers
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Transition Constant Conditions Skipped"), STAT_SMTransition_ConstantConditions, STATGROUP_LogicDriver);
+
 struct TransitionEvaluatorHelper
 {
 	TransitionEvaluatorHelper(FSMTransition* Transition)
@@ -79,6 +82,10 @@ void FSMTransition::InitializeGraphFunctions()
 	INITIALIZE_EXPOSED_FUNCTIONS(TransitionEnteredGraphEvaluator);
 	INITIALIZE_EXPOSED_FUNCTIONS(TransitionPreEvaluateGraphEvaluator);
 	INITIALIZE_EXPOSED_FUNCTIONS(TransitionPostEvaluateGraphEvaluator);
+
+	const UClass* InstanceClass = GetNodeInstanceClass();
+	NativeCanEnterTransition = ConditionalEvaluationType == ESMConditionalEvaluationType::SM_NodeInstance && InstanceClass ?
+		LD::ExposedFunctions::FindNativeFunction(InstanceClass->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(USMTransitionInstance, CanEnterTransition))) : nullptr;
 }
 
 void FSMTransition::Reset()
@@ -233,11 +240,22 @@ bool FSMTransition::DoesTransitionPass()
 		if (ConditionalEvaluationType == ESMConditionalEvaluationType::SM_AlwaysTrue)
 		{
 			// Skip BP graph eval if not needed.
+			INC_DWORD_STAT(STAT_SMTransition_ConstantConditions);
 			bCanEnterTransition = true;
 		}
 		else if (ConditionalEvaluationType == ESMConditionalEvaluationType::SM_NodeInstance)
 		{
-			bCanEnterTransition = CastChecked<USMTransitionInstance>(GetOrCreateNodeInstance())->CanEnterTransition();
+			USMTransitionInstance* TransitionInstance = CastChecked<USMTransitionInstance>(GetOrCreateNodeInstance());
+			if (NativeCanEnterTransition)
+			{
+				bool bResult = false;
+				NativeCanEnterTransition(TransitionInstance, &bResult);
+				bCanEnterTransition = bResult;
+			}
+			else
+			{
+				bCanEnterTransition = TransitionInstance->CanEnterTransition();
+			}
 		}
 		else
 		{
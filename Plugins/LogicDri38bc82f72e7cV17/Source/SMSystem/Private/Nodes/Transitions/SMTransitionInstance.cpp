@@ -2,6 +2,7 @@
 
 #include "SMTransitionInstance.h"
 
+#include "ExposedFunctions/SMExposedFunctionHelpers.h"
 #include "SMInstance.h"
 #include "SMStateInstance.h"
 #include "SMTransition.h"
@@ -19,6 +20,25 @@ USMTransitionInstance::USMTransitionInstance() : Super(), PriorityOrder(0), bRun
 #endif
 }
 
+void USMTransitionInstance::RegisterNativeExposedFunctions()
+{
+	LD::ExposedFunctions::RegisterNativeFunction(StaticClass(), GET_FUNCTION_NAME_CHECKED(USMTransitionInstance, CanEnterTransition),
+		[](UObject* InObject, void* InParams)
+		{
+			const bool bResult = static_cast<USMTransitionInstance*>(InObject)->CanEnterTransition_Implementation();
+			if (InParams)
+			{
+				*static_cast<bool*>(InParams) = bResult;
+			}
+		});
+	LD::ExposedFunctions::RegisterNativeFunction(StaticClass(), GET_FUNCTION_NAME_CHECKED(USMTransitionInstance, OnTransitionEntered),
+		[](UObject* InObject, void* InParams) { static_cast<USMTransitionInstance*>(InObject)->OnTransitionEntered_Implementation(); });
+	LD::ExposedFunctions::RegisterNativeFunction(StaticClass(), GET_FUNCTION_NAME_CHECKED(USMTransitionInstance, OnTransitionInitialized),
+		[](UObject* InObject, void* InParams) { static_cast<USMTransitionInstance*>(InObject)->OnTransitionInitialized_Implementation(); });
+	LD::ExposedFunctions::RegisterNativeFunction(StaticClass(), GET_FUNCTION_NAME_CHECKED(USMTransitionInstance, OnTransitionShutdown),
+		[](UObject* InObject, void* InParams) { static_cast<USMTransitionInstance*>(InObject)->OnTransitionShutdown_Implementation(); });
+}
+
 USMStateInstance_Base* USMTransitionInstance::GetPreviousStateInstance() const
 {
 	if (FSMTransition* Transition = (FSMTransition*)GetOwningNode())
@@ -10,8 +10,9 @@
 
 
 FSMGraphProperty_Base_Runtime::FSMGraphProperty_Base_Runtime(): GraphEvaluator(nullptr), LinkedProperty(nullptr),
-                                                                bIsDefaultValueOnly(0),
-                                                                OwningNode(nullptr)
+                                                                bIsDefaultValueOnly(0), bHasUntrackedSources(1),
+                                                                OwningNode(nullptr), EvaluatedSourceEpoch(0),
+                                                                bHasEvaluatedSources(0)
 {
 }
 
@@ -30,6 +31,8 @@ void FSMGraphProperty_Base_Runtime::Initialize(FSMNode_Base* InOwningNode)
 		LD::ExposedFunctions::InitializeGraphFunctions(*ExposedFunctionHandler, OwningNode->GetOwningInstance(), nullptr);
 		GraphEvaluator = ExposedFunctionHandler;
 	}
+
+	ResetEvaluatedSources();
 }
 
 void FSMGraphProperty_Base_Runtime::Execute(void* Params)
@@ -49,6 +52,54 @@ void FSMGraphProperty_Base_Runtime::Execute(void* Params)
 	}
 }
 
+void FSMGraphProperty_Base_Runtime::SetGraphSources(const TArray<FName>& InSourceVariables, bool bInHasUntrackedSources)
+{
+	SourceVariables = InSourceVariables;
+	bHasUntrackedSources = bInHasUntrackedSources;
+}
+
+bool FSMGraphProperty_Base_Runtime::HaveSourcesChanged() const
+{
+	// Linked properties execute a graph owned by another property.
+	if (!bHasEvaluatedSources || bHasUntrackedSources || LinkedProperty || !OwningNode)
+	{
+		return true;
+	}
+
+	const USMInstance* Instance = OwningNode->GetOwningInstance();
+	if (!Instance || Instance->GetGraphPropertySourceEpoch() != EvaluatedSourceEpoch)
+	{
+		return true;
+	}
+
+	for (int32 Idx = 0; Idx < SourceVariables.Num(); ++Idx)
+	{
+		if (Instance->GetGraphPropertySourceVersion(SourceVariables[Idx]) != EvaluatedSourceVersions[Idx])
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FSMGraphProperty_Base_Runtime::RecordEvaluatedSources()
+{
+	const USMInstance* Instance = OwningNode ? OwningNode->GetOwningInstance() : nullptr;
+	if (!Instance)
+	{
+		return;
+	}
+
+	EvaluatedSourceEpoch = Instance->GetGraphPropertySourceEpoch();
+	EvaluatedSourceVersions.SetNumUninitialized(SourceVariables.Num(), EAllowShrinking::No);
+	for (int32 Idx = 0; Idx < SourceVariables.Num(); ++Idx)
+	{
+		EvaluatedSourceVersions[Idx] = Instance->GetGraphPropertySourceVersion(SourceVariables[Idx]);
+	}
+	bHasEvaluatedSources = true;
+}
+
 const FGuid& FSMGraphProperty_Base_Runtime::SetGuid(const FGuid& NewGuid)
 {
 	Guid = NewGuid;
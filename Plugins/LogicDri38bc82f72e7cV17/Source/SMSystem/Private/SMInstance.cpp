@@ -2393,4 +2393,20 @@ void USMInstance::AddNonThreadSafeNode(FSMNode_Base* InNode)
 	NonThreadSafeNodes.Add(InNode);
 }
 
+void USMInstance::MarkGraphPropertySourceDirty(FName VariableName)
+{
+	++GraphPropertySourceVersions.FindOrAdd(VariableName);
+}
+
+void USMInstance::MarkAllGraphPropertySourcesDirty()
+{
+	++GraphPropertySourceEpoch;
+}
+
+uint32 USMInstance::GetGraphPropertySourceVersion(FName VariableName) const
+{
+	const uint32* Version = GraphPropertySourceVersions.Find(VariableName);
+	return Version ? *Version : 0;
+}
+
 #undef LOCTEXT_NAMESPACE
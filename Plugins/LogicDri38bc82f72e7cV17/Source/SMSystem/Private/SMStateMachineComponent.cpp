@@ -12,6 +12,7 @@
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Controller.h"
+#include "GameFramework/PlayerController.h"
 #include "LatentActions.h"
 #include "Net/UnrealNetwork.h"
 #include "TimerManager.h"
@@ -19,6 +20,11 @@
 
 #define LOCTEXT_NAMESPACE "SMStateMachineComponent"
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("SMStateMachineComponent Net Transaction Bytes"), STAT_SMStateMachineComponent_NetTransactionBytes, STATGROUP_LogicDriver);
+
+/** How often in seconds the server checks viewer distance for relevancy throttling. */
+#define SM_RELEVANCY_CHECK_INTERVAL 1.f
+
 /** When a multicast transaction is received either the server or client may choose to ignore it. */
 #define RETURN_OR_EXECUTE_MULTICAST() \
 	if (bJustExecutedRPCLocally || IsClientAndShouldSkipMulticastStateChange()) \
@@ -177,6 +183,10 @@ USMStateMachineComponent::USMStateMachineComponent(FObjectInitializer const & Ob
 	bIncludeSimulatedProxies = false;
 	bHandleControllerChange = true;
 	bAlwaysMulticast = false;
+	bUseCompactNetTransactions = false;
+	bThrottleNetUpdatesByRelevancy = false;
+	RelevancyThrottleDistance = 0.f;
+	ThrottledNetUpdateFrequency = 2.f;
 	
 	bProcessingRPCs = false;
 	bAutomaticallyHandleNewConnections = true;
@@ -195,6 +205,7 @@ USMStateMachineComponent::USMStateMachineComponent(FObjectInitializer const & Ob
 	bClientNeedsToSendInitialSync = false;
 	bNonAuthServerHasInitialStates = false;
 	bHasServerRemoteRoleJustChanged = false;
+	bIsThrottledByRelevancy = false;
 	
 	PrimaryComponentTick.bCanEverTick = true;
 	bCanInstanceNetworkTick = true;
@@ -528,6 +539,8 @@ void USMStateMachineComponent::TickComponent(float DeltaTime, ELevelTick TickTyp
 	
 	if (IsConfiguredForNetworking())
 	{
+		UpdateNetStats(DeltaTime);
+		
 		if (HasAuthority())
 		{
 			const float NetUpdateFrequency = GetServerUpdateFrequency();
@@ -653,13 +666,19 @@ bool USMStateMachineComponent::CanTickForEnvironment() const
 
 float USMStateMachineComponent::GetServerUpdateFrequency() const
 {
+	float NetUpdateFrequency = ServerNetUpdateFrequency;
 	if (bUseOwnerNetUpdateFrequency)
 	{
 		const AActor* ActorOwner = GetOwner();
-		return ActorOwner ? ActorOwner->GetNetUpdateFrequency() : 0.f;
+		NetUpdateFrequency = ActorOwner ? ActorOwner->GetNetUpdateFrequency() : 0.f;
+	}
+
+	if (bIsThrottledByRelevancy && ThrottledNetUpdateFrequency > 0.f)
+	{
+		NetUpdateFrequency = NetUpdateFrequency > 0.f ? FMath::Min(NetUpdateFrequency, ThrottledNetUpdateFrequency) : ThrottledNetUpdateFrequency;
 	}
 	
-	return ServerNetUpdateFrequency;
+	return NetUpdateFrequency;
 }
 
 float USMStateMachineComponent::GetClientUpdateFrequency() const
@@ -944,6 +963,10 @@ void USMStateMachineComponent::CopySettingsFromOtherComponent(USMStateMachineCom
 	bUseOwnerNetUpdateFrequency = OtherComponent->bUseOwnerNetUpdateFrequency;
 	ServerNetUpdateFrequency = OtherComponent->ServerNetUpdateFrequency;
 	ClientNetUpdateFrequency = OtherComponent->ClientNetUpdateFrequency;
+	bUseCompactNetTransactions = OtherComponent->bUseCompactNetTransactions;
+	bThrottleNetUpdatesByRelevancy = OtherComponent->bThrottleNetUpdatesByRelevancy;
+	RelevancyThrottleDistance = OtherComponent->RelevancyThrottleDistance;
+	ThrottledNetUpdateFrequency = OtherComponent->ThrottledNetUpdateFrequency;
 }
 
 void USMStateMachineComponent::ServerInitialize(UObject* Context)
@@ -1580,6 +1603,7 @@ void USMStateMachineComponent::DoShutdown()
 	bServerInSync = false;
 	bClientNeedsToSendInitialSync = false;
 	bProxiesWaitingForOwningSync = true;
+	TransactionIndexTable.Reset();
 
 	if (const UWorld* World = GetWorld())
 	{
@@ -1622,9 +1646,19 @@ void USMStateMachineComponent::DoFullSync(const FSMFullSyncTransaction& FullSync
 		ConfigureInstanceNetworkSettings();
 	}
 
+	// RPC args are const, compact states are resolved on a copy.
+	TArray<FSMFullSyncStateTransaction> ResolvedStates;
+	const TArray<FSMFullSyncStateTransaction>* ActiveStates = &FullSyncTransaction.ActiveStates;
+	if (ActiveStates->ContainsByPredicate([](const FSMFullSyncStateTransaction& State) { return State.NeedsNetIndexResolve(); }))
+	{
+		ResolvedStates = FullSyncTransaction.ActiveStates;
+		ResolveFullSyncStatesFromNetwork(ResolvedStates);
+		ActiveStates = &ResolvedStates;
+	}
+
 	R_Instance->ClearLoadedStates();
 
-	for (const FSMFullSyncStateTransaction& ReplicatedState : FullSyncTransaction.ActiveStates)
+	for (const FSMFullSyncStateTransaction& ReplicatedState : *ActiveStates)
 	{
 		R_Instance->LoadFromState(ReplicatedState.BaseGuid, false, false);
 		if (FSMState_Base* State = R_Instance->GetStateByGuid(ReplicatedState.BaseGuid))
@@ -1635,7 +1669,7 @@ void USMStateMachineComponent::DoFullSync(const FSMFullSyncTransaction& FullSync
 
 	if (!R_Instance->HasStarted() && FullSyncTransaction.bHasStarted)
 	{
-		if (FullSyncTransaction.ActiveStates.Num() > 0)
+		if (ActiveStates->Num() > 0)
 		{
 			DoStart();
 		}
@@ -1676,9 +1710,19 @@ void USMStateMachineComponent::DoTakeTransitions(const TArray<FSMTransitionTrans
 	const TMap<FGuid, FSMState_Base*>& StateMap = R_Instance->GetStateMap();
 	const TMap<FGuid, FSMNode_Base*>& NodeMap = R_Instance->GetNodeMap();
 
+	// RPC args are const, compact transactions are resolved on a copy.
+	TArray<FSMTransitionTransaction> ResolvedTransactions;
+	const TArray<FSMTransitionTransaction>* Transactions = &InTransactions;
+	if (InTransactions.ContainsByPredicate([](const FSMTransitionTransaction& Transaction) { return Transaction.NeedsNetIndexResolve(); }))
+	{
+		ResolvedTransactions = InTransactions;
+		ResolveTransitionTransactionsFromNetwork(ResolvedTransactions);
+		Transactions = &ResolvedTransactions;
+	}
+
 	FDateTime CurrentTime = FDateTime::UtcNow();
 	
-	for (const FSMTransitionTransaction& NetworkedTransaction : InTransactions)
+	for (const FSMTransitionTransaction& NetworkedTransaction : *Transactions)
 	{
 		if (NetworkedTransaction.bRanLocally)
 		{
@@ -1881,10 +1925,16 @@ bool USMStateMachineComponent::PrepareFullSyncTransaction(FSMFullSyncTransaction
 		TArray<FSMState_Base*> ActiveStates = R_Instance->HasStarted() ? R_Instance->GetAllActiveStates() :
 		R_Instance->GetRootStateMachine().GetAllNestedInitialTemporaryStates();
 		
+		const FSMTransactionIndexTable* IndexTable = bUseCompactNetTransactions ? GetTransactionIndexTable() : nullptr;
+		
 		FullSyncTransaction.ActiveStates.Reserve(ActiveStates.Num());
 		for (const FSMState_Base* ActiveState : ActiveStates)
 		{
 			FSMFullSyncStateTransaction ActiveStateTransaction(ActiveState->GetGuid(), ActiveState->GetActiveTime());
+			if (IndexTable)
+			{
+				IndexTable->CompactTransaction(ActiveStateTransaction);
+			}
 			FullSyncTransaction.ActiveStates.Add(MoveTemp(ActiveStateTransaction));
 		}
 		
@@ -1897,6 +1947,158 @@ bool USMStateMachineComponent::PrepareFullSyncTransaction(FSMFullSyncTransaction
 	return false;
 }
 
+const FSMTransactionIndexTable* USMStateMachineComponent::GetTransactionIndexTable() const
+{
+	if (!R_Instance || !R_Instance->IsInitialized() || R_Instance->GetNodeMap().Num() == 0)
+	{
+		return nullptr;
+	}
+
+	if (!TransactionIndexTable.IsBuiltFor(R_Instance))
+	{
+		TransactionIndexTable.Build(R_Instance);
+	}
+
+	return &TransactionIndexTable;
+}
+
+void USMStateMachineComponent::PrepareTransitionTransactionsForNetwork(TArray<FSMTransitionTransaction>& InOutTransactions)
+{
+	const FSMTransactionIndexTable* IndexTable = bUseCompactNetTransactions ? GetTransactionIndexTable() : nullptr;
+
+	int32 TotalBytes = 0;
+	for (FSMTransitionTransaction& Transaction : InOutTransactions)
+	{
+		if (IndexTable && !Transaction.NeedsNetIndexResolve())
+		{
+			IndexTable->CompactTransaction(Transaction);
+		}
+		TotalBytes += Transaction.GetNetSerializedSize();
+	}
+
+	RecordNetTransactionBytes(TotalBytes);
+}
+
+void USMStateMachineComponent::ResolveTransitionTransactionsFromNetwork(TArray<FSMTransitionTransaction>& InOutTransactions) const
+{
+	const FSMTransactionIndexTable* IndexTable = nullptr;
+	InOutTransactions.RemoveAll([&](FSMTransitionTransaction& Transaction)
+	{
+		if (!Transaction.NeedsNetIndexResolve())
+		{
+			return false;
+		}
+
+		if (!IndexTable)
+		{
+			IndexTable = GetTransactionIndexTable();
+		}
+
+		if (!IndexTable || !IndexTable->ResolveTransaction(Transaction))
+		{
+			LD_LOG_ERROR(TEXT("Could not resolve compact transition index %d, the transition is dropped. Connections may be running different versions of the state machine. %s."),
+				Transaction.NetTransitionIndex, *GetInfoString());
+			return true;
+		}
+
+		return false;
+	});
+}
+
+void USMStateMachineComponent::ResolveFullSyncStatesFromNetwork(TArray<FSMFullSyncStateTransaction>& InOutStates) const
+{
+	const FSMTransactionIndexTable* IndexTable = nullptr;
+	InOutStates.RemoveAll([&](FSMFullSyncStateTransaction& StateTransaction)
+	{
+		if (!StateTransaction.NeedsNetIndexResolve())
+		{
+			return false;
+		}
+
+		if (!IndexTable)
+		{
+			IndexTable = GetTransactionIndexTable();
+		}
+
+		if (!IndexTable || !IndexTable->ResolveTransaction(StateTransaction))
+		{
+			LD_LOG_ERROR(TEXT("Could not resolve compact state index %d, the state is dropped from the full sync. Connections may be running different versions of the state machine. %s."),
+				StateTransaction.NetStateIndex, *GetInfoString());
+			return true;
+		}
+
+		return false;
+	});
+}
+
+void USMStateMachineComponent::RecordNetTransactionBytes(int32 InBytes)
+{
+	NetTransactionBytesInWindow += InBytes;
+	INC_DWORD_STAT_BY(STAT_SMStateMachineComponent_NetTransactionBytes, InBytes);
+}
+
+void USMStateMachineComponent::UpdateNetStats(float DeltaTime)
+{
+	NetTransactionBytesWindowTime += DeltaTime;
+	if (NetTransactionBytesWindowTime >= 1.f)
+	{
+		NetTransactionBytesPerSecond = NetTransactionBytesInWindow / NetTransactionBytesWindowTime;
+		NetTransactionBytesInWindow = 0;
+		NetTransactionBytesWindowTime = 0.f;
+	}
+
+	if (HasAuthority() && bThrottleNetUpdatesByRelevancy)
+	{
+		TimeSinceRelevancyCheck += DeltaTime;
+		if (TimeSinceRelevancyCheck >= SM_RELEVANCY_CHECK_INTERVAL)
+		{
+			TimeSinceRelevancyCheck = 0.f;
+			bIsThrottledByRelevancy = IsOutsideRelevancyThrottleDistance();
+		}
+	}
+	else
+	{
+		bIsThrottledByRelevancy = false;
+	}
+}
+
+bool USMStateMachineComponent::IsOutsideRelevancyThrottleDistance() const
+{
+	const AActor* ActorOwner = GetTopMostParentActor();
+	const UWorld* World = GetWorld();
+	if (!ActorOwner || !World || ActorOwner->bAlwaysRelevant)
+	{
+		return false;
+	}
+
+	const float ThrottleDistanceSquared = RelevancyThrottleDistance > 0.f ?
+		FMath::Square(RelevancyThrottleDistance) : ActorOwner->GetNetCullDistanceSquared();
+	const FVector OwnerLocation = ActorOwner->GetActorLocation();
+	
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (!PlayerController)
+		{
+			continue;
+		}
+
+		if (PlayerController == ActorOwner || ActorOwner->IsOwnedBy(PlayerController))
+		{
+			// The owning connection should never be throttled.
+			return false;
+		}
+
+		const AActor* ViewTarget = PlayerController->GetViewTarget();
+		if (ViewTarget && FVector::DistSquared(ViewTarget->GetActorLocation(), OwnerLocation) < ThrottleDistanceSquared)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 void USMStateMachineComponent::ClearFullSyncTransactions(TArray<TSharedPtr<FSMTransaction_Base>>& InOutTransactions, bool bIgnoreUserAdded)
 {
 	InOutTransactions.RemoveAll([bIgnoreUserAdded](const TSharedPtr<FSMTransaction_Base>& Transaction)
@@ -2106,12 +2308,19 @@ void USMStateMachineComponent::ClientServer_ProcessAllTransactions(TArray<TShare
 
 	auto ProcessPendingTransitions = [&]()
 	{
+		// Transactions from an authoritative client may have arrived in compact form.
+		ResolveTransitionTransactionsFromNetwork(TransitionTransactions);
+		
 		if (TransitionTransactions.Num())
 		{
 			if (HasAuthority())
 			{
 				Server_PrepareTransitionTransactionsForClients(TransitionTransactions);
 			}
+			if (HasAuthority() || bClientSendingOutgoingTransactions)
+			{
+				PrepareTransitionTransactionsForNetwork(TransitionTransactions);
+			}
 			EXECUTE_QUEUED_TRANSACTION_MULTICAST_CLIENT_SERVER_OR_LOCAL(TakeTransitions, TransitionTransactions);
 			TransitionTransactions.Reset();
 		}
@@ -2233,6 +2442,15 @@ void USMStateMachineComponent::ClientServer_ProcessAllTransactions(TArray<TShare
 			{
 				ProcessAllPendingTransactions();
 				const TSharedPtr<FSMFullSyncTransaction> FullSyncPtr = StaticCastSharedPtr<FSMFullSyncTransaction>(Transaction);
+				if (HasAuthority() || bClientSendingOutgoingTransactions)
+				{
+					int32 FullSyncBytes = 1;
+					for (const FSMFullSyncStateTransaction& StateTransaction : FullSyncPtr->ActiveStates)
+					{
+						FullSyncBytes += StateTransaction.GetNetSerializedSize();
+					}
+					RecordNetTransactionBytes(FullSyncBytes);
+				}
 				EXECUTE_QUEUED_TRANSACTION_MULTICAST_CLIENT_SERVER_OR_LOCAL(FullSync, *FullSyncPtr);
 				bClientHasPendingFullSyncTransaction = false;
 				bClientPostFullSyncReady = TransactionIt.GetIndex() == InOutTransactions.Num() - 1;
@@ -0,0 +1,295 @@
+// Copyright Recursoft LLC. All Rights Reserved.
+
+#include "SMTransactions.h"
+
+#include "SMInstance.h"
+
+namespace LD
+{
+	namespace NetTransactions
+	{
+		/** Timestamps are sent as milliseconds since this date, which keeps the packed value well under 64 bits. */
+		static const FDateTime TimestampEpoch(2020, 1, 1);
+
+		/** Serialize a time in seconds as packed milliseconds. Negative times are sent as a single bit. */
+		static void SerializeQuantizedTime(FArchive& Ar, float& InOutTime)
+		{
+			uint8 bHasTime = InOutTime >= 0.f;
+			Ar.SerializeBits(&bHasTime, 1);
+
+			uint32 Milliseconds = bHasTime ? static_cast<uint32>(FMath::Min<double>(InOutTime * 1000.0, MAX_uint32)) : 0;
+			if (bHasTime)
+			{
+				Ar.SerializeIntPacked(Milliseconds);
+			}
+
+			if (Ar.IsLoading())
+			{
+				InOutTime = bHasTime ? static_cast<float>(Milliseconds) / 1000.f : SM_ACTIVE_TIME_NOT_SET;
+			}
+		}
+
+		static void SerializeQuantizedTimestamp(FArchive& Ar, FDateTime& InOutTimestamp)
+		{
+			uint8 bHasTimestamp = InOutTimestamp > TimestampEpoch;
+			Ar.SerializeBits(&bHasTimestamp, 1);
+
+			uint64 Milliseconds = bHasTimestamp ? static_cast<uint64>((InOutTimestamp - TimestampEpoch).GetTotalMilliseconds()) : 0;
+			if (bHasTimestamp)
+			{
+				Ar.SerializeIntPacked64(Milliseconds);
+			}
+
+			if (Ar.IsLoading())
+			{
+				InOutTimestamp = bHasTimestamp ? TimestampEpoch + FTimespan::FromMilliseconds(static_cast<double>(Milliseconds)) : FDateTime(0);
+			}
+		}
+
+		/** Bits written by SerializeIntPacked for a value, 7 value bits and 1 continue bit per byte. */
+		static int32 GetPackedIntBits(uint64 InValue)
+		{
+			int32 NumBytes = 1;
+			while (InValue >>= 7)
+			{
+				++NumBytes;
+			}
+			return NumBytes * 8;
+		}
+
+		static int32 GetQuantizedTimeBits(float InTime)
+		{
+			return 1 + (InTime >= 0.f ? GetPackedIntBits(static_cast<uint32>(FMath::Min<double>(InTime * 1000.0, MAX_uint32))) : 0);
+		}
+
+		static int32 GetQuantizedTimestampBits(const FDateTime& InTimestamp)
+		{
+			return 1 + (InTimestamp > TimestampEpoch ? GetPackedIntBits(static_cast<uint64>((InTimestamp - TimestampEpoch).GetTotalMilliseconds())) : 0);
+		}
+
+		static int32 GetIndexBits(int32 InIndex)
+		{
+			return GetPackedIntBits(static_cast<uint32>(FMath::Max(InIndex, 0)));
+		}
+
+		static void SerializeIndex(FArchive& Ar, int32& InOutIndex)
+		{
+			uint32 PackedIndex = static_cast<uint32>(FMath::Max(InOutIndex, 0));
+			Ar.SerializeIntPacked(PackedIndex);
+			if (Ar.IsLoading())
+			{
+				InOutIndex = static_cast<int32>(PackedIndex);
+			}
+		}
+	}
+}
+
+bool FSMTransitionTransaction::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint8 bServerOriginated = bOriginatedFromServer;
+	Ar.SerializeBits(&bServerOriginated, 1);
+
+	uint8 bUseIndices = ShouldSendNetIndices();
+	uint8 bSendSourceAndDestination = AreAdditionalGuidsSetupForTransitions();
+	Ar.SerializeBits(&bUseIndices, 1);
+	Ar.SerializeBits(&bSendSourceAndDestination, 1);
+
+	if (Ar.IsLoading())
+	{
+		TransactionType = ESMTransactionType::SM_Transition;
+		bOriginatedFromServer = bServerOriginated;
+		AdditionalGuids.Reset(bSendSourceAndDestination ? 2 : 0);
+		if (bSendSourceAndDestination)
+		{
+			AdditionalGuids.AddDefaulted(2);
+		}
+	}
+
+	if (bUseIndices)
+	{
+		if (Ar.IsLoading())
+		{
+			BaseGuid.Invalidate();
+		}
+
+		LD::NetTransactions::SerializeIndex(Ar, NetTransitionIndex);
+		if (bSendSourceAndDestination)
+		{
+			LD::NetTransactions::SerializeIndex(Ar, NetSourceStateIndex);
+			LD::NetTransactions::SerializeIndex(Ar, NetDestinationStateIndex);
+		}
+	}
+	else
+	{
+		Ar << BaseGuid;
+		if (bSendSourceAndDestination)
+		{
+			Ar << AdditionalGuids[0];
+			Ar << AdditionalGuids[1];
+		}
+	}
+
+	LD::NetTransactions::SerializeQuantizedTimestamp(Ar, Timestamp);
+	LD::NetTransactions::SerializeQuantizedTime(Ar, ActiveTime);
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+int32 FSMTransitionTransaction::GetNetSerializedSize() const
+{
+	const bool bSendSourceAndDestination = AreAdditionalGuidsSetupForTransitions();
+
+	// Originated from server, use indices and send source and destination flags.
+	int32 NumBits = 3;
+	if (ShouldSendNetIndices())
+	{
+		NumBits += LD::NetTransactions::GetIndexBits(NetTransitionIndex);
+		if (bSendSourceAndDestination)
+		{
+			NumBits += LD::NetTransactions::GetIndexBits(NetSourceStateIndex) + LD::NetTransactions::GetIndexBits(NetDestinationStateIndex);
+		}
+	}
+	else
+	{
+		NumBits += sizeof(FGuid) * 8 * (bSendSourceAndDestination ? 3 : 1);
+	}
+
+	NumBits += LD::NetTransactions::GetQuantizedTimestampBits(Timestamp);
+	NumBits += LD::NetTransactions::GetQuantizedTimeBits(ActiveTime);
+	return FMath::DivideAndRoundUp(NumBits, 8);
+}
+
+bool FSMFullSyncStateTransaction::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint8 bUseIndex = NetStateIndex != SM_NET_INDEX_NONE;
+	Ar.SerializeBits(&bUseIndex, 1);
+
+	if (Ar.IsLoading())
+	{
+		TransactionType = ESMTransactionType::SM_FullSync;
+	}
+
+	if (bUseIndex)
+	{
+		if (Ar.IsLoading())
+		{
+			BaseGuid.Invalidate();
+		}
+		LD::NetTransactions::SerializeIndex(Ar, NetStateIndex);
+	}
+	else
+	{
+		Ar << BaseGuid;
+	}
+
+	LD::NetTransactions::SerializeQuantizedTime(Ar, TimeInState);
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+int32 FSMFullSyncStateTransaction::GetNetSerializedSize() const
+{
+	int32 NumBits = 1;
+	NumBits += NetStateIndex != SM_NET_INDEX_NONE ? LD::NetTransactions::GetIndexBits(NetStateIndex) : sizeof(FGuid) * 8;
+	NumBits += LD::NetTransactions::GetQuantizedTimeBits(TimeInState);
+	return FMath::DivideAndRoundUp(NumBits, 8);
+}
+
+void FSMTransactionIndexTable::Build(const USMInstance* InInstance)
+{
+	Reset();
+
+	if (!InInstance)
+	{
+		return;
+	}
+
+	Instance = InInstance;
+
+	InInstance->GetTransitionMap().GenerateKeyArray(TransitionGuids);
+	TransitionGuids.Sort();
+	TransitionIndices.Reserve(TransitionGuids.Num());
+	for (int32 Index = 0; Index < TransitionGuids.Num(); ++Index)
+	{
+		TransitionIndices.Add(TransitionGuids[Index], Index);
+	}
+
+	InInstance->GetStateMap().GenerateKeyArray(StateGuids);
+	StateGuids.Sort();
+	StateIndices.Reserve(StateGuids.Num());
+	for (int32 Index = 0; Index < StateGuids.Num(); ++Index)
+	{
+		StateIndices.Add(StateGuids[Index], Index);
+	}
+}
+
+void FSMTransactionIndexTable::Reset()
+{
+	Instance.Reset();
+	TransitionGuids.Reset();
+	TransitionIndices.Reset();
+	StateGuids.Reset();
+	StateIndices.Reset();
+}
+
+bool FSMTransactionIndexTable::IsBuiltFor(const USMInstance* InInstance) const
+{
+	return InInstance && Instance.Get() == InInstance && (TransitionGuids.Num() > 0 || StateGuids.Num() > 0);
+}
+
+bool FSMTransactionIndexTable::CompactTransaction(FSMTransitionTransaction& InOutTransaction) const
+{
+	InOutTransaction.NetTransitionIndex = TransitionIndices.FindRef(InOutTransaction.BaseGuid, SM_NET_INDEX_NONE);
+	if (InOutTransaction.AreAdditionalGuidsSetupForTransitions())
+	{
+		InOutTransaction.NetSourceStateIndex = StateIndices.FindRef(InOutTransaction.GetTransitionSourceGuid(), SM_NET_INDEX_NONE);
+		InOutTransaction.NetDestinationStateIndex = StateIndices.FindRef(InOutTransaction.GetTransitionDestinationGuid(), SM_NET_INDEX_NONE);
+		return InOutTransaction.NetTransitionIndex != SM_NET_INDEX_NONE &&
+			InOutTransaction.NetSourceStateIndex != SM_NET_INDEX_NONE && InOutTransaction.NetDestinationStateIndex != SM_NET_INDEX_NONE;
+	}
+
+	return InOutTransaction.NetTransitionIndex != SM_NET_INDEX_NONE;
+}
+
+bool FSMTransactionIndexTable::CompactTransaction(FSMFullSyncStateTransaction& InOutTransaction) const
+{
+	InOutTransaction.NetStateIndex = StateIndices.FindRef(InOutTransaction.BaseGuid, SM_NET_INDEX_NONE);
+	return InOutTransaction.NetStateIndex != SM_NET_INDEX_NONE;
+}
+
+bool FSMTransactionIndexTable::ResolveTransaction(FSMTransitionTransaction& InOutTransaction) const
+{
+	if (!TransitionGuids.IsValidIndex(InOutTransaction.NetTransitionIndex))
+	{
+		return false;
+	}
+
+	InOutTransaction.BaseGuid = TransitionGuids[InOutTransaction.NetTransitionIndex];
+
+	if (InOutTransaction.AreAdditionalGuidsSetupForTransitions())
+	{
+		if (!StateGuids.IsValidIndex(InOutTransaction.NetSourceStateIndex) ||
+			!StateGuids.IsValidIndex(InOutTransaction.NetDestinationStateIndex))
+		{
+			return false;
+		}
+
+		InOutTransaction.AdditionalGuids[0] = StateGuids[InOutTransaction.NetSourceStateIndex];
+		InOutTransaction.AdditionalGuids[1] = StateGuids[InOutTransaction.NetDestinationStateIndex];
+	}
+
+	return true;
+}
+
+bool FSMTransactionIndexTable::ResolveTransaction(FSMFullSyncStateTransaction& InOutTransaction) const
+{
+	if (!StateGuids.IsValidIndex(InOutTransaction.NetStateIndex))
+	{
+		return false;
+	}
+
+	InOutTransaction.BaseGuid = StateGuids[InOutTransaction.NetStateIndex];
+	return true;
+}
@@ -26,5 +26,19 @@ namespace LD
 
 		/** Iterates through all functions executing them. */
 		SMSYSTEM_API void ExecuteGraphFunctions(const TArray<FSMExposedFunctionHandler>& InGraphFunctions, USMInstance* InInstance, USMNodeInstance* InNodeInstance, void* InParams = nullptr);
+
+		/**
+		 * Register a direct call for a native function of a class. Only used when the function a handler binds to
+		 * is the native one, so blueprint overrides still run through ProcessEvent. Register before state machines
+		 * using the function initialize, such as on module startup.
+		 *
+		 * @param InClass The native class declaring the function.
+		 * @param InFunctionName The name of the UFunction.
+		 * @param InNativeFunction Calls the native implementation, which should be virtual so native subclasses are respected.
+		 */
+		SMSYSTEM_API void RegisterNativeFunction(const UClass* InClass, FName InFunctionName, FSMNativeExposedFunction InNativeFunction);
+
+		/** Find the direct call registered for a function, null if the function isn't native or has none. */
+		SMSYSTEM_API FSMNativeExposedFunction FindNativeFunction(const UFunction* InFunction);
 	}
 }
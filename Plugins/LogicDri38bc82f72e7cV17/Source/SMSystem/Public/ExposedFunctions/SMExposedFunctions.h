@@ -23,6 +23,12 @@ enum class ESMConditionalEvaluationType : uint8
 	SM_AlwaysTrue       // Never eval graph and always take conditionally
 };
 
+/**
+ * Direct call of a native function exposed to graphs, bypassing ProcessEvent.
+ * InParams has the same layout ProcessEvent would receive, return values included.
+ */
+typedef void (*FSMNativeExposedFunction)(UObject* InObject, void* InParams);
+
 /**
  * Handles execution of functions exposed in blueprint graphs. This is meant to be defined once per class function
  * and then executed for a given object context.
@@ -34,7 +40,7 @@ struct SMSYSTEM_API FSMExposedFunctionHandler
 
 	FSMExposedFunctionHandler()
 		: BoundFunction(NAME_None)
-		  , ExecutionType(), Function(nullptr)
+		  , ExecutionType(), Function(nullptr), NativeFunction(nullptr)
 	{
 	}
 
@@ -47,7 +53,8 @@ struct SMSYSTEM_API FSMExposedFunctionHandler
 	ESMExposedFunctionExecutionType ExecutionType;
 
 	/**
-	 * Lookup the UFunction by the BoundFunction name.
+	 * Lookup the UFunction by the BoundFunction name. If the function found is native and has a direct call
+	 * registered it will be used instead of ProcessEvent.
 	 *
 	 * @param InClass The class owning the function.
 	 */
@@ -65,9 +72,15 @@ struct SMSYSTEM_API FSMExposedFunctionHandler
 	UFunction* GetFunction() const { return Function; }
 #endif
 
+	/** If this handler calls its function directly. */
+	bool IsNative() const { return NativeFunction != nullptr; }
+
 private:
 	UPROPERTY()
 	TObjectPtr<UFunction> Function;
+
+	/** Set when Function is native and has a direct call registered. */
+	FSMNativeExposedFunction NativeFunction;
 };
 
 /**
@@ -216,6 +216,10 @@ private:
 	/** Restore specific archetype values. Currently only handles certain construction values which may be modified. */
 	void RestoreArchetypeValuesPriorToConstruction();
 	
+public:
+	/** Registers direct calls of the functions below, used by graphs bound to them unless overridden in blueprint. */
+	static void RegisterNativeExposedFunctions();
+
 protected:
 	virtual void OnRootStateMachineStart_Implementation() {}
 	virtual void OnRootStateMachineStop_Implementation() {}
@@ -446,6 +450,21 @@ public:
 	 */
 	UPROPERTY(EditDefaultsOnly, Category = "Properties", meta = (InstancedTemplate, HideOnNode))
 	uint8 bAutoEvalExposedProperties: 1;
+
+	/**
+	 * Only evaluate a graph property when a state machine variable it reads has been marked dirty with
+	 * MarkGraphPropertySourceDirty on the state machine instance. Graphs reading anything else, such as function
+	 * calls, always evaluate. Every graph evaluates at least once after the state machine initializes.
+	 *
+	 * This is an optimization for nodes evaluating often, such as on state update. Variables changed without
+	 * being marked dirty won't be picked up, and values modified at run-time won't reset until a source changes.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Properties", AdvancedDisplay, meta = (InstancedTemplate, HideOnNode))
+	uint8 bEvalGraphPropertiesOnSourceChange: 1;
+
+	/** The number of graph property evaluations skipped because none of their sources changed. */
+	UFUNCTION(BlueprintCallable, Category = "Logic Driver|Node Instance")
+	int32 GetNumSkippedGraphPropertyEvaluations() const { return NumSkippedGraphPropertyEvaluations; }
 	
 #if WITH_EDITOR
 public:
@@ -774,6 +793,9 @@ private:
 
 	/** True from NativeInitialize. */
 	uint8 bIsInitialized: 1;
+
+	/** Graph property evaluations skipped by bEvalGraphPropertiesOnSourceChange. */
+	int32 NumSkippedGraphPropertyEvaluations;
 	
 	/** The owning node in the state machine instance. */
 	FSMNode_Base* OwningNode;
@@ -88,4 +88,7 @@ public:
 private:
 	// True for GetValidTransitions, prevents stack overflow when looped with other transition based conduits.
 	bool bCheckedForTransitions;
+
+	/** Direct call of CanEnterTransition when the condition is a native node instance. */
+	FSMNativeExposedFunction NativeCanEnterTransition = nullptr;
 };
@@ -45,6 +45,10 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = "Properties", AdvancedDisplay, meta = (InstancedTemplate, HideOnNode, EditCondition = "bAutoEvalExposedProperties", DisplayName = "Auto Eval on Transition Eval"))
 	bool bEvalGraphsOnTransitionEval;
 	
+public:
+	/** Registers direct calls of the functions below, used by graphs bound to them unless overridden in blueprint. */
+	static void RegisterNativeExposedFunctions();
+
 protected:
 	/* Override in native classes to implement. Never call these directly. */
 
@@ -334,6 +334,10 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = "Properties", AdvancedDisplay, meta = (InstancedTemplate, HideOnNode, EditCondition = "bAutoEvalExposedProperties", DisplayName = "Auto Eval on Root State Machine Stop"))
 	uint8 bEvalGraphsOnRootStateMachineStop: 1;
 	
+public:
+	/** Registers direct calls of the functions below, used by graphs bound to them unless overridden in blueprint. */
+	static void RegisterNativeExposedFunctions();
+
 protected:
 	/* Override in native classes to implement. Never call these directly. */
 	
@@ -657,6 +661,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Logic Driver|Node Instance", meta = (DevelopmentOnly))
 	void ClearStateStack();
 
+public:
+	/** Registers direct calls of the functions below, used by graphs bound to them unless overridden in blueprint. */
+	static void RegisterNativeExposedFunctions();
+
 protected:
 	/* Override in native classes to implement. Never call these directly. */
 	
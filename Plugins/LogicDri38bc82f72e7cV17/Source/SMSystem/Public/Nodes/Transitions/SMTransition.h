@@ -168,4 +168,7 @@ public:
 private:
 	FSMState_Base* FromState;
 	FSMState_Base* ToState;
+
+	/** Direct call of CanEnterTransition when the condition is a native node instance. */
+	FSMNativeExposedFunction NativeCanEnterTransition = nullptr;
 };
\ No newline at end of file
@@ -179,6 +179,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Logic Driver|Node Instance")
 	int32 GetTransitionStackCount() const;
 	
+public:
+	/** Registers direct calls of the functions below, used by graphs bound to them unless overridden in blueprint. */
+	static void RegisterNativeExposedFunctions();
+
 protected:
 	/* Override in native classes to implement. Never call these directly. */
 	
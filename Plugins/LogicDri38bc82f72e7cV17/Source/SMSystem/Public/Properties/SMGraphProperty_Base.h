@@ -45,6 +45,27 @@ struct SMSYSTEM_API FSMGraphProperty_Base_Runtime
 	/** Does this variable only contain a default value. */
 	bool GetIsDefaultValueOnly() const { return bIsDefaultValueOnly; }
 
+	/** Set the state machine variables the graph reads and if it reads anything else which can't be tracked. */
+	void SetGraphSources(const TArray<FName>& InSourceVariables, bool bInHasUntrackedSources);
+
+	/** State machine instance variables read by the graph. */
+	const TArray<FName>& GetSourceVariables() const { return SourceVariables; }
+
+	/** If the graph reads anything other than state machine variables, such as function calls. */
+	bool HasUntrackedSources() const { return bHasUntrackedSources; }
+
+	/**
+	 * If the graph needs to run when only evaluating on source change. True on first evaluation, when a source
+	 * has been marked dirty since the last evaluation, or when the sources can't be tracked.
+	 */
+	bool HaveSourcesChanged() const;
+
+	/** Record the source versions the graph was just evaluated with. */
+	void RecordEvaluatedSources();
+
+	/** Forget the recorded source versions so the next evaluation always runs. */
+	void ResetEvaluatedSources() { bHasEvaluatedSources = false; }
+
 	/** Get the property name of the result field. */
 	virtual FName GetResultPropertyName() const { return NAME_None; }
 
@@ -67,8 +88,22 @@ protected:
 	UPROPERTY()
 	uint8 bIsDefaultValueOnly: 1;
 
+	/** If the graph reads anything other than member variables of the state machine. Set by the compiler. */
+	UPROPERTY()
+	uint8 bHasUntrackedSources: 1;
+
+	/** Member variables of the state machine read by the graph. Set by the compiler. */
+	UPROPERTY()
+	TArray<FName> SourceVariables;
+
 	/** The node this graph property belongs to. */
 	FSMNode_Base* OwningNode;
+
+private:
+	/** Versions of SourceVariables when last evaluated. */
+	TArray<uint32> EvaluatedSourceVersions;
+	uint32 EvaluatedSourceEpoch;
+	uint8 bHasEvaluatedSources: 1;
 };
 
 /**
@@ -1357,6 +1357,26 @@ public:
 	 */
 	void AddNonThreadSafeNode(FSMNode_Base* InNode);
 
+	/**
+	 * Signal a variable of this state machine has changed so graph properties reading it re-evaluate. Only needed for
+	 * node instances with bEvalGraphPropertiesOnSourceChange set, which otherwise skip evaluating graphs whose sources
+	 * haven't been marked dirty.
+	 *
+	 * @param VariableName The name of the member variable that changed.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Logic Driver|State Machine Instances")
+	void MarkGraphPropertySourceDirty(FName VariableName);
+
+	/** Signal all variables read by graph properties have changed. */
+	UFUNCTION(BlueprintCallable, Category = "Logic Driver|State Machine Instances")
+	void MarkAllGraphPropertySourcesDirty();
+
+	/** The number of times a variable has been marked dirty. */
+	uint32 GetGraphPropertySourceVersion(FName VariableName) const;
+
+	/** The number of times all variables have been marked dirty. */
+	uint32 GetGraphPropertySourceEpoch() const { return GraphPropertySourceEpoch; }
+
 private:
 	UPROPERTY(DuplicateTransient, meta = (BlueprintCompilerGeneratedDefaults))
 	TMap<FGuid, FSMExposedNodeFunctions> NodeExposedFunctions;
@@ -1364,6 +1384,10 @@ private:
 	TArray<FSMNode_Base*> NonThreadSafeNodes;
 	FCriticalSection CriticalSection;
 
+	/** Variable name -> times marked dirty. */
+	TMap<FName, uint32> GraphPropertySourceVersions;
+	uint32 GraphPropertySourceEpoch = 0;
+
 #if WITH_EDITORONLY_DATA
 	FSMDebugStateMachine DebugStateMachine;
 #endif
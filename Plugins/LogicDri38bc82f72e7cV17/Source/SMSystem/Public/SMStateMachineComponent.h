@@ -236,6 +236,13 @@ public:
 	/** Retrieve the correct update frequency to use. */
 	float GetClientUpdateFrequency() const;
 
+	/** If the server is currently sending updates at #ThrottledNetUpdateFrequency because no viewer is nearby. */
+	bool IsNetUpdateThrottledByRelevancy() const { return bIsThrottledByRelevancy; }
+
+	/** Average bytes per second of transition and sync transactions this component has sent recently. */
+	UFUNCTION(BlueprintCallable, Category = "Logic Driver|State Machine Components")
+	float GetNetTransactionBytesPerSecond() const { return NetTransactionBytesPerSecond; }
+
 	/**
 	 * Special override to change instance tick settings when networked. Requires tick authority to make any changes.
 	 * Calling USMInstance::SetCanEverTick() on the primary instance will update the network tick, which may make
@@ -416,6 +423,27 @@ protected:
 	
 	/** Create a full sync transaction from this instance. */
 	bool PrepareFullSyncTransaction(FSMFullSyncTransaction& OutFullSyncTransaction) const;
+
+	/** Retrieve the compact index table for the current instance, building it if needed. Null if unavailable. */
+	const FSMTransactionIndexTable* GetTransactionIndexTable() const;
+
+	/** Assign compact indices to outgoing transactions and record their size. */
+	void PrepareTransitionTransactionsForNetwork(TArray<FSMTransitionTransaction>& InOutTransactions);
+
+	/** Restore guids of transactions received in compact form. Transactions that can't be resolved are removed. */
+	void ResolveTransitionTransactionsFromNetwork(TArray<FSMTransitionTransaction>& InOutTransactions) const;
+
+	/** Restore guids of full sync states received in compact form. States that can't be resolved are removed. */
+	void ResolveFullSyncStatesFromNetwork(TArray<FSMFullSyncStateTransaction>& InOutStates) const;
+
+	/** Record outgoing transaction bytes for bandwidth stats. */
+	void RecordNetTransactionBytes(int32 InBytes);
+
+	/** Update bandwidth stats and relevancy throttling. */
+	void UpdateNetStats(float DeltaTime);
+
+	/** Checks if no player is viewing from within the relevancy throttle distance. */
+	bool IsOutsideRelevancyThrottleDistance() const;
 	
 	/**
 	 * Clears all transactions matching the type from the input array.
@@ -618,6 +646,21 @@ private:
 
 	/** Time spent since last update. */
 	float LastNetUpdateTime = 0.f;
+
+	/** Compact guid indices for the current instance. */
+	mutable FSMTransactionIndexTable TransactionIndexTable;
+
+	/** Bytes sent during the current bandwidth window. */
+	int32 NetTransactionBytesInWindow = 0;
+
+	/** Time spent in the current bandwidth window. */
+	float NetTransactionBytesWindowTime = 0.f;
+
+	/** Average bytes per second from the last completed bandwidth window. */
+	float NetTransactionBytesPerSecond = 0.f;
+
+	/** Time since relevancy was last checked. */
+	float TimeSinceRelevancyCheck = 0.f;
 	
 #if UE_BUILD_DEBUG || UE_BUILD_DEVELOPMENT
 public:
@@ -707,6 +750,9 @@ private:
 
 	/** If the server has had its remote role suddenly changed. */
 	uint32 bHasServerRemoteRoleJustChanged: 1;
+
+	/** If the server is sending at the throttled update frequency. */
+	uint32 bIsThrottledByRelevancy: 1;
 	
 	///////////////////////
 	/// End Server
@@ -912,6 +958,29 @@ public:
 	UPROPERTY(Replicated, EditDefaultsOnly, BlueprintReadWrite, AdvancedDisplay, Category = ComponentReplication, meta = (EditCondition = "bReplicates && !bIncludeSimulatedProxies"))
 	uint8 bAlwaysMulticast: 1;
 
+	/**
+	 * Send transitions and full syncs in a compact form, replacing node guids with indices into a table built from
+	 * the instance and quantizing times to milliseconds. Only enable if every connection runs the same version of the
+	 * state machine class, and dynamic references resolve the same way on every connection.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, AdvancedDisplay, Category = ComponentReplication, meta = (EditCondition = "bReplicates"))
+	uint8 bUseCompactNetTransactions: 1;
+
+	/**
+	 * When no player is viewing from within #RelevancyThrottleDistance the server will process its RPC queue
+	 * at #ThrottledNetUpdateFrequency instead, coalescing more transactions into each call.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, AdvancedDisplay, Category = ComponentReplication, meta = (EditCondition = "bReplicates"))
+	uint8 bThrottleNetUpdatesByRelevancy: 1;
+
+	/** The distance from every player view target beyond which updates are throttled. When 0 the owner's net cull distance is used. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, AdvancedDisplay, Category = ComponentReplication, meta = (EditCondition = "bReplicates && bThrottleNetUpdatesByRelevancy", ClampMin = "0"))
+	float RelevancyThrottleDistance;
+
+	/** The update rate (per second) for server RPC processing while throttled by relevancy. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, AdvancedDisplay, Category = ComponentReplication, meta = (EditCondition = "bReplicates && bThrottleNetUpdatesByRelevancy", ClampMin = "0.1"))
+	float ThrottledNetUpdateFrequency;
+
 private:
 	/**
 	 * Provide an existing component to copy certain settings from during dynamic component creation.
@@ -9,6 +9,11 @@
 
 #define SM_ACTIVE_TIME_NOT_SET -1.f
 
+/** An unresolved compact network index. */
+#define SM_NET_INDEX_NONE -1
+
+class USMInstance;
+
 UENUM()
 enum class ESMTransactionType : uint8
 {
@@ -99,7 +104,9 @@ struct SMSYSTEM_API FSMTransitionTransaction : public FSMTransaction_Base
 
 	explicit FSMTransitionTransaction(const FGuid& InGuid)
 		: FSMTransaction_Base(ESMTransactionType::SM_Transition), BaseGuid(InGuid),
-		  Timestamp(0), ActiveTime(SM_ACTIVE_TIME_NOT_SET), bIsServer(0)
+		  Timestamp(0), ActiveTime(SM_ACTIVE_TIME_NOT_SET), bIsServer(0),
+		  NetTransitionIndex(SM_NET_INDEX_NONE), NetSourceStateIndex(SM_NET_INDEX_NONE),
+		  NetDestinationStateIndex(SM_NET_INDEX_NONE)
 	{
 	}
 
@@ -125,6 +132,33 @@ struct SMSYSTEM_API FSMTransitionTransaction : public FSMTransaction_Base
 	/** Set from server during processing. */
 	uint8 bIsServer: 1;
 
+	/**
+	 * Compact indices into the instance's FSMTransactionIndexTable. When set they are sent in place of the guids
+	 * and must be resolved by the receiver before the guids are valid.
+	 */
+	int32 NetTransitionIndex;
+	int32 NetSourceStateIndex;
+	int32 NetDestinationStateIndex;
+
+	/**
+	 * Compact network serialization. Guids are replaced with table indices when available and
+	 * the timestamp and active time are quantized to milliseconds.
+	 */
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+	/** Size in bytes NetSerialize writes for this transaction, calculated without serializing it. */
+	int32 GetNetSerializedSize() const;
+
+	/** If this transaction was received with indices that still need to be resolved to guids. */
+	FORCEINLINE bool NeedsNetIndexResolve() const { return !BaseGuid.IsValid() && NetTransitionIndex != SM_NET_INDEX_NONE; }
+
+	/** If every guid has a compact index and indices will be sent in place of the guids. */
+	FORCEINLINE bool ShouldSendNetIndices() const
+	{
+		return NetTransitionIndex != SM_NET_INDEX_NONE && (!AreAdditionalGuidsSetupForTransitions() ||
+			(NetSourceStateIndex != SM_NET_INDEX_NONE && NetDestinationStateIndex != SM_NET_INDEX_NONE));
+	}
+
 	FORCEINLINE bool AreAdditionalGuidsSetupForTransitions() const { return AdditionalGuids.Num() == 2; }
 	FORCEINLINE const FGuid& GetTransitionSourceGuid() const
 	{
@@ -139,6 +173,15 @@ struct SMSYSTEM_API FSMTransitionTransaction : public FSMTransaction_Base
 	}
 };
 
+template<>
+struct TStructOpsTypeTraits<FSMTransitionTransaction> : public TStructOpsTypeTraitsBase2<FSMTransitionTransaction>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
 /** States that need their active flag changed. */
 USTRUCT()
 struct SMSYSTEM_API FSMActivateStateTransaction : public FSMTransaction_Base
@@ -184,7 +227,8 @@ struct SMSYSTEM_API FSMFullSyncStateTransaction : public FSMTransaction_Base
 
 	FSMFullSyncStateTransaction(const FGuid& InGuid, const float InTimeInState) : FSMTransaction_Base(
 		                                                                          ESMTransactionType::SM_FullSync),
-	                                                                          BaseGuid(InGuid)
+	                                                                          BaseGuid(InGuid),
+	                                                                          NetStateIndex(SM_NET_INDEX_NONE)
 	{
 		TimeInState = InTimeInState;
 	}
@@ -195,6 +239,27 @@ struct SMSYSTEM_API FSMFullSyncStateTransaction : public FSMTransaction_Base
 
 	UPROPERTY()
 	float TimeInState;
+
+	/** Compact index into the instance's FSMTransactionIndexTable, sent in place of the guid when set. */
+	int32 NetStateIndex;
+
+	/** Compact network serialization. See FSMTransitionTransaction::NetSerialize. */
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+	/** Size in bytes NetSerialize writes for this transaction, calculated without serializing it. */
+	int32 GetNetSerializedSize() const;
+
+	/** If this transaction was received with an index that still needs to be resolved to a guid. */
+	FORCEINLINE bool NeedsNetIndexResolve() const { return !BaseGuid.IsValid() && NetStateIndex != SM_NET_INDEX_NONE; }
+};
+
+template<>
+struct TStructOpsTypeTraits<FSMFullSyncStateTransaction> : public TStructOpsTypeTraitsBase2<FSMFullSyncStateTransaction>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
 };
 
 /** Use for syncing the complete state of a state machine. */
@@ -230,3 +295,40 @@ struct SMSYSTEM_API FSMFullSyncTransaction : public FSMTransaction_Base
 	UPROPERTY()
 	uint8 bForceFullRefresh: 1;
 };
+
+
+/**
+ * Maps state and transition guids of an initialized instance to compact indices.
+ * Indices are assigned in guid order so every connection running the same state machine class builds an identical table.
+ */
+struct SMSYSTEM_API FSMTransactionIndexTable
+{
+	/** Build the table from an initialized instance. */
+	void Build(const USMInstance* InInstance);
+
+	/** Clear all indices. */
+	void Reset();
+
+	/** If the table was built for this instance. */
+	bool IsBuiltFor(const USMInstance* InInstance) const;
+
+	/** Assign compact indices to a transaction prior to sending. Returns false if any guid isn't indexed. */
+	bool CompactTransaction(FSMTransitionTransaction& InOutTransaction) const;
+	bool CompactTransaction(FSMFullSyncStateTransaction& InOutTransaction) const;
+
+	/** Restore guids from compact indices of a received transaction. Returns false if any index is out of range. */
+	bool ResolveTransaction(FSMTransitionTransaction& InOutTransaction) const;
+	bool ResolveTransaction(FSMFullSyncStateTransaction& InOutTransaction) const;
+
+	int32 NumTransitions() const { return TransitionGuids.Num(); }
+	int32 NumStates() const { return StateGuids.Num(); }
+
+private:
+	TWeakObjectPtr<const USMInstance> Instance;
+
+	TArray<FGuid> TransitionGuids;
+	TMap<FGuid, int32> TransitionIndices;
+
+	TArray<FGuid> StateGuids;
+	TMap<FGuid, int32> StateIndices;
+};
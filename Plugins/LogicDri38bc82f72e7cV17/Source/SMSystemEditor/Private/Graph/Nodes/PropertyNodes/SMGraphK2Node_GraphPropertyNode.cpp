@@ -5,8 +5,63 @@
 #include "Graph/Nodes/SlateNodes/Properties/SSMGraphProperty.h"
 #include "Graph/SMPropertyGraph.h"
 
+#include "K2Node_Knot.h"
+#include "K2Node_VariableGet.h"
+
 #define LOCTEXT_NAMESPACE "SMGraphPropertyNode"
 
+/**
+ * Collect the member variables read by the nodes connected to a pin.
+ * @return false if anything else is read, such as function calls, so the sources can't be tracked.
+ */
+static bool GatherGraphSources(const UEdGraphPin* InPin, TArray<FName>& OutSourceVariables)
+{
+	TArray<const UEdGraphNode*> NodesToVisit;
+	TSet<const UEdGraphNode*> VisitedNodes;
+	for (const UEdGraphPin* LinkedPin : InPin->LinkedTo)
+	{
+		NodesToVisit.Add(LinkedPin->GetOwningNode());
+	}
+
+	while (NodesToVisit.Num() > 0)
+	{
+		const UEdGraphNode* Node = NodesToVisit.Pop(EAllowShrinking::No);
+		if (VisitedNodes.Contains(Node))
+		{
+			continue;
+		}
+		VisitedNodes.Add(Node);
+
+		if (const UK2Node_VariableGet* VariableNode = Cast<UK2Node_VariableGet>(Node))
+		{
+			if (!VariableNode->VariableReference.IsSelfContext())
+			{
+				return false;
+			}
+			OutSourceVariables.AddUnique(VariableNode->GetVarName());
+		}
+		else if (Node->IsA<UK2Node_Knot>())
+		{
+			for (const UEdGraphPin* Pin : Node->Pins)
+			{
+				if (Pin->Direction == EGPD_Input)
+				{
+					for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+					{
+						NodesToVisit.Add(LinkedPin->GetOwningNode());
+					}
+				}
+			}
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 USMGraphK2Node_GraphPropertyNode::USMGraphK2Node_GraphPropertyNode(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -47,6 +102,10 @@ void USMGraphK2Node_GraphPropertyNode::ConfigureRuntimePropertyNode()
 		{
 			const bool bIsDefaultValue = Pin->LinkedTo.Num() == 0;
 			GraphProperty.SetIsDefaultValueOnly(bIsDefaultValue);
+
+			TArray<FName> SourceVariables;
+			const bool bSourcesTracked = GatherGraphSources(Pin, SourceVariables);
+			GraphProperty.SetGraphSources(SourceVariables, !bSourcesTracked);
 		}
 	}
 }
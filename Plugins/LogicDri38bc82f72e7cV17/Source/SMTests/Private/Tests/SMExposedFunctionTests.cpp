@@ -6,6 +6,8 @@
 
 #include "Blueprints/SMBlueprint.h"
 
+#include "ExposedFunctions/SMExposedFunctionHelpers.h"
+
 #include "Utilities/SMBlueprintEditorUtils.h"
 
 #include "Graph/Nodes/FunctionNodes/SMGraphK2Node_FunctionNodes_NodeInstance.h"
@@ -273,6 +275,28 @@ bool FExposedFunctionCacheTest::RunTest(const FString& Parameters)
 	return NewAsset.DeleteAsset(this);
 }
 
+/**
+ * Check native node instance functions are called directly instead of through ProcessEvent.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FExposedFunctionNativeDispatchTest, "LogicDriver.EntryFunctions.NativeDispatch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FExposedFunctionNativeDispatchTest::RunTest(const FString& Parameters)
+{
+	const UFunction* StateBegin = USMStateInstance_Base::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(USMStateInstance_Base, OnStateBegin));
+	TestNotNull("Native state function registered", LD::ExposedFunctions::FindNativeFunction(StateBegin));
+
+	const UFunction* CanEnterTransition = USMTransitionInstance::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(USMTransitionInstance, CanEnterTransition));
+	TestNotNull("Native transition function registered", LD::ExposedFunctions::FindNativeFunction(CanEnterTransition));
+
+	const UFunction* ContextFunction = USMTestContext::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(USMTestContext, IncreaseEntryInt));
+	TestNull("Unregistered function not native dispatched", LD::ExposedFunctions::FindNativeFunction(ContextFunction));
+
+	TestNull("Null function not native dispatched", LD::ExposedFunctions::FindNativeFunction(nullptr));
+
+	return true;
+}
+
 #endif
 
 #endif //WITH_DEV_AUTOMATION_TESTS
\ No newline at end of file
@@ -0,0 +1,120 @@
+// Copyright Recursoft LLC. All Rights Reserved.
+
+#include "SMTestHelpers.h"
+#include "SMTestContext.h"
+#include "Helpers/SMTestBoilerplate.h"
+
+#include "Blueprints/SMBlueprint.h"
+#include "SMTransactions.h"
+#include "SMTransition.h"
+
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#if PLATFORM_DESKTOP
+
+template<typename T>
+static T NetRoundTrip(T InTransaction, int64& OutNumBits)
+{
+	FBitWriter Writer(0, true);
+	bool bSuccess = false;
+	InTransaction.NetSerialize(Writer, nullptr, bSuccess);
+	OutNumBits = Writer.GetNumBits();
+
+	FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+	T OutTransaction;
+	OutTransaction.NetSerialize(Reader, nullptr, bSuccess);
+	return OutTransaction;
+}
+
+/**
+ * Verify compact transaction serialization resolves to the same guids and is smaller than the guid form.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCompactNetTransactionsTest, "LogicDriver.Network.CompactTransactions",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FCompactNetTransactionsTest::RunTest(const FString& Parameters)
+{
+	SETUP_NEW_STATE_MACHINE_FOR_TEST(5)
+
+	UEdGraphPin* LastStatePin = nullptr;
+
+	TestHelpers::BuildLinearStateMachine(this, StateMachineGraph, TotalStates, &LastStatePin);
+	FKismetEditorUtilities::CompileBlueprint(NewBP);
+
+	USMInstance* TestInstance = TestHelpers::CreateNewStateMachineInstanceFromBP(this, NewBP, NewObject<USMTestContext>());
+
+	FSMTransactionIndexTable IndexTable;
+	IndexTable.Build(TestInstance);
+	TestTrue("Index table built", IndexTable.IsBuiltFor(TestInstance));
+	TestEqual("All transitions indexed", IndexTable.NumTransitions(), TestInstance->GetTransitionMap().Num());
+	TestEqual("All states indexed", IndexTable.NumStates(), TestInstance->GetStateMap().Num());
+
+	FSMTransactionIndexTable SecondIndexTable;
+	SecondIndexTable.Build(TestHelpers::CreateNewStateMachineInstanceFromBP(this, NewBP, NewObject<USMTestContext>()));
+
+	for (const TTuple<FGuid, FSMTransition*>& TransitionPair : TestInstance->GetTransitionMap())
+	{
+		const FSMTransition* Transition = TransitionPair.Value;
+
+		FSMTransitionTransaction Transaction(TransitionPair.Key);
+		Transaction.AdditionalGuids = { Transition->GetFromState()->GetGuid(), Transition->GetToState()->GetGuid() };
+		Transaction.Timestamp = FDateTime::UtcNow();
+		Transaction.ActiveTime = 1.25f;
+
+		int64 GuidBits = 0;
+		const FSMTransitionTransaction GuidResult = NetRoundTrip(Transaction, GuidBits);
+		TestEqual("Guid form size calculated", Transaction.GetNetSerializedSize(), static_cast<int32>(FMath::DivideAndRoundUp<int64>(GuidBits, 8)));
+		TestEqual("Guid form preserves guid", GuidResult.BaseGuid, Transaction.BaseGuid);
+		TestFalse("Guid form needs no resolve", GuidResult.NeedsNetIndexResolve());
+
+		TestTrue("Transaction compacted", IndexTable.CompactTransaction(Transaction));
+
+		int64 CompactBits = 0;
+		FSMTransitionTransaction CompactResult = NetRoundTrip(Transaction, CompactBits);
+		TestTrue("Compact form is smaller", CompactBits < GuidBits);
+		TestEqual("Compact form size calculated", Transaction.GetNetSerializedSize(), static_cast<int32>(FMath::DivideAndRoundUp<int64>(CompactBits, 8)));
+		TestTrue("Compact form needs resolve", CompactResult.NeedsNetIndexResolve());
+		TestTrue("Compact form resolved by another instance", SecondIndexTable.ResolveTransaction(CompactResult));
+
+		TestEqual("Transition guid resolved", CompactResult.BaseGuid, Transaction.BaseGuid);
+		TestEqual("Source guid resolved", CompactResult.GetTransitionSourceGuid(), Transaction.GetTransitionSourceGuid());
+		TestEqual("Destination guid resolved", CompactResult.GetTransitionDestinationGuid(), Transaction.GetTransitionDestinationGuid());
+		TestEqual("Active time quantized", CompactResult.ActiveTime, 1.25f);
+		TestTrue("Timestamp quantized to milliseconds",
+			FMath::Abs((CompactResult.Timestamp - Transaction.Timestamp).GetTotalMilliseconds()) < 1.0);
+	}
+
+	// Unset times survive.
+	{
+		FSMTransitionTransaction Transaction(TestInstance->GetTransitionMap().CreateConstIterator().Key());
+		IndexTable.CompactTransaction(Transaction);
+
+		int64 NumBits = 0;
+		const FSMTransitionTransaction Result = NetRoundTrip(Transaction, NumBits);
+		TestEqual("Active time not set", Result.ActiveTime, SM_ACTIVE_TIME_NOT_SET);
+		TestEqual("Timestamp not set", Result.Timestamp, FDateTime(0));
+	}
+
+	for (const TTuple<FGuid, FSMState_Base*>& StatePair : TestInstance->GetStateMap())
+	{
+		FSMFullSyncStateTransaction Transaction(StatePair.Key, 3.5f);
+		TestTrue("State compacted", IndexTable.CompactTransaction(Transaction));
+
+		int64 NumBits = 0;
+		FSMFullSyncStateTransaction Result = NetRoundTrip(Transaction, NumBits);
+		TestEqual("State size calculated", Transaction.GetNetSerializedSize(), static_cast<int32>(FMath::DivideAndRoundUp<int64>(NumBits, 8)));
+		TestTrue("State resolved", SecondIndexTable.ResolveTransaction(Result));
+		TestEqual("State guid resolved", Result.BaseGuid, StatePair.Key);
+		TestEqual("Time in state quantized", Result.TimeInState, 3.5f);
+	}
+
+	return true;
+}
+
+#endif
+
+#endif //WITH_DEV_AUTOMATION_TESTS
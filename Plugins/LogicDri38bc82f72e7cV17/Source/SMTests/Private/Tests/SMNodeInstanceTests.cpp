@@ -219,6 +219,76 @@ bool FNodeInstanceEvalVariableTest::RunTest(const FString& Parameters)
 	return NewAsset.DeleteAsset(this);
 }
 
+/**
+ * Verify graph properties only evaluating on source change produce the same values as always evaluating.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNodeInstanceSourceChangeEvalTest, "LogicDriver.NodeInstance.Variables.SourceChangeEval",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FNodeInstanceSourceChangeEvalTest::RunTest(const FString& Parameters)
+{
+	SETUP_NEW_STATE_MACHINE_FOR_TEST(1)
+
+	UEdGraphPin* LastStatePin = nullptr;
+	TestHelpers::BuildLinearStateMachine(this, StateMachineGraph, TotalStates, &LastStatePin, USMStateTestInstance::StaticClass(), USMTransitionTestInstance::StaticClass());
+
+	USMGraphNode_StateNode* StateNode = CastChecked<USMGraphNode_StateNode>(StateMachineGraph->GetEntryNode()->GetOutputNode());
+	auto PropertyNodes = StateNode->GetAllPropertyGraphNodesAsArray();
+
+	const FName VarName = "NewVar";
+	FEdGraphPinType VarType;
+	VarType.PinCategory = UEdGraphSchema_K2::PC_Int;
+
+	const int32 TestVarDefaultValue = 15;
+	const int32 TestVarChangedValue = 20;
+	FBlueprintEditorUtils::AddMemberVariable(NewBP, VarName, VarType, FString::FromInt(TestVarDefaultValue));
+
+	FProperty* NewProperty = FSMBlueprintEditorUtils::GetPropertyByName(NewBP, VarName);
+	FSMBlueprintEditorUtils::PlacePropertyOnGraph(PropertyNodes[0]->GetGraph(), NewProperty, PropertyNodes[0]->GetResultPinChecked(), nullptr);
+
+	USMStateInstance* StateInstanceTemplate = CastChecked<USMStateInstance>(StateNode->GetNodeTemplate());
+	StateInstanceTemplate->bEvalGraphsOnUpdate = true;
+
+	auto RunStateMachine = [&](bool bEvalOnSourceChange, int32& OutValueAfterUpdate, int32& OutValueAfterChange)
+	{
+		StateInstanceTemplate->bEvalGraphPropertiesOnSourceChange = bEvalOnSourceChange;
+		USMInstance* Instance = TestHelpers::CompileAndCreateStateMachineInstanceFromBP(NewBP);
+		Instance->Start();
+
+		USMStateTestInstance* NodeInstance = CastChecked<USMStateTestInstance>(Instance->GetRootStateMachine().GetSingleInitialState()->GetNodeInstance());
+		TestEqual("Exposed value evaluated on start", NodeInstance->ExposedInt, TestVarDefaultValue + 1); // Begin adds to the value.
+
+		const FSMGraphProperty_Base_Runtime& GraphProperty = (*NodeInstance->GetOwningNode()->GetTemplateGraphProperties().CreateConstIterator()).Value.VariableGraphProperties[0];
+		TestFalse("Sources tracked", GraphProperty.HasUntrackedSources());
+		TestTrue("Variable recorded as source", GraphProperty.GetSourceVariables().Contains(VarName));
+
+		Instance->Update();
+		OutValueAfterUpdate = NodeInstance->ExposedInt;
+
+		FIntProperty* IntProperty = FindFProperty<FIntProperty>(Instance->GetClass(), VarName);
+		check(IntProperty);
+		IntProperty->SetPropertyValue_InContainer(Instance, TestVarChangedValue);
+		Instance->MarkGraphPropertySourceDirty(VarName);
+
+		Instance->Update();
+		OutValueAfterChange = NodeInstance->ExposedInt;
+
+		TestEqual("Skipped evaluations", NodeInstance->GetNumSkippedGraphPropertyEvaluations(), bEvalOnSourceChange ? 1 : 0);
+	};
+
+	int32 ValueAfterUpdate, ValueAfterChange;
+	RunStateMachine(false, ValueAfterUpdate, ValueAfterChange);
+	TestEqual("Always evaluated on update", ValueAfterUpdate, TestVarDefaultValue);
+	TestEqual("Changed value evaluated", ValueAfterChange, TestVarChangedValue);
+
+	int32 TrackedValueAfterUpdate, TrackedValueAfterChange;
+	RunStateMachine(true, TrackedValueAfterUpdate, TrackedValueAfterChange);
+	TestEqual("Unchanged source not evaluated on update", TrackedValueAfterUpdate, TestVarDefaultValue + 1);
+	TestEqual("Changed value evaluated the same in both modes", TrackedValueAfterChange, ValueAfterChange);
+
+	return NewAsset.DeleteAsset(this);
+}
+
 /**
  * Verify default value optimizations.
  */
@@ -17,3 +17,16 @@ ACombatAIController::ACombatAIController()
 	// this is necessary for EnvQueries to work correctly
 	bAttachToPawn = true;
 }
+
+void ACombatAIController::RestartStateTree()
+{
+	// start from the root state, the same as on possess
+	StateTreeAI->StopLogic(TEXT("Restarted from pool"));
+	StateTreeAI->StartLogic();
+}
+
+void ACombatAIController::StopStateTree()
+{
+	// exit the active states so tasks unsubscribe from the enemy
+	StateTreeAI->StopLogic(TEXT("Returned to pool"));
+}
@@ -24,4 +24,10 @@ public:
 
 	/** Constructor */
 	ACombatAIController();
+
+	/** Restarts the StateTree from its root state, used when the possessed enemy is reused from a pool */
+	void RestartStateTree();
+
+	/** Stops the StateTree, used when the possessed enemy is returned to a pool */
+	void StopStateTree();
 };
@@ -5,6 +5,7 @@
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "CombatAIController.h"
+#include "CombatEnemyPoolSubsystem.h"
 #include "Components/WidgetComponent.h"
 #include "Engine/DamageEvents.h"
 #include "CombatLifeBar.h"
@@ -247,10 +248,100 @@ void ACombatEnemy::ApplyHealing(float Healing, AActor* Healer)
 
 void ACombatEnemy::RemoveFromLevel()
 {
+	// return to the pool we were spawned from so we can be reused
+	if (UCombatEnemyPoolSubsystem* Pool = OwningPool.Get())
+	{
+		Pool->ReleaseEnemy(this);
+		return;
+	}
+
 	// destroy this actor
 	Destroy();
 }
 
+void ACombatEnemy::ActivateFromPool(const FTransform& SpawnTransform)
+{
+	// move to the spawn point, dropping any leftover ragdoll velocity
+	SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::ResetPhysics);
+
+	// make sure the ragdoll is off and the mesh is back in place on the capsule
+	GetMesh()->SetSimulatePhysics(false);
+	GetMesh()->SetPhysicsBlendWeight(0.0f);
+	GetMesh()->AttachToComponent(GetCapsuleComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+	GetMesh()->SetRelativeLocationAndRotation(GetBaseTranslationOffset(), GetBaseRotationOffset());
+
+	// restore collision and movement
+	GetCapsuleComponent()->SetCollisionEnabled(AliveCapsuleCollision);
+	GetCharacterMovement()->SetComponentTickEnabled(true);
+	GetCharacterMovement()->SetDefaultMovementMode();
+
+	// show the enemy and resume ticking
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	SetActorTickEnabled(true);
+	GetMesh()->SetComponentTickEnabled(true);
+
+	// reset HP to maximum and fill the life bar
+	CurrentHP = MaxHP;
+	LifeBar->SetHiddenInGame(false);
+
+	if (LifeBarWidget)
+	{
+		LifeBarWidget->SetLifePercentage(1.0f);
+	}
+
+	// we top the HP before restarting StateTree so it picks it up at the right value
+	if (ACombatAIController* AIController = Cast<ACombatAIController>(GetController()))
+	{
+		AIController->RestartStateTree();
+	}
+
+	// pass control to BP to reset its own state
+	ReceivedPoolActivation();
+}
+
+void ACombatEnemy::DeactivateToPool()
+{
+	// clear the death timer
+	GetWorld()->GetTimerManager().ClearTimer(DeathTimer);
+
+	// stop the StateTree first so its tasks release our delegates
+	if (ACombatAIController* AIController = Cast<ACombatAIController>(GetController()))
+	{
+		AIController->StopStateTree();
+	}
+
+	OnAttackCompleted.Unbind();
+	OnEnemyLanded.Unbind();
+
+	// stop any attack in progress and reset the attack state
+	if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
+	{
+		AnimInstance->StopAllMontages(0.0f);
+	}
+
+	bIsAttacking = false;
+	TargetComboCount = 0;
+	CurrentComboAttack = 0;
+	TargetChargeLoops = 0;
+	CurrentChargeLoop = 0;
+
+	// stop the ragdoll and movement
+	GetMesh()->SetSimulatePhysics(false);
+	GetMesh()->SetPhysicsBlendWeight(0.0f);
+	GetCharacterMovement()->StopMovementImmediately();
+	GetCharacterMovement()->DisableMovement();
+	GetCharacterMovement()->SetComponentTickEnabled(false);
+
+	// hide the enemy and stop ticking until reused
+	LifeBar->SetHiddenInGame(true);
+	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetActorTickEnabled(false);
+	GetMesh()->SetComponentTickEnabled(false);
+}
+
 float ACombatEnemy::TakeDamage(float Damage, struct FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser)
 {
 	// only process damage if the character is still alive
@@ -305,6 +396,9 @@ void ACombatEnemy::BeginPlay()
 	// we top the HP before BeginPlay so StateTree picks it up at the right value
 	Super::BeginPlay();
 
+	// remember the capsule collision to restore it when reused from a pool
+	AliveCapsuleCollision = GetCapsuleComponent()->GetCollisionEnabled();
+
 	// get the life bar widget from the widget comp
 	LifeBarWidget = Cast<UCombatLifeBar>(LifeBar->GetUserWidgetObject());
 	check(LifeBarWidget);
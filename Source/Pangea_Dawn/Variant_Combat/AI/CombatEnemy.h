@@ -13,6 +13,7 @@
 class UWidgetComponent;
 class UCombatLifeBar;
 class UAnimMontage;
+class UCombatEnemyPoolSubsystem;
 
 /** Completed attack animation delegate for StateTree */
 DECLARE_DELEGATE(FOnEnemyAttackCompleted);
@@ -136,6 +137,12 @@ protected:
 	/** Attack montage ended delegate */
 	FOnMontageEnded OnAttackMontageEnded;
 
+	/** Pool this enemy returns to after death instead of being destroyed */
+	TWeakObjectPtr<UCombatEnemyPoolSubsystem> OwningPool;
+
+	/** Collision of the capsule while alive, restored when reused from the pool */
+	TEnumAsByte<ECollisionEnabled::Type> AliveCapsuleCollision = ECollisionEnabled::QueryAndPhysics;
+
 public:
 	/** Attack completed internal delegate to notify StateTree tasks */
 	FOnEnemyAttackCompleted OnAttackCompleted;
@@ -158,6 +165,17 @@ public:
 	/** Called from a delegate when the attack montage ends */
 	void AttackMontageEnded(UAnimMontage* Montage, bool bInterrupted);
 
+public:
+
+	/** Sets the pool this enemy returns to after death */
+	void SetOwningPool(UCombatEnemyPoolSubsystem* Pool) { OwningPool = Pool; }
+
+	/** Resets health, physics, movement and StateTree and brings a pooled enemy back into play */
+	void ActivateFromPool(const FTransform& SpawnTransform);
+
+	/** Stops montages, StateTree and physics and hides the enemy while it waits in the pool */
+	void DeactivateToPool();
+
 public:
 
 	// ~begin ICombatAttacker interface
@@ -207,6 +225,10 @@ protected:
 	UFUNCTION(BlueprintImplementableEvent, Category="Combat")
 	void ReceivedDamage(float Damage, const FVector& ImpactPoint, const FVector& DamageDirection);
 
+	/** Blueprint handler to reset any Blueprint state when the enemy is reused from a pool, since BeginPlay only runs once */
+	UFUNCTION(BlueprintImplementableEvent, Category="Combat")
+	void ReceivedPoolActivation();
+
 protected:
 
 	/** Gameplay initialization */
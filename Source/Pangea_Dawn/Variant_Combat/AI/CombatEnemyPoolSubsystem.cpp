@@ -0,0 +1,166 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "CombatEnemyPoolSubsystem.h"
+#include "CombatEnemy.h"
+#include "Engine/World.h"
+
+bool UCombatEnemyPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCombatEnemyPoolSubsystem::Deinitialize()
+{
+	// pooled actors are destroyed with the world
+	Pools.Empty();
+	PendingRequests.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UCombatEnemyPoolSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCombatEnemyPoolSubsystem, STATGROUP_Tickables);
+}
+
+void UCombatEnemyPoolSubsystem::Tick(float DeltaTime)
+{
+	// serve the waiting requests first, in order
+	int32 ServedRequests = 0;
+	while (ServedRequests < PendingRequests.Num() && ConsumeSpawnBudget())
+	{
+		// move the request out, the requester may queue a new one when called
+		FSpawnRequest Request = MoveTemp(PendingRequests[ServedRequests++]);
+
+		// skip requests whose requester is gone
+		if (Request.OnSpawned.IsBound())
+		{
+			if (ACombatEnemy* Enemy = SpawnFromPool(Request.EnemyClass, Request.Transform))
+			{
+				Request.OnSpawned.Execute(Enemy);
+			}
+		}
+	}
+	PendingRequests.RemoveAt(0, ServedRequests, EAllowShrinking::No);
+
+	// fill the pools with the budget left
+	for (TPair<TSubclassOf<ACombatEnemy>, FEnemyPool>& Pool : Pools)
+	{
+		while (Pool.Value.PendingPrewarm > 0 && ConsumeSpawnBudget())
+		{
+			--Pool.Value.PendingPrewarm;
+
+			if (ACombatEnemy* Enemy = CreateEnemy(Pool.Key, Pool.Value.PrewarmTransform))
+			{
+				Enemy->DeactivateToPool();
+				Pool.Value.Inactive.Add(Enemy);
+			}
+		}
+	}
+}
+
+void UCombatEnemyPoolSubsystem::Prewarm(TSubclassOf<ACombatEnemy> EnemyClass, int32 Count, const FTransform& Transform)
+{
+	if (!IsValid(EnemyClass) || Count <= 0)
+	{
+		return;
+	}
+
+	FEnemyPool& Pool = Pools.FindOrAdd(EnemyClass);
+	Pool.PendingPrewarm += Count;
+	Pool.PrewarmTransform = Transform;
+}
+
+void UCombatEnemyPoolSubsystem::RequestEnemy(TSubclassOf<ACombatEnemy> EnemyClass, const FTransform& Transform, FOnCombatEnemySpawned OnSpawned)
+{
+	if (!IsValid(EnemyClass))
+	{
+		return;
+	}
+
+	// spawn right away if nobody is waiting and the budget allows it
+	if (PendingRequests.IsEmpty() && ConsumeSpawnBudget())
+	{
+		if (ACombatEnemy* Enemy = SpawnFromPool(EnemyClass, Transform))
+		{
+			OnSpawned.ExecuteIfBound(Enemy);
+		}
+		return;
+	}
+
+	PendingRequests.Add({ EnemyClass, Transform, MoveTemp(OnSpawned) });
+}
+
+void UCombatEnemyPoolSubsystem::ReleaseEnemy(ACombatEnemy* Enemy)
+{
+	if (!IsValid(Enemy))
+	{
+		return;
+	}
+
+	Enemy->DeactivateToPool();
+	Pools.FindOrAdd(Enemy->GetClass()).Inactive.Add(Enemy);
+}
+
+int32 UCombatEnemyPoolSubsystem::GetNumPooled(TSubclassOf<ACombatEnemy> EnemyClass) const
+{
+	const FEnemyPool* Pool = Pools.Find(EnemyClass);
+	return Pool ? Pool->Inactive.Num() : 0;
+}
+
+bool UCombatEnemyPoolSubsystem::ConsumeSpawnBudget()
+{
+	// the budget is reset on the first spawn of every frame
+	if (BudgetFrame != GFrameCounter)
+	{
+		BudgetFrame = GFrameCounter;
+		SpawnsThisFrame = 0;
+	}
+
+	if (SpawnsThisFrame >= SpawnBudgetPerFrame)
+	{
+		return false;
+	}
+
+	++SpawnsThisFrame;
+	return true;
+}
+
+ACombatEnemy* UCombatEnemyPoolSubsystem::SpawnFromPool(TSubclassOf<ACombatEnemy> EnemyClass, const FTransform& Transform)
+{
+	// reuse the most recently pooled enemy still alive
+	if (FEnemyPool* Pool = Pools.Find(EnemyClass))
+	{
+		while (!Pool->Inactive.IsEmpty())
+		{
+			ACombatEnemy* Enemy = Pool->Inactive.Pop(EAllowShrinking::No).Get();
+			if (IsValid(Enemy))
+			{
+				++NumReused;
+				Enemy->ActivateFromPool(Transform);
+				return Enemy;
+			}
+		}
+	}
+
+	return CreateEnemy(EnemyClass, Transform);
+}
+
+ACombatEnemy* UCombatEnemyPoolSubsystem::CreateEnemy(TSubclassOf<ACombatEnemy> EnemyClass, const FTransform& Transform)
+{
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	ACombatEnemy* Enemy = GetWorld()->SpawnActor<ACombatEnemy>(EnemyClass, Transform, SpawnParams);
+
+	if (Enemy)
+	{
+		++NumCreated;
+
+		// the enemy will return to us instead of being destroyed after death
+		Enemy->SetOwningPool(this);
+	}
+
+	return Enemy;
+}
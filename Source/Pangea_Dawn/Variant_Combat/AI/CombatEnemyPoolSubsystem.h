@@ -0,0 +1,117 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CombatEnemyPoolSubsystem.generated.h"
+
+class ACombatEnemy;
+
+/** Delegate called when a requested enemy has been spawned */
+DECLARE_DELEGATE_OneParam(FOnCombatEnemySpawned, ACombatEnemy*);
+
+/**
+ *  Keeps per-class pools of deactivated Combat Enemies so spawners can reuse them instead of
+ *  spawning and destroying a full character for every wave member.
+ *  Enemies are activated and created within a per-frame spawn budget. Requests over budget wait for the next frames.
+ */
+UCLASS(config=Game)
+class UCombatEnemyPoolSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** Max number of enemies activated or created per frame */
+	UPROPERTY(config, EditAnywhere, Category="Enemy Pool", meta = (ClampMin = 1))
+	int32 SpawnBudgetPerFrame = 2;
+
+	/** Pool of deactivated enemies of a class */
+	struct FEnemyPool
+	{
+		/** Deactivated enemies ready to be reused */
+		TArray<TWeakObjectPtr<ACombatEnemy>> Inactive;
+
+		/** Enemies still to be created to fill the pool */
+		int32 PendingPrewarm = 0;
+
+		/** Transform to create the pre-warmed enemies at */
+		FTransform PrewarmTransform;
+	};
+
+	/** Enemy waiting for spawn budget */
+	struct FSpawnRequest
+	{
+		TSubclassOf<ACombatEnemy> EnemyClass;
+		FTransform Transform;
+		FOnCombatEnemySpawned OnSpawned;
+	};
+
+	/** Pools by enemy class */
+	TMap<TSubclassOf<ACombatEnemy>, FEnemyPool> Pools;
+
+	/** Requests waiting for spawn budget, in request order */
+	TArray<FSpawnRequest> PendingRequests;
+
+	/** Frame the spawn budget was last used in */
+	uint64 BudgetFrame = 0;
+
+	/** Spawns done during BudgetFrame */
+	int32 SpawnsThisFrame = 0;
+
+	/** Number of enemy actors created by the pool */
+	int32 NumCreated = 0;
+
+	/** Number of spawns served by reusing a pooled enemy */
+	int32 NumReused = 0;
+
+public:
+
+	/** Only game worlds pool enemies */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Cleanup */
+	virtual void Deinitialize() override;
+
+	/** Serves waiting requests, then pre-warms pools with the budget left */
+	virtual void Tick(float DeltaTime) override;
+
+	/** Stat ID for the tickable */
+	virtual TStatId GetStatId() const override;
+
+	/** Creates deactivated enemies of a class over the next frames, as spawn budget allows */
+	void Prewarm(TSubclassOf<ACombatEnemy> EnemyClass, int32 Count, const FTransform& Transform);
+
+	/** Spawns an enemy, reusing a pooled one when available. The delegate is called right away if within budget, or on a later frame */
+	void RequestEnemy(TSubclassOf<ACombatEnemy> EnemyClass, const FTransform& Transform, FOnCombatEnemySpawned OnSpawned);
+
+	/** Deactivates an enemy and returns it to the pool of its class */
+	void ReleaseEnemy(ACombatEnemy* Enemy);
+
+	/** Returns the number of deactivated enemies of a class */
+	int32 GetNumPooled(TSubclassOf<ACombatEnemy> EnemyClass) const;
+
+	/** Returns the max number of enemies activated or created per frame */
+	int32 GetSpawnBudgetPerFrame() const { return SpawnBudgetPerFrame; }
+
+	/** Returns the number of enemy actors created by the pool */
+	int32 GetNumCreated() const { return NumCreated; }
+
+	/** Returns the number of spawns served by reusing a pooled enemy */
+	int32 GetNumReused() const { return NumReused; }
+
+	/** Returns the number of spawn requests waiting for budget */
+	int32 GetNumPendingRequests() const { return PendingRequests.Num(); }
+
+protected:
+
+	/** Consumes one spawn from the budget of this frame. Returns false if the budget is spent */
+	bool ConsumeSpawnBudget();
+
+	/** Activates a pooled enemy, or creates a new one if the pool is empty */
+	ACombatEnemy* SpawnFromPool(TSubclassOf<ACombatEnemy> EnemyClass, const FTransform& Transform);
+
+	/** Creates a new pooled enemy actor */
+	ACombatEnemy* CreateEnemy(TSubclassOf<ACombatEnemy> EnemyClass, const FTransform& Transform);
+};
@@ -7,6 +7,7 @@
 #include "Components/ArrowComponent.h"
 #include "TimerManager.h"
 #include "CombatEnemy.h"
+#include "CombatEnemyPoolSubsystem.h"
 
 ACombatEnemySpawner::ACombatEnemySpawner()
 {
@@ -30,6 +31,15 @@ ACombatEnemySpawner::ACombatEnemySpawner()
 void ACombatEnemySpawner::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// fill the pool ahead of time so the first spawns don't create actors
+	if (bUseEnemyPool)
+	{
+		if (UCombatEnemyPoolSubsystem* Pool = GetWorld()->GetSubsystem<UCombatEnemyPoolSubsystem>())
+		{
+			Pool->Prewarm(EnemyClass, PoolPrewarmCount, SpawnCapsule->GetComponentTransform());
+		}
+	}
 	
 	// should we spawn an enemy right away?
 	if (bShouldSpawnEnemiesImmediately)
@@ -53,23 +63,45 @@ void ACombatEnemySpawner::SpawnEnemy()
 	// ensure the enemy class is valid
 	if (IsValid(EnemyClass))
 	{
+		// draw the enemy from the pool, it may be spawned on a later frame if over the spawn budget
+		if (bUseEnemyPool)
+		{
+			if (UCombatEnemyPoolSubsystem* Pool = GetWorld()->GetSubsystem<UCombatEnemyPoolSubsystem>())
+			{
+				Pool->RequestEnemy(EnemyClass, SpawnCapsule->GetComponentTransform(), FOnCombatEnemySpawned::CreateUObject(this, &ACombatEnemySpawner::OnEnemySpawned));
+				return;
+			}
+		}
+
 		// spawn the enemy at the reference capsule's transform
 		FActorSpawnParameters SpawnParams;
 		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
 
-		ACombatEnemy* SpawnedEnemy = GetWorld()->SpawnActor<ACombatEnemy>(EnemyClass, SpawnCapsule->GetComponentTransform(), SpawnParams);
-
 		// was the enemy successfully created?
-		if (SpawnedEnemy)
+		if (ACombatEnemy* Enemy = GetWorld()->SpawnActor<ACombatEnemy>(EnemyClass, SpawnCapsule->GetComponentTransform(), SpawnParams))
 		{
-			// subscribe to the death delegate
-			SpawnedEnemy->OnEnemyDied.AddDynamic(this, &ACombatEnemySpawner::OnEnemyDied);
+			OnEnemySpawned(Enemy);
 		}
 	}
 }
 
+void ACombatEnemySpawner::OnEnemySpawned(ACombatEnemy* Enemy)
+{
+	SpawnedEnemy = Enemy;
+
+	// subscribe to the death delegate
+	Enemy->OnEnemyDied.AddDynamic(this, &ACombatEnemySpawner::OnEnemyDied);
+}
+
 void ACombatEnemySpawner::OnEnemyDied()
 {
+	// unsubscribe, pooled enemies will be reused by other spawners
+	if (ACombatEnemy* Enemy = SpawnedEnemy.Get())
+	{
+		Enemy->OnEnemyDied.RemoveDynamic(this, &ACombatEnemySpawner::OnEnemyDied);
+	}
+	SpawnedEnemy.Reset();
+
 	// decrease the spawn counter
 	--SpawnCount;
 
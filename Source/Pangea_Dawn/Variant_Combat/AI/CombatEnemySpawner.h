@@ -16,6 +16,7 @@ class ACombatEnemy;
  *  Enemies will be spawned one by one, and the spawner will wait until the enemy dies before spawning a new one.
  *  The spawner can be remotely activated through the ICombatActivatable interface
  *  When the last spawned enemy dies, the spawner can also activate other ICombatActivatables
+ *  Enemies can be drawn from the world's enemy pool, so they are reused instead of being spawned and destroyed
  */
 UCLASS(abstract)
 class ACombatEnemySpawner : public AActor, public ICombatActivatable
@@ -50,6 +51,14 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Enemy Spawner", meta = (ClampMin = 0, ClampMax = 10))
 	float RespawnDelay = 5.0f;
 
+	/** If true, enemies are reused from the world's enemy pool instead of spawned and destroyed */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Enemy Spawner|Pool")
+	bool bUseEnemyPool = true;
+
+	/** Number of deactivated enemies this spawner adds to the pool ahead of time */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Enemy Spawner|Pool", meta = (ClampMin = 0, ClampMax = 10, EditCondition = "bUseEnemyPool"))
+	int32 PoolPrewarmCount = 1;
+
 	/** Time to wait after this spawner is depleted before activating the actor list */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Activation", meta = (ClampMin = 0, ClampMax = 10))
 	float ActivationDelay = 1.0f;
@@ -64,6 +73,9 @@ protected:
 	/** Timer to spawn enemies after a delay */
 	FTimerHandle SpawnTimer;
 
+	/** Enemy currently spawned */
+	TWeakObjectPtr<ACombatEnemy> SpawnedEnemy;
+
 public:	
 	
 	/** Constructor */
@@ -82,6 +94,9 @@ protected:
 	/** Spawn an enemy and subscribe to its death event */
 	void SpawnEnemy();
 
+	/** Called when the requested enemy has been spawned or reused */
+	void OnEnemySpawned(ACombatEnemy* Enemy);
+
 	/** Called when the spawned enemy has died */
 	UFUNCTION()
 	void OnEnemyDied();
@@ -0,0 +1,243 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "CombatEnemy.h"
+#include "CombatEnemyPoolSubsystem.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/Blueprint.h"
+#include "Engine/DamageEvents.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/PackageName.h"
+#include "UObject/UObjectArray.h"
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace CombatEnemyPoolTests
+{
+	/** Game world with actors initialized for play, so enemies begin play and the pool ticks */
+	struct FTestWorld
+	{
+		UWorld* World = nullptr;
+
+		FTestWorld()
+		{
+			World = UWorld::CreateWorld(EWorldType::Game, false);
+
+			FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+			WorldContext.SetCurrentWorld(World);
+
+			FURL URL;
+			World->SetGameMode(URL);
+			World->InitializeActorsForPlay(URL);
+			World->BeginPlay();
+		}
+
+		~FTestWorld()
+		{
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(false);
+		}
+
+		void Tick(float FrameTime)
+		{
+			World->Tick(LEVELTICK_All, FrameTime);
+			++GFrameCounter;
+		}
+	};
+
+	/** Counts the UObjects created while it exists */
+	class FObjectCreationCounter : public FUObjectArray::FUObjectCreateListener
+	{
+	public:
+
+		FObjectCreationCounter()
+		{
+			GUObjectArray.AddUObjectCreateListener(this);
+		}
+
+		virtual ~FObjectCreationCounter()
+		{
+			GUObjectArray.RemoveUObjectCreateListener(this);
+		}
+
+		virtual void NotifyUObjectCreated(const UObjectBase* Object, int32 Index) override
+		{
+			++NumCreated;
+		}
+
+		virtual void OnUObjectArrayShutdown() override
+		{
+			GUObjectArray.RemoveUObjectCreateListener(this);
+		}
+
+		std::atomic<int32> NumCreated = 0;
+	};
+
+	/** Combat Enemies are abstract, the pool is tested with every enemy Blueprint of the project */
+	void GatherEnemyBlueprints(TArray<FString>& OutClassPaths)
+	{
+		const FString CombatEnemyPath = ACombatEnemy::StaticClass()->GetPathName();
+
+		TArray<FAssetData> Blueprints;
+		IAssetRegistry::GetChecked().GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), Blueprints, true);
+
+		for (const FAssetData& Blueprint : Blueprints)
+		{
+			FString NativeParentClass;
+			FString GeneratedClass;
+			if (Blueprint.GetTagValue(FBlueprintTags::NativeParentClassPath, NativeParentClass)
+				&& Blueprint.GetTagValue(FBlueprintTags::GeneratedClassPath, GeneratedClass)
+				&& FPackageName::ExportTextPathToObjectPath(NativeParentClass) == CombatEnemyPath)
+			{
+				OutClassPaths.Add(FPackageName::ExportTextPathToObjectPath(GeneratedClass));
+			}
+		}
+	}
+}
+
+/**
+ *  Cycles enemy spawns and deaths through the pool, the way spawners replace the dead enemies of a wave.
+ *  Checks every spawn is served by the pool within the spawn budget and every dead enemy returns to it,
+ *  and reports the time spent, the UObjects created and the memory allocated by the cycles.
+ *  The number of cycles can be changed with -EnemyPoolCycles= on the command line.
+ */
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FCombatEnemyPoolCycleTest, "Pangea_Dawn.Combat.EnemyPool.Cycle",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+void FCombatEnemyPoolCycleTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	TArray<FString> ClassPaths;
+	CombatEnemyPoolTests::GatherEnemyBlueprints(ClassPaths);
+
+	for (const FString& ClassPath : ClassPaths)
+	{
+		OutBeautifiedNames.Add(FPackageName::ObjectPathToObjectName(ClassPath));
+		OutTestCommands.Add(ClassPath);
+	}
+}
+
+bool FCombatEnemyPoolCycleTest::RunTest(const FString& Parameters)
+{
+	using namespace CombatEnemyPoolTests;
+
+	int32 NumCycles = 2000;
+	FParse::Value(FCommandLine::Get(), TEXT("EnemyPoolCycles="), NumCycles);
+	NumCycles = FMath::Max(NumCycles, 1);
+
+	constexpr int32 MaxAlive = 8;
+	constexpr float FrameTime = 1.0f / 30.0f;
+	const int32 MaxFrames = FMath::Max(NumCycles * 10, 10000);
+
+	TSubclassOf<ACombatEnemy> EnemyClass = LoadClass<ACombatEnemy>(nullptr, *Parameters);
+	if (!TestNotNull(TEXT("Enemy class is loaded"), EnemyClass.Get()))
+	{
+		return false;
+	}
+
+	FTestWorld TestWorld;
+	UWorld* World = TestWorld.World;
+	UCombatEnemyPoolSubsystem* Pool = World->GetSubsystem<UCombatEnemyPoolSubsystem>();
+	if (!TestNotNull(TEXT("Game worlds have an enemy pool"), Pool))
+	{
+		return false;
+	}
+
+	// fill the pool ahead of the cycles, as spawners do on BeginPlay
+	Pool->Prewarm(EnemyClass, MaxAlive, FTransform::Identity);
+	for (int32 Frame = 0; Frame < MaxFrames && Pool->GetNumPooled(EnemyClass) < MaxAlive; ++Frame)
+	{
+		TestWorld.Tick(FrameTime);
+	}
+	TestEqual(TEXT("Pool is pre-warmed"), Pool->GetNumPooled(EnemyClass), MaxAlive);
+
+	const int32 CreatedBefore = Pool->GetNumCreated();
+	const int32 ReusedBefore = Pool->GetNumReused();
+
+	TArray<TWeakObjectPtr<ACombatEnemy>> AliveEnemies;
+	int32 NumRequested = 0;
+	int32 NumSpawned = 0;
+	int32 NumDeaths = 0;
+	int32 SpawnedThisFrame = 0;
+	int32 MaxSpawnedInFrame = 0;
+	int32 Frames = 0;
+	double WorstFrameSeconds = 0.0;
+
+	const uint64 MemoryBefore = FPlatformMemory::GetStats().UsedPhysical;
+	FObjectCreationCounter ObjectCounter;
+	const double StartTime = FPlatformTime::Seconds();
+
+	// keep MaxAlive enemies alive, killing every living enemy each frame
+	while (NumDeaths < NumCycles && Frames < MaxFrames)
+	{
+		const double FrameStart = FPlatformTime::Seconds();
+
+		while (NumRequested - NumSpawned + AliveEnemies.Num() < MaxAlive && NumRequested < NumCycles)
+		{
+			++NumRequested;
+			Pool->RequestEnemy(EnemyClass, FTransform::Identity, FOnCombatEnemySpawned::CreateLambda([&](ACombatEnemy* Enemy)
+			{
+				++NumSpawned;
+				++SpawnedThisFrame;
+				AliveEnemies.Add(Enemy);
+			}));
+		}
+
+		for (const TWeakObjectPtr<ACombatEnemy>& Enemy : AliveEnemies)
+		{
+			if (Enemy.IsValid())
+			{
+				Enemy->TakeDamage(Enemy->CurrentHP, FDamageEvent(), nullptr, nullptr);
+			}
+			++NumDeaths;
+		}
+		AliveEnemies.Reset();
+
+		// waiting requests are served in the tick, with the budget left by the requests of this frame
+		TestWorld.Tick(FrameTime);
+		++Frames;
+
+		MaxSpawnedInFrame = FMath::Max(MaxSpawnedInFrame, SpawnedThisFrame);
+		SpawnedThisFrame = 0;
+		WorstFrameSeconds = FMath::Max(WorstFrameSeconds, FPlatformTime::Seconds() - FrameStart);
+	}
+
+	const double CycleSeconds = FPlatformTime::Seconds() - StartTime;
+	const int32 NumCreatedObjects = ObjectCounter.NumCreated;
+	const int64 MemoryDelta = (int64)FPlatformMemory::GetStats().UsedPhysical - (int64)MemoryBefore;
+
+	TestEqual(TEXT("Every requested enemy was spawned and killed"), NumDeaths, NumCycles);
+	TestTrue(TEXT("Spawns stay within the budget"), MaxSpawnedInFrame <= Pool->GetSpawnBudgetPerFrame());
+	TestEqual(TEXT("No request is left waiting"), Pool->GetNumPendingRequests(), 0);
+
+	const int32 NumCreated = Pool->GetNumCreated() - CreatedBefore;
+	const int32 NumReused = Pool->GetNumReused() - ReusedBefore;
+	TestEqual(TEXT("Every spawn is served by the pool"), NumCreated + NumReused, NumCycles);
+
+	// enemies created while the dead ones waited for their removal timer grow the pool
+	const int32 NumPoolEnemies = MaxAlive + NumCreated;
+	for (int32 Frame = 0; Frame < MaxFrames && Pool->GetNumPooled(EnemyClass) < NumPoolEnemies; ++Frame)
+	{
+		TestWorld.Tick(FrameTime);
+	}
+	TestEqual(TEXT("Dead enemies return to the pool"), Pool->GetNumPooled(EnemyClass), NumPoolEnemies);
+
+	// the garbage left by the cycles is part of their cost
+	const double GCStart = FPlatformTime::Seconds();
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	const double GCSeconds = FPlatformTime::Seconds() - GCStart;
+
+	AddInfo(FString::Printf(TEXT("Cycles %d | Alive %d | Budget %d per frame | %d frames | %.2f ms total | worst frame %.2f ms | %d created | %d reused"),
+		NumCycles, MaxAlive, Pool->GetSpawnBudgetPerFrame(), Frames, CycleSeconds * 1000.0, WorstFrameSeconds * 1000.0, NumCreated, NumReused));
+	AddInfo(FString::Printf(TEXT("Allocations: %d UObjects created | memory %+.2f MB | GC %.2f ms"),
+		NumCreatedObjects, MemoryDelta / (1024.0 * 1024.0), GCSeconds * 1000.0));
+
+	return true;
+}
+
+#endif